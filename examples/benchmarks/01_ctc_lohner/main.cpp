@@ -0,0 +1,51 @@
+/**
+ *  Codac - Examples
+ *  Benchmark: scaling of CtcLohner with respect to the number of slices
+ * ----------------------------------------------------------------------------
+ *
+ *  \brief      A damped oscillator is integrated with CtcLohner over tubes
+ *              of increasing length (constant timestep). The cost per slice
+ *              is expected to remain constant: one forward/backward pass is
+ *              linear in the number of slices.
+ *
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <chrono>
+#include <iomanip>
+#include <codac.h>
+
+using namespace std;
+using namespace codac;
+
+int main(int argc, char *argv[])
+{
+  double dt = 0.01;
+  Function f("x1", "x2", "(x2 ; -x1 - 0.2*x2)");
+  CtcLohner ctc_lohner(f);
+
+  cout << setw(10) << "slices" << setw(14) << "time (s)" << setw(18) << "time/slice (us)" << endl;
+
+  for(int n = 1000 ; n <= 32000 ; n *= 2)
+  {
+    TubeVector x(Interval(0.,n*dt), dt, 2);
+    x.set(IntervalVector({{0.9,1.1},{-0.1,0.1}}), 0.);
+
+    chrono::steady_clock::time_point t0 = chrono::steady_clock::now();
+    ctc_lohner.contract(x, TimePropag::FORWARD | TimePropag::BACKWARD);
+    double duration = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+
+    cout << setw(10) << x.nb_slices()
+         << setw(14) << duration
+         << setw(18) << 1e6 * duration / x.nb_slices() << endl;
+
+    if(x.is_empty())
+      return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
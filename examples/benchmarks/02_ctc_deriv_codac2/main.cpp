@@ -0,0 +1,77 @@
+/**
+ *  Codac - Examples
+ *  Benchmark: CtcDeriv on codac2 tubes, native path vs codac1 conversions
+ * ----------------------------------------------------------------------------
+ *
+ *  \brief      The native contraction of codac2 tubes (slice level, in place)
+ *              is compared with the former approach that converted the tubes
+ *              into codac1 objects before and after the contraction.
+ *
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <chrono>
+#include <iomanip>
+#include <codac.h>
+
+using namespace std;
+using namespace codac;
+
+double elapsed(const chrono::steady_clock::time_point& t0)
+{
+  return chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+}
+
+int main(int argc, char *argv[])
+{
+  int nb_iterations = 10;
+
+  cout << setw(10) << "slices"
+       << setw(16) << "conversions (s)"
+       << setw(12) << "native (s)"
+       << setw(10) << "speedup" << endl;
+
+  for(double dt : { 0.1, 0.01, 0.001 })
+  {
+    auto tdomain = codac2::create_tdomain(Interval(0,10), dt, true);
+    codac2::Tube<Interval> v(tdomain, TFunction("cos(t)+[-0.1,0.1]"));
+    codac2::Tube<Interval> x_conv(tdomain), x_native(tdomain);
+    x_conv.set(Interval(0.), 0.);
+    x_native.set(Interval(0.), 0.);
+
+    CtcDeriv ctc_deriv;
+
+    // Former approach: contraction performed on codac1 copies
+
+    chrono::steady_clock::time_point t0 = chrono::steady_clock::now();
+    for(int k = 0 ; k < nb_iterations ; k++)
+    {
+      codac::Tube x1 = codac2::to_codac1(x_conv);
+      codac::Tube v1 = codac2::to_codac1(v);
+      ctc_deriv.contract(x1, v1);
+      x_conv &= codac2::to_codac2(x1);
+    }
+    double t_conv = elapsed(t0);
+
+    // Native approach
+
+    t0 = chrono::steady_clock::now();
+    for(int k = 0 ; k < nb_iterations ; k++)
+      ctc_deriv.contract(x_native, v);
+    double t_native = elapsed(t0);
+
+    cout << setw(10) << tdomain->nb_tslices()
+         << setw(16) << t_conv
+         << setw(12) << t_native
+         << setw(10) << t_conv / t_native << endl;
+
+    if(x_native.is_empty())
+      return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
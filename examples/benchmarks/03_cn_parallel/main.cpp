@@ -0,0 +1,71 @@
+/**
+ *  Codac - Examples
+ *  Benchmark: multithreaded propagation in a ContractorNetwork
+ * ----------------------------------------------------------------------------
+ *
+ *  \brief      A tube is contracted by CtcDeriv contractors defined on each
+ *              of its slices. The same network is solved with an increasing
+ *              number of threads; results are compared with the sequential
+ *              fixed point.
+ *
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <chrono>
+#include <thread>
+#include <iomanip>
+#include <codac.h>
+
+using namespace std;
+using namespace codac;
+
+int main(int argc, char *argv[])
+{
+  double dt = 0.001;
+  Interval tdomain(0.,10.);
+  Tube v(tdomain, dt, TFunction("cos(t)+[-0.1,0.1]"));
+  Tube x0(tdomain, dt, Interval(-100.,100.));
+  x0.set(Interval(0.), 0.);
+  x0.set(Interval(sin(10.)).inflate(0.5), 10.);
+
+  int max_threads = max(1, (int)thread::hardware_concurrency());
+  double t_seq = 0.;
+  Tube x_seq(x0);
+
+  cout << setw(10) << "threads" << setw(14) << "time (s)" << setw(10) << "speedup" << endl;
+
+  for(int nb_threads = 1 ; nb_threads <= max_threads ; nb_threads *= 2)
+  {
+    Tube x(x0);
+    CtcDeriv ctc_deriv;
+
+    ContractorNetwork cn;
+    cn.set_fixedpoint_ratio(0.);
+    cn.set_nb_threads(nb_threads);
+    cn.add(ctc_deriv, {x, v});
+
+    double t = cn.contract();
+
+    if(nb_threads == 1)
+    {
+      t_seq = t;
+      x_seq = x;
+    }
+
+    cout << setw(10) << nb_threads
+         << setw(14) << t
+         << setw(10) << t_seq / t << endl;
+
+    if(x != x_seq)
+    {
+      cout << "Error: the result differs from the sequential fixed point" << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,62 @@
+/**
+ *  Codac - Examples
+ *  Benchmark: building and solving large ContractorNetworks
+ * ----------------------------------------------------------------------------
+ *
+ *  \brief      Tubes made of an increasing number of slices are added to a
+ *              ContractorNetwork with a CtcDeriv contractor, which creates
+ *              one domain per slice. Times for building the network and for
+ *              the propagation are expected to grow linearly.
+ *
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <chrono>
+#include <iomanip>
+#include <codac.h>
+
+using namespace std;
+using namespace codac;
+
+double elapsed(const chrono::steady_clock::time_point& t0)
+{
+  return chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+}
+
+int main(int argc, char *argv[])
+{
+  cout << setw(10) << "domains"
+       << setw(14) << "contractors"
+       << setw(14) << "build (s)"
+       << setw(14) << "contract (s)" << endl;
+
+  for(int n = 6250 ; n <= 50000 ; n *= 2)
+  {
+    double dt = 10. / n;
+    Tube x(Interval(0.,10.), dt, Interval(-100.,100.)), v(Interval(0.,10.), dt, Interval(-1.,1.));
+    x.set(Interval(0.), 0.);
+
+    CtcDeriv ctc_deriv;
+    ContractorNetwork cn;
+
+    chrono::steady_clock::time_point t0 = chrono::steady_clock::now();
+    cn.add(ctc_deriv, {x, v});
+    double t_build = elapsed(t0);
+
+    double t_contract = cn.contract();
+
+    cout << setw(10) << cn.nb_dom()
+         << setw(14) << cn.nb_ctc()
+         << setw(14) << t_build
+         << setw(14) << t_contract << endl;
+
+    if(x.is_empty())
+      return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,84 @@
+/**
+ *  Codac - Examples
+ *  Benchmark: scheduling policies of a ContractorNetwork
+ * ----------------------------------------------------------------------------
+ *
+ *  \brief      A trajectory is estimated from its derivative and from a set
+ *              of range-only observations (CtcEval on the tube). The same
+ *              network is solved with each scheduling policy of the CN; the
+ *              fixed points are expected to be identical.
+ *
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <iomanip>
+#include <codac.h>
+
+using namespace std;
+using namespace codac;
+
+int main(int argc, char *argv[])
+{
+  double dt = 0.01;
+  Interval tdomain(0.,20.);
+  TrajectoryVector actual_x(tdomain, TFunction("(10*cos(t)+t ; 5*sin(2*t)+t)"));
+  Tube v(tdomain, dt, TFunction("-10*sin(t)+1+[-0.05,0.05]"));
+
+  // Observations of the first component, every second
+  vector<Interval> v_t, v_y;
+  for(double t = 1. ; t < tdomain.ub() ; t += 1.)
+  {
+    v_t.push_back(Interval(t));
+    v_y.push_back(Interval(actual_x(t)[0]).inflate(0.1));
+  }
+
+  vector<pair<string,ContractorNetwork::Scheduling> > v_policies = {
+    { "default", ContractorNetwork::Scheduling::DEFAULT },
+    { "fifo", ContractorNetwork::Scheduling::FIFO },
+    { "lifo", ContractorNetwork::Scheduling::LIFO },
+    { "priority", ContractorNetwork::Scheduling::PRIORITY },
+    { "round-robin", ContractorNetwork::Scheduling::ROUND_ROBIN }
+  };
+
+  cout << setw(14) << "scheduling" << setw(14) << "time (s)" << setw(14) << "volume" << endl;
+  double ref_volume = -1.;
+
+  for(const auto& policy : v_policies)
+  {
+    Tube x(tdomain, dt, Interval(-100.,100.));
+    x.set(Interval(actual_x(0.)[0]), 0.);
+    vector<Interval> v_t_copy(v_t), v_y_copy(v_y);
+
+    CtcDeriv ctc_deriv;
+    CtcEval ctc_eval;
+    ctc_eval.enable_time_propag(false);
+
+    ContractorNetwork cn;
+    cn.set_fixedpoint_ratio(0.);
+    cn.set_scheduling(policy.second);
+    cn.add(ctc_deriv, {x, v});
+    for(size_t i = 0 ; i < v_t_copy.size() ; i++)
+      cn.add(ctc_eval, {v_t_copy[i], v_y_copy[i], x, v});
+
+    double t = cn.contract();
+
+    cout << setw(14) << policy.first
+         << setw(14) << t
+         << setw(14) << x.volume() << endl;
+
+    if(ref_volume < 0.)
+      ref_volume = x.volume();
+
+    else if(fabs(x.volume() - ref_volume) > 1e-6 * ref_volume)
+    {
+      cout << "Error: the fixed point differs from the one of the default policy" << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,93 @@
+/**
+ *  Codac - Examples
+ *  Benchmark: parallel SIVIA
+ * ----------------------------------------------------------------------------
+ *
+ *  \brief      A 4d set defined by a separator is approximated by SIVIA,
+ *              with the serial algorithm and with an increasing number of
+ *              threads (each thread owning its separator object).
+ *
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <chrono>
+#include <thread>
+#include <iomanip>
+#include <codac.h>
+
+using namespace std;
+using namespace codac;
+
+double elapsed(const chrono::steady_clock::time_point& t0)
+{
+  return chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+}
+
+// Separator owning its function, so that one instance can be created for each thread
+class SepAnnulus4d : public ibex::Sep
+{
+  public:
+
+    SepAnnulus4d()
+      : ibex::Sep(4), m_f("x[4]", "x[0]^2+x[1]^2+x[2]^2+x[3]^2+sin(x[0]*x[1])"), m_sep(m_f, Interval(1.,2.))
+    { }
+
+    void separate(IntervalVector& x_in, IntervalVector& x_out)
+    {
+      m_sep.separate(x_in, x_out);
+    }
+
+  protected:
+
+    ibex::Function m_f;
+    ibex::SepFwdBwd m_sep;
+};
+
+int main(int argc, char *argv[])
+{
+  IntervalVector x0(4, Interval(-2.,2.));
+  float precision = 0.15;
+
+  SepAnnulus4d sep;
+  chrono::steady_clock::time_point t0 = chrono::steady_clock::now();
+  SIVIA(x0, sep, precision, false, false, "", true);
+  double t_ref = elapsed(t0);
+
+  cout << setw(10) << "threads" << setw(12) << "order"
+       << setw(14) << "time (s)" << setw(10) << "speedup" << endl;
+  cout << setw(10) << "serial" << setw(12) << "-"
+       << setw(14) << t_ref << setw(10) << 1. << endl;
+
+  int max_threads = max(1, (int)thread::hardware_concurrency());
+  map<SetValue,list<IntervalVector>> res_par; // reference for the parallel runs
+
+  for(int nb_threads = 1 ; nb_threads <= max_threads ; nb_threads *= 2)
+    for(bool best_first : { false, true })
+    {
+      t0 = chrono::steady_clock::now();
+      auto res = SIVIA(x0, []() { return unique_ptr<ibex::Sep>(new SepAnnulus4d()); },
+        precision, nb_threads, best_first, false, false, "", true);
+      double t = elapsed(t0);
+
+      cout << setw(10) << nb_threads << setw(12) << (best_first ? "best-first" : "depth-first")
+           << setw(14) << t << setw(10) << t_ref / t << endl;
+
+      // The leaves of the paving do not depend on the order of the computations
+      if(res_par.empty())
+        res_par = res;
+
+      else
+        for(const auto& v : { SetValue::IN, SetValue::OUT, SetValue::UNKNOWN })
+          if(res[v].size() != res_par[v].size())
+          {
+            cout << "Error: the paving differs from the one obtained with one thread" << endl;
+            return EXIT_FAILURE;
+          }
+    }
+
+  return EXIT_SUCCESS;
+}
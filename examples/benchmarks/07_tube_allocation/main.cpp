@@ -0,0 +1,101 @@
+/**
+ *  Codac - Examples
+ *  Benchmark: memory allocations of the slices of a tube
+ * ----------------------------------------------------------------------------
+ *
+ *  \brief      Tubes of increasing size are built, copied and destroyed.
+ *              The number of calls to the global operator new and the
+ *              computation times are reported for each operation.
+ *
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <new>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <codac.h>
+
+using namespace std;
+using namespace codac;
+
+// Counting the dynamic allocations of the whole program
+
+atomic<size_t> nb_allocations(0);
+
+void* operator new(size_t size)
+{
+  nb_allocations++;
+  void *ptr = malloc(size == 0 ? 1 : size);
+  if(!ptr)
+    throw bad_alloc();
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept
+{
+  free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept
+{
+  free(ptr);
+}
+
+double elapsed(const chrono::steady_clock::time_point& t0)
+{
+  return chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+}
+
+int main(int argc, char *argv[])
+{
+  cout << setw(10) << "slices"
+       << setw(14) << "construct (s)" << setw(10) << "allocs"
+       << setw(12) << "copy (s)" << setw(10) << "allocs"
+       << setw(14) << "destroy (s)" << endl;
+
+  for(double dt : { 0.01, 0.001, 0.0001, 0.00001 })
+  {
+    // Construction
+
+    size_t n0 = nb_allocations;
+    chrono::steady_clock::time_point t0 = chrono::steady_clock::now();
+    Tube *x = new Tube(Interval(0.,10.), dt, Interval(-1.,1.));
+    double t_construct = elapsed(t0);
+    size_t n_construct = nb_allocations - n0;
+
+    // Copy
+
+    n0 = nb_allocations;
+    t0 = chrono::steady_clock::now();
+    Tube *y = new Tube(*x);
+    double t_copy = elapsed(t0);
+    size_t n_copy = nb_allocations - n0;
+
+    if(*x != *y)
+    {
+      cout << "Error: the copy differs from the original tube" << endl;
+      return EXIT_FAILURE;
+    }
+
+    // Destruction
+
+    int nb_slices = x->nb_slices();
+    t0 = chrono::steady_clock::now();
+    delete x;
+    delete y;
+    double t_destroy = elapsed(t0) / 2.;
+
+    cout << setw(10) << nb_slices
+         << setw(14) << t_construct << setw(10) << n_construct
+         << setw(12) << t_copy << setw(10) << n_copy
+         << setw(14) << t_destroy << endl;
+  }
+
+  return EXIT_SUCCESS;
+}
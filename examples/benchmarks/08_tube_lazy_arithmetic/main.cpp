@@ -0,0 +1,65 @@
+/**
+ *  Codac - Examples
+ *  Benchmark: lazy arithmetic on tubes
+ * ----------------------------------------------------------------------------
+ *
+ *  \brief      The expression sqrt(sqr(x)+sqr(y))*dt is computed on tubes of
+ *              increasing size, with the operators of codac_tube_arithmetic.h
+ *              and with the expression templates of codac_tube_arithmetic_lazy.h.
+ *
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <codac.h>
+
+using namespace std;
+using namespace codac;
+
+double elapsed(const chrono::steady_clock::time_point& t0)
+{
+  return chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+}
+
+int main(int argc, char *argv[])
+{
+  cout << setw(10) << "slices"
+       << setw(12) << "eager (s)"
+       << setw(12) << "lazy (s)"
+       << setw(10) << "speedup" << endl;
+
+  Interval dt(0.1);
+
+  for(double timestep : { 0.01, 0.001, 0.0001 })
+  {
+    Tube x(Interval(0.,10.), timestep, TFunction("cos(t)+[-0.1,0.1]"));
+    Tube y(Interval(0.,10.), timestep, TFunction("sin(t)+[-0.1,0.1]"));
+
+    chrono::steady_clock::time_point t0 = chrono::steady_clock::now();
+    Tube z_eager = sqrt(sqr(x) + sqr(y)) * dt;
+    double t_eager = elapsed(t0);
+
+    t0 = chrono::steady_clock::now();
+    Tube z_lazy = sqrt(sqr(lazy(x)) + sqr(lazy(y))) * dt;
+    double t_lazy = elapsed(t0);
+
+    if(z_eager != z_lazy)
+    {
+      cout << "Error: lazy and eager evaluations differ" << endl;
+      return EXIT_FAILURE;
+    }
+
+    cout << setw(10) << x.nb_slices()
+         << setw(12) << t_eager
+         << setw(12) << t_lazy
+         << setw(10) << t_eager / t_lazy << endl;
+  }
+
+  return EXIT_SUCCESS;
+}
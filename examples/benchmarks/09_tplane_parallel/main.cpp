@@ -0,0 +1,104 @@
+/** 
+ *  Codac - Examples
+ *  Benchmark: parallel and incremental loop detection
+ * ----------------------------------------------------------------------------
+ *
+ *  \brief      The loops of a figure-eight trajectory are detected in the
+ *              t-plane with an increasing number of threads. Then, the tubes
+ *              are extended in time as during an online mission, and the
+ *              t-plane is updated incrementally or computed from scratch.
+ *
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <chrono>
+#include <thread>
+#include <iomanip>
+#include <codac.h>
+#include <codac-rob.h>
+
+using namespace std;
+using namespace codac;
+
+double elapsed(const chrono::steady_clock::time_point& t0)
+{
+  return chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+}
+
+// Tubes of positions and velocities of the robot over [0,tf]
+pair<TubeVector,TubeVector> robot_tubes(double tf, double dt)
+{
+  TubeVector p(Interval(0.,tf), dt, TFunction("(2*cos(t) ; sin(2*t))"));
+  TubeVector v(Interval(0.,tf), dt, TFunction("(-2*sin(t) ; 2*cos(2*t))"));
+  p.inflate(0.05); v.inflate(0.02);
+  return make_pair(p, v);
+}
+
+int main(int argc, char *argv[])
+{
+  double dt = 0.01, tf = 40.;
+  float precision = 0.05;
+  pair<TubeVector,TubeVector> x = robot_tubes(tf, dt);
+
+  // Parallel computation
+
+  TPlane tplane_ref(x.first.tdomain());
+  chrono::steady_clock::time_point t0 = chrono::steady_clock::now();
+  tplane_ref.compute_detections(precision, x.first, x.second);
+  double t_ref = elapsed(t0);
+
+  cout << setw(10) << "threads" << setw(14) << "time (s)" << setw(10) << "speedup" << setw(10) << "loops" << endl;
+  cout << setw(10) << 1 << setw(14) << t_ref << setw(10) << 1. << setw(10) << tplane_ref.nb_loops_detections() << endl;
+
+  int max_threads = max(1, (int)thread::hardware_concurrency());
+
+  for(int nb_threads = 2 ; nb_threads <= max_threads ; nb_threads *= 2)
+  {
+    TPlane tplane(x.first.tdomain());
+    tplane.set_nb_threads(nb_threads);
+    t0 = chrono::steady_clock::now();
+    tplane.compute_detections(precision, x.first, x.second);
+    double t = elapsed(t0);
+
+    cout << setw(10) << nb_threads << setw(14) << t << setw(10) << t_ref / t
+         << setw(10) << tplane.nb_loops_detections() << endl;
+
+    if(tplane.detected_loops() != tplane_ref.detected_loops())
+    {
+      cout << "Error: the detections differ from the ones obtained with one thread" << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Online mission: the tubes are extended every 5 time units
+
+  // The subpavings differ (the bisections do not start from the same box),
+  // so the detections may slightly differ too
+
+  cout << endl << setw(10) << "tf" << setw(18) << "from scratch (s)" << setw(10) << "loops"
+       << setw(18) << "incremental (s)" << setw(10) << "loops" << endl;
+
+  TPlane tplane_inc(Interval(0.,5.));
+  for(double t = 5. ; t <= tf ; t += 5.)
+  {
+    pair<TubeVector,TubeVector> x_t = robot_tubes(t, dt);
+
+    TPlane tplane(x_t.first.tdomain());
+    t0 = chrono::steady_clock::now();
+    tplane.compute_detections(precision, x_t.first, x_t.second);
+    double t_scratch = elapsed(t0);
+
+    t0 = chrono::steady_clock::now();
+    tplane_inc.extend_detections(precision, x_t.first, x_t.second);
+    double t_inc = elapsed(t0);
+
+    cout << setw(10) << t << setw(18) << t_scratch << setw(10) << tplane.nb_loops_detections()
+         << setw(18) << t_inc << setw(10) << tplane_inc.nb_loops_detections() << endl;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,11 @@
+# ==================================================================
+#  Codac - build script
+# ==================================================================
+
+#!/bin/bash
+
+mkdir build -p
+cd build
+cmake ..
+make
+cd ..
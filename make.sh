@@ -71,5 +71,8 @@ fi
     cd lie_group
     find . * -maxdepth 0 | grep -P "^[0-9]" | xargs -L 1 bash -c 'cd "$0" && ./build.sh && cd ..'
     cd ..
+    cd benchmarks
+    ./build.sh
+    cd ..
     cd ..
   fi
\ No newline at end of file
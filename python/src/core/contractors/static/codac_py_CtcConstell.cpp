@@ -39,7 +39,7 @@ void export_CtcConstell(py::module& m, py::class_<Ctc, pyCtc>& ctc)
       CTCCONSTELL_CTCCONSTELL_VECTORINTERVALVECTOR,
       "map"_a.noconvert())
 
-    .def("contract", &CtcConstell::contract,
+    .def("contract", (void (CtcConstell::*)(IntervalVector&))&CtcConstell::contract,
       CTCCONSTELL_VOID_CONTRACT_INTERVALVECTOR,
       "beacon_box"_a.noconvert())
   ;
@@ -88,7 +88,7 @@ namespace codac2
       {
         if((*it).is_gate()) continue;
         if((*it).t0_tf().is_unbounded()) continue;
-        const shared_ptr<Slice<Interval>> su = static_pointer_cast<Slice<Interval>>((*it).tslice().slices().at(&u));
+        const shared_ptr<Slice<Interval>> su = static_pointer_cast<Slice<Interval>>((*it).tslice().slice_ptr(u));
         contract(*it, *su, TimePropag::FORWARD, compute_envelopes && !(t_propa & TimePropag::BACKWARD));
         // Envelopes are contracted in the bwd iteration if selected
       }
@@ -98,7 +98,7 @@ namespace codac2
       {
         if((*it).is_gate()) continue;
         if((*it).t0_tf().is_unbounded()) continue;
-        const shared_ptr<Slice<Interval>> su = static_pointer_cast<Slice<Interval>>((*it).tslice().slices().at(&u));
+        const shared_ptr<Slice<Interval>> su = static_pointer_cast<Slice<Interval>>((*it).tslice().slice_ptr(u));
         contract(*it, *su, TimePropag::BACKWARD, compute_envelopes);
       }
   }
@@ -141,20 +141,38 @@ namespace codac2
   void CtcLinobs::ctc_fwd_gate(ConvexPolygon& p_k, const ConvexPolygon& p_km1,
     double dt_km1_k, const Interval& u_km1)
   {
-    p_k &= exp_At(_A,dt_km1_k)*p_km1 + dt_km1_k*exp_At(_A,Interval(0.,dt_km1_k))*(u_km1*_b);
+    p_k &= cached_exp_At(_A,dt_km1_k)*p_km1 + dt_km1_k*cached_exp_At(_A,Interval(0.,dt_km1_k))*(u_km1*_b);
     p_k.simplify(m_polygon_max_edges);
   }
 
   void CtcLinobs::ctc_bwd_gate(ConvexPolygon& p_k, const ConvexPolygon& p_kp1,
     double dt_k_kp1, const Interval& u_k)
   {
-    p_k &= exp_At(-_A,dt_k_kp1)*p_kp1 - dt_k_kp1*exp_At(-_A,Interval(0.,dt_k_kp1))*(u_k*_b);
+    p_k &= cached_exp_At(-_A,dt_k_kp1)*p_kp1 - dt_k_kp1*cached_exp_At(-_A,Interval(0.,dt_k_kp1))*(u_k*_b);
     p_k.simplify(m_polygon_max_edges);
   }
 
   ConvexPolygon CtcLinobs::polygon_envelope(const ConvexPolygon& p_k,
     double dt_k_kp1, const Interval& u_k)
   {
-    return exp_At(_A,Interval(0.,dt_k_kp1))*p_k + Interval(0.,dt_k_kp1)*exp_At(_A,Interval(0.,dt_k_kp1))*(u_k*_b);
+    const IntervalMatrix A_exp = cached_exp_At(_A,Interval(0.,dt_k_kp1));
+    return A_exp*p_k + Interval(0.,dt_k_kp1)*A_exp*(u_k*_b);
+  }
+
+  IntervalMatrix CtcLinobs::cached_exp_At(const Matrix& A, const Interval& t)
+  {
+    assert(A.nb_rows() == 2 && A.nb_cols() == 2);
+    const array<double,6> key = {{ A[0][0], A[0][1], A[1][0], A[1][1], t.lb(), t.ub() }};
+
+    map<array<double,6>,IntervalMatrix>::const_iterator it = m_exp_At_cache.find(key);
+    if(it != m_exp_At_cache.end())
+      return it->second;
+
+    if(m_exp_At_cache.size() >= m_exp_At_cache_max_size)
+      m_exp_At_cache.clear();
+
+    const IntervalMatrix A_exp = exp_At(A,t);
+    m_exp_At_cache.emplace(key, A_exp);
+    return A_exp;
   }
 }
\ No newline at end of file
@@ -33,18 +33,23 @@ namespace codac2
     return *_it_tslice;
   }
 
+  size_t AbstractSlice::row() const
+  {
+    return _it_tslice->row();
+  }
+
   const std::shared_ptr<AbstractSlice> AbstractSlice::prev_abstract_slice_ptr() const
   {
     if(&(*_tubevector.first_abstract_slice_ptr()) == this)
       return nullptr;
-    return prev(_it_tslice)->slices().at(&_tubevector);
+    return prev(_it_tslice)->slice_ptr(_tubevector);
   }
 
   const std::shared_ptr<AbstractSlice> AbstractSlice::next_abstract_slice_ptr() const
   {
     if(&(*_tubevector.last_abstract_slice_ptr()) == this)
       return nullptr;
-    return next(_it_tslice)->slices().at(&_tubevector);
+    return next(_it_tslice)->slice_ptr(_tubevector);
   }
 
 } // namespace codac
\ No newline at end of file
@@ -45,6 +45,8 @@ namespace codac2
 
 
     protected:
+
+      size_t row() const; // row of the codomain in the column of the tube
         
       const AbstractSlicedTube& _tubevector;
       std::list<TSlice>::iterator _it_tslice;
@@ -16,11 +16,22 @@ using namespace std;
 namespace codac2
 {
   AbstractSlicedTube::AbstractSlicedTube(const shared_ptr<TDomain>& tdomain) :
-    _tdomain(tdomain)
+    _tdomain(tdomain), _column(tdomain->register_tube(this))
   {
 
   }
 
+  AbstractSlicedTube::AbstractSlicedTube(const AbstractSlicedTube& x) :
+    AbstractSlicedTube(x._tdomain)
+  {
+
+  }
+
+  AbstractSlicedTube::~AbstractSlicedTube()
+  {
+    _tdomain->unregister_tube(_column);
+  }
+
   shared_ptr<TDomain>& AbstractSlicedTube::tdomain()
   {
     return const_cast<shared_ptr<TDomain>&>(
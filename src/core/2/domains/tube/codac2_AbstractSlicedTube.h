@@ -23,6 +23,9 @@ namespace codac2
     public:
 
       AbstractSlicedTube(const std::shared_ptr<TDomain>& tdomain);
+      AbstractSlicedTube(const AbstractSlicedTube& x); // registers a new column
+      AbstractSlicedTube& operator=(const AbstractSlicedTube& x) = delete; // the column is bound to the tdomain
+      virtual ~AbstractSlicedTube();
 
       virtual const std::shared_ptr<AbstractSlice>& first_abstract_slice_ptr() const = 0;
       virtual const std::shared_ptr<AbstractSlice>& last_abstract_slice_ptr() const = 0;
@@ -34,7 +37,16 @@ namespace codac2
 
     protected:
 
+      // Called by the TDomain when tslices are inserted or removed,
+      // to update the rows of the codomains of the tube
+      virtual void insert_row(size_t row, size_t copied_row) = 0;
+      virtual void remove_rows(const std::vector<bool>& removed) = 0;
+
       std::shared_ptr<TDomain> _tdomain;
+      size_t _column; // dense index of this tube in the slices table of its TDomain
+
+      friend class TDomain;
+      friend class TSlice;
   };
 } // namespace codac
 
@@ -20,6 +20,7 @@
 #include "codac_TrajectoryVector.h"
 #include "codac_Exception.h"
 #include "codac2_AbstractSlice.h"
+#include "codac2_TubeColumn.h"
 #include "codac_BoolInterval.h"
 #include "codac_ConvexPolygon.h"
 #include "codac_DynCtc.h"
@@ -35,31 +36,22 @@ namespace codac2
   class AbstractSlicedTube;
   class TSlice;
 
+  // The codomain of a slice is stored in the column of its tube,
+  // at the row of its tslice
+
   template<class T>
   class Slice : public AbstractSlice
   {
     public:
 
-      explicit Slice(size_t n, const AbstractSlicedTube& tube_vector, const std::list<TSlice>::iterator& it_tslice) :
-        Slice(T(n), tube_vector, it_tslice)
-      {
-
-      }
-
-      explicit Slice(const T& codomain, const AbstractSlicedTube& tube_vector, const std::list<TSlice>::iterator& it_tslice) :
-        AbstractSlice(tube_vector,it_tslice), _codomain(codomain)
+      explicit Slice(const AbstractSlicedTube& tube_vector, TubeColumn<T>& codomains, const std::list<TSlice>::iterator& it_tslice) :
+        AbstractSlice(tube_vector,it_tslice), _codomains(codomains)
       {
 
       }
 
       Slice(const Slice& s) :
-        Slice(s, s._tubevector)
-      {
-        
-      }
-
-      Slice(const Slice& s, const AbstractSlicedTube& tubevector) :
-        AbstractSlice(tubevector, s._it_tslice), _codomain(s._codomain)
+        AbstractSlice(s._tubevector, s._it_tslice), _codomains(s._codomains)
       {
         
       }
@@ -90,6 +82,8 @@ namespace codac2
         // todo: define size() method in Interval class
         if constexpr(std::is_same<T,Interval>::value)
           return 1;
+        else if constexpr(std::is_same<T,codac::IntervalVector>::value)
+          return _codomains.size();
         else
           return codomain().size();
       }
@@ -110,7 +104,7 @@ namespace codac2
       bool is_empty() const
       {
         if(is_gate())
-          return _codomain.is_empty();
+          return codomain().is_empty();
         else
           return input_gate().is_empty() || output_gate().is_empty();
       }
@@ -137,13 +131,14 @@ namespace codac2
           if(!t0_tf().is_subset(x.tdomain()))
             is_contained = BoolInterval::MAYBE;
 
+          const T codomain = this->codomain();
           Interval t_ = t0_tf() & x.tdomain();
           T traj_tdomain(x(t_));
           // Using x(Interval(double)) for reliable evaluation:
           T traj_input(x(Interval(t_.lb())));
           T traj_output(x(Interval(t_.ub())));
 
-          if(_codomain.intersects(traj_tdomain) == BoolInterval::NO
+          if(codomain.intersects(traj_tdomain) == BoolInterval::NO
           || input_gate().intersects(traj_input) == BoolInterval::NO
           || output_gate().intersects(traj_output) == BoolInterval::NO)
             return BoolInterval::NO;
@@ -153,7 +148,7 @@ namespace codac2
             if(!traj_input.is_subset(input_gate()) || !traj_output.is_subset(output_gate()))
               return BoolInterval::MAYBE;
 
-            else if(traj_tdomain.is_subset(_codomain))
+            else if(traj_tdomain.is_subset(codomain))
               return is_contained;
 
             else // too much pessimism for the trajectory evaluation on t0_tf()
@@ -170,12 +165,12 @@ namespace codac2
 
                 T thinner_eval(x(t));
 
-                if(!_codomain.intersects(thinner_eval))
+                if(!codomain.intersects(thinner_eval))
                 {
                   return BoolInterval::NO;
                 }
 
-                else if(!thinner_eval.is_subset(_codomain))
+                else if(!thinner_eval.is_subset(codomain))
                 {
                   if(t.diam() < EPSILON_CONTAINS)
                     return BoolInterval::MAYBE;
@@ -213,9 +208,9 @@ namespace codac2
           static_cast<const Slice&>(*this).next_slice_ptr());
       }
 
-      const T& codomain() const
+      T codomain() const
       {
-        return _codomain;
+        return _codomains.get(row());
       }
 
       T input_gate() const
@@ -249,40 +244,53 @@ namespace codac2
       void set(const T& x, bool propagate = true)
       {
         if constexpr(!std::is_same<T,Interval>::value) { // 'if' to be removed with virtual set classes
-          assert((size_t)codomain().size() == size());
+          assert((size_t)x.size() == size());
         }
 
-        _codomain = x;
+        T codomain = x;
+        const std::shared_ptr<Slice<T>> prev = prev_slice_ptr(), next = next_slice_ptr();
 
-        if(prev_slice_ptr())
+        if(prev)
         {
           if constexpr(!std::is_same<T,Interval>::value) { // 'if' to be removed with virtual set classes
-            assert((size_t)prev_slice_ptr()->codomain().size() == size());
+            assert((size_t)prev->size() == size());
           }
           if(is_gate())
-            _codomain &= prev_slice_ptr()->codomain();
-          else if(prev_slice_ptr()->is_gate())
-            prev_slice_ptr()->_codomain &= _codomain;
+            codomain &= prev->codomain();
+          else if(prev->is_gate())
+          {
+            T prev_codomain = prev->codomain();
+            prev_codomain &= codomain;
+            prev->set_codomain(prev_codomain);
+          }
         }
 
-        if(next_slice_ptr())
+        if(next)
         {
           if constexpr(!std::is_same<T,Interval>::value) { // 'if' to be removed with virtual set classes
-            assert((size_t)next_slice_ptr()->codomain().size() == size());
+            assert((size_t)next->size() == size());
           }
           if(is_gate())
-            _codomain &= next_slice_ptr()->codomain();
-          else if(next_slice_ptr()->is_gate())
-            next_slice_ptr()->_codomain &= _codomain;
+            codomain &= next->codomain();
+          else if(next->is_gate())
+          {
+            T next_codomain = next->codomain();
+            next_codomain &= codomain;
+            next->set_codomain(next_codomain);
+          }
         }
 
+        set_codomain(codomain);
+
         if(propagate && is_empty())
           set_empty(true, codac::TimePropag::FORWARD | codac::TimePropag::BACKWARD);
       }
 
       void set_empty(bool propagate = true, codac::TimePropag t_propa = codac::TimePropag::FORWARD | codac::TimePropag::BACKWARD)
       {
-        _codomain.set_empty();
+        T empty = codomain();
+        empty.set_empty();
+        set_codomain(empty);
 
         if(propagate)
         {
@@ -304,44 +312,47 @@ namespace codac2
       void set_unbounded()
       {
         if constexpr(std::is_same<T,codac::IntervalVector>::value)
-          _codomain = T(size());
+          set_codomain(T(size()));
         else
-          _codomain = T();
+          set_codomain(T());
         
         //if constexpr(std::is_same<T,Interval>::value || std::is_same<T,codac::ConvexPolygon>::value) // 'if' to be removed with virtual set classes
-        //  _codomain = T();
+        //  set_codomain(T());
         //else
-        //  _codomain = T(size());
+        //  set_codomain(T(size()));
       }
 
       void set_component(size_t i, const Interval& xi)
       {
-        assert((size_t)codomain().size() == size());
-        _codomain[i] = xi;
+        assert(i < size());
+        Interval codomain_i = xi;
         if(is_gate())
         {
           if(prev_slice_ptr())
-            _codomain[i] &= prev_slice_ptr()->codomain()[i];
+            codomain_i &= prev_slice_ptr()->_codomains.get_component(prev_slice_ptr()->row(), i);
           if(next_slice_ptr())
-            _codomain[i] &= next_slice_ptr()->codomain()[i];
+            codomain_i &= next_slice_ptr()->_codomains.get_component(next_slice_ptr()->row(), i);
         }
+        _codomains.set_component(row(), i, codomain_i);
       }
 
       const Slice<T>& inflate(double rad)
       {
         assert(rad >= 0. && "cannot inflate negative value");
-        _codomain.inflate(rad);
+        T codomain = this->codomain();
+        codomain.inflate(rad);
+        set_codomain(codomain);
         return *this;
       }
 
       bool operator==(const Slice& x) const
       {
-        return _codomain == x._codomain;
+        return codomain() == x.codomain();
       }
 
       bool operator!=(const Slice& x) const
       {
-        return _codomain != x._codomain;
+        return codomain() != x.codomain();
       }
 
       friend std::ostream& operator<<(std::ostream& os, const Slice& x)
@@ -355,7 +366,12 @@ namespace codac2
 
     protected:
 
-      T _codomain;
+      void set_codomain(const T& x)
+      {
+        _codomains.set(row(), x);
+      }
+
+      TubeColumn<T>& _codomains;
   };
 
 } // namespace codac
@@ -10,6 +10,7 @@
  */
 
 #include <cassert>
+#include <algorithm>
 #include "codac2_TSlice.h"
 #include "codac2_TDomain.h"
 #include "codac2_Slice.h"
@@ -44,6 +45,8 @@ namespace codac2
 
     if(with_gates)
       _tslices.push_back(TSlice(Interval(t0_tf.ub())));
+
+    update_rows(_tslices.begin());
   }
 
   const Interval TDomain::t0_tf() const
@@ -59,7 +62,31 @@ namespace codac2
 
   size_t TDomain::nb_tubes() const
   {
-    return _tslices.front().slices().size();
+    return _tubes.size() - std::count(_tubes.begin(), _tubes.end(), nullptr);
+  }
+
+  size_t TDomain::register_tube(AbstractSlicedTube* x)
+  {
+    // Columns of destroyed tubes are reused first
+    vector<AbstractSlicedTube*>::iterator it = std::find(_tubes.begin(), _tubes.end(), nullptr);
+    if(it != _tubes.end())
+    {
+      *it = x;
+      return it - _tubes.begin();
+    }
+
+    _tubes.push_back(x);
+    for(auto& ts : _tslices)
+      ts._slices.resize(_tubes.size());
+    return _tubes.size() - 1;
+  }
+
+  void TDomain::unregister_tube(size_t column)
+  {
+    assert(column < _tubes.size());
+    for(auto& ts : _tslices)
+      ts._slices[column] = nullptr;
+    _tubes[column] = nullptr;
   }
 
   bool TDomain::all_gates_defined() const
@@ -122,13 +149,10 @@ namespace codac2
       if(it->is_gate() && it->t0_tf().lb() == t)
         return it;
 
-      TSlice ts(*it, Interval(t, t0_tf().lb())); // duplicate with different tdomain
-      it = _tslices.insert(it, ts);
-      for(auto& [k,s] : it->_slices)
-      {
-        s->_it_tslice = it;
-        s->set_unbounded(); // reinitialization
-      }
+      it = insert_tslice(it, it, Interval(t, t0_tf().lb())); // duplicate with different tdomain
+      for(auto& s : it->_slices)
+        if(s)
+          s->set_unbounded(); // reinitialization
 
       if(with_gates)
       {
@@ -143,14 +167,10 @@ namespace codac2
 
     else if(t > t0_tf().ub()) // if outside the already defined tdomain
     {
-      it = _tslices.end();
-      TSlice ts(*std::prev(it), Interval(t0_tf().ub(),t)); // duplicate with different tdomain
-      it = _tslices.insert(it, ts);
-      for(auto& [k,s] : it->_slices)
-      {
-        s->_it_tslice = it;
-        s->set_unbounded(); // reinitialization
-      }
+      it = insert_tslice(_tslices.end(), std::prev(_tslices.end()), Interval(t0_tf().ub(),t)); // duplicate with different tdomain
+      for(auto& s : it->_slices)
+        if(s)
+          s->set_unbounded(); // reinitialization
 
       if(with_gates)
         return sample(t, true); // recursive
@@ -173,14 +193,8 @@ namespace codac2
       it->set_tdomain(Interval(tdomain_it.lb(), t));
       bool new_gate_added = it->t0_tf().is_degenerated();
       list<TSlice>::iterator it_gate = it;
-      TSlice ts(*it, Interval(t, tdomain_it.ub())); // duplicate with different tdomain
-      // (*it) is the TSlice to copy
-
-      // From C++ insert() doc: the container is extended by inserting new elements before the element at the specified position
-      ++it; // we will insert the new tslice before the next TSlice [t.ub(),..]
-      it = _tslices.insert(it, ts); // then, it points to the newly inserted element
-      for(auto& [k,s] : it->_slices) // adding the new iterator pointer to the new slices
-        s->_it_tslice = it;
+      // (*it) is the TSlice to copy: the new tslice is inserted before the next TSlice [t.ub(),..]
+      it = insert_tslice(std::next(it), it, Interval(t, tdomain_it.ub())); // duplicate with different tdomain
       
       // In case the sampling includes the creation of a gate, the method is called again at same t
       if(new_gate_added)
@@ -213,15 +227,49 @@ namespace codac2
 
   void TDomain::delete_gates()
   {
+    vector<bool> removed(_tslices.size(), false);
     list<TSlice>::iterator it = _tslices.begin();
     while(it != _tslices.end())
     {
       if(it->t0_tf().is_degenerated())
+      {
+        removed[it->_row] = true;
         _tslices.erase(it++);
+      }
 
       else
         ++it;
     }
+
+    for(auto& x : _tubes)
+      if(x)
+        x->remove_rows(removed);
+    update_rows(_tslices.begin());
+  }
+
+  list<TSlice>::iterator TDomain::insert_tslice(const list<TSlice>::iterator& pos,
+    const list<TSlice>::iterator& copied, const Interval& tdomain)
+  {
+    size_t row = (pos == _tslices.end()) ? _tslices.size() : pos->_row;
+    for(auto& x : _tubes)
+      if(x)
+        x->insert_row(row, copied->_row);
+
+    // From C++ insert() doc: the container is extended by inserting new elements before the element at the specified position
+    list<TSlice>::iterator it = _tslices.insert(pos, TSlice(*copied, tdomain));
+    for(auto& s : it->_slices) // adding the new iterator pointer to the new slices
+      if(s)
+        s->_it_tslice = it;
+
+    update_rows(it);
+    return it;
+  }
+
+  void TDomain::update_rows(list<TSlice>::iterator it)
+  {
+    size_t row = (it == _tslices.begin()) ? 0 : std::prev(it)->_row + 1;
+    for( ; it != _tslices.end() ; ++it)
+      it->_row = row++;
   }
 
   ostream& operator<<(ostream& os, const TDomain& x)
@@ -24,6 +24,7 @@ namespace codac2
 {
   using codac::Interval;
   class TSlice;
+  class AbstractSlicedTube;
 
   class TDomain
   {
@@ -43,11 +44,23 @@ namespace codac2
       std::list<TSlice>& tslices();
       void delete_gates();
       static bool are_same(const std::shared_ptr<TDomain>& tdom1, const std::shared_ptr<TDomain>& tdom2);
+      size_t register_tube(AbstractSlicedTube* x); // returns the column of x in the slices table
+      void unregister_tube(size_t column);
 
 
     protected:
+
+      // Inserts before pos a tslice duplicating the slices of copied,
+      // and a row copying its codomains in each tube
+      std::list<TSlice>::iterator insert_tslice(const std::list<TSlice>::iterator& pos,
+        const std::list<TSlice>::iterator& copied, const Interval& tdomain);
+      void update_rows(std::list<TSlice>::iterator it); // from it to the end
       
       std::list<TSlice> _tslices;
+      // Tubes indexed by their column (nullptr for free columns). The column
+      // indexes the slices of a TSlice, while the codomains of a tube are
+      // stored in its own buffer, indexed by the rows of the tslices.
+      std::vector<AbstractSlicedTube*> _tubes;
 
       template<typename U>
       friend class Tube;
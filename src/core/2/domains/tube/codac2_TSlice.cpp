@@ -9,6 +9,7 @@
  *              the GNU Lesser General Public License (LGPL).
  */
 
+#include <cassert>
 #include "codac2_TSlice.h"
 #include "codac2_Slice.h"
 
@@ -17,8 +18,7 @@ using namespace codac;
 
 namespace codac2
 {
-  TSlice::TSlice(const Interval& tdomain) :
-    _slices(map<const AbstractSlicedTube*,shared_ptr<AbstractSlice>>())
+  TSlice::TSlice(const Interval& tdomain)
   {
     set_tdomain(tdomain);
   }
@@ -26,9 +26,10 @@ namespace codac2
   TSlice::TSlice(const TSlice& tslice, const Interval& tdomain) :
     TSlice(tdomain)
   {
-    for(const auto&[k,s] : tslice._slices)
-      _slices.insert(pair<const AbstractSlicedTube*,shared_ptr<AbstractSlice>>(
-        k, s->duplicate()));
+    _slices.resize(tslice._slices.size());
+    for(size_t i = 0 ; i < _slices.size() ; i++)
+      if(tslice._slices[i])
+        _slices[i] = tslice._slices[i]->duplicate();
   }
 
   const Interval& TSlice::t0_tf() const
@@ -40,6 +41,11 @@ namespace codac2
   {
     return _t0_tf.is_degenerated();
   }
+
+  size_t TSlice::row() const
+  {
+    return _row;
+  }
   
   void TSlice::set_tdomain(const Interval& tdomain)
   {
@@ -47,11 +53,17 @@ namespace codac2
     _t0_tf = tdomain;
   }
 
-  const map<const AbstractSlicedTube*,shared_ptr<AbstractSlice>>& TSlice::slices() const
+  const vector<shared_ptr<AbstractSlice>>& TSlice::slices() const
   {
     return _slices;
   }
 
+  const shared_ptr<AbstractSlice>& TSlice::slice_ptr(const AbstractSlicedTube& x) const
+  {
+    assert(x._column < _slices.size() && _slices[x._column]);
+    return _slices[x._column];
+  }
+
   bool TSlice::operator==(const TSlice& x) const
   {
     return _t0_tf == x._t0_tf;
@@ -33,10 +33,12 @@ namespace codac2
     public:
 
       explicit TSlice(const Interval& tdomain);
-      TSlice(const TSlice& tslice, const Interval& tdomain); // performs a deep copy on slices
+      TSlice(const TSlice& tslice, const Interval& tdomain); // duplicates the slices, the codomains are copied by the tubes
       const Interval& t0_tf() const;
       bool is_gate() const;
-      const std::map<const AbstractSlicedTube*,std::shared_ptr<AbstractSlice>>& slices() const;
+      size_t row() const; // row of the codomains of this tslice in the columns of the tubes
+      const std::vector<std::shared_ptr<AbstractSlice>>& slices() const;
+      const std::shared_ptr<AbstractSlice>& slice_ptr(const AbstractSlicedTube& x) const;
       bool operator==(const TSlice& x) const;
       bool operator!=(const TSlice& x) const;
       friend std::ostream& operator<<(std::ostream& os, const TSlice& x);
@@ -46,7 +48,8 @@ namespace codac2
       void set_tdomain(const Interval& tdomain);
       
       Interval _t0_tf;
-      std::map<const AbstractSlicedTube*,std::shared_ptr<AbstractSlice>> _slices;
+      size_t _row = 0; // position of the tslice in its TDomain
+      std::vector<std::shared_ptr<AbstractSlice>> _slices; // indexed by the columns of the tubes (nullptr if unused)
 
       friend class TDomain;
       template<typename U>
@@ -21,6 +21,7 @@
 #include "codac2_AbstractSlicedTube.h"
 #include "codac2_AbstractConstTube.h"
 #include "codac2_TDomain.h"
+#include "codac2_TubeColumn.h"
 #include "codac_ConvexPolygon.h"
 
 namespace codac2
@@ -69,32 +70,15 @@ namespace codac2
       }
 
       explicit Tube(const std::shared_ptr<TDomain>& tdomain, const T& default_value) :
-        AbstractSlicedTube(tdomain)
+        AbstractSlicedTube(tdomain), _codomains(tdomain->nb_tslices(), default_value)
       {
-        for(std::list<TSlice>::iterator it = _tdomain->_tslices.begin();
-          it != _tdomain->_tslices.end(); ++it)
-        {
-          it->_slices.insert(
-            std::pair<const AbstractSlicedTube*,std::shared_ptr<Slice<T>>>(this,
-              std::make_shared<Slice<T>>(default_value, *this, it)));
-        }
+        create_slices();
       }
 
       Tube(const Tube<T>& x) :
-        AbstractSlicedTube(x.tdomain())
-      {
-        for(std::list<TSlice>::iterator it = _tdomain->_tslices.begin();
-          it != _tdomain->_tslices.end(); ++it)
-        {
-          std::shared_ptr<Slice<T>> s_ptr = std::make_shared<Slice<T>>(x(it), *this);
-          it->_slices.insert(std::pair<const AbstractSlicedTube*,std::shared_ptr<Slice<T>>>(this, s_ptr));
-        }
-      }
-
-      ~Tube()
+        AbstractSlicedTube(x), _codomains(x._codomains)
       {
-        for(auto& s : _tdomain->_tslices)
-          s._slices.erase(this);
+        create_slices();
       }
 
       Tube& operator=(const Tube& x)
@@ -130,20 +114,26 @@ namespace codac2
 
       double volume() const
       {
-        double volume = 0.;
-        for(const auto& s : *this)
-          volume += s.volume();
-        return volume;
+        if constexpr(std::is_same<T,Interval>::value)
+          return _codomains.volume();
+
+        else
+        {
+          double volume = 0.;
+          for(const auto& s : *this)
+            volume += s.volume();
+          return volume;
+        }
       }
 
       virtual const std::shared_ptr<AbstractSlice>& first_abstract_slice_ptr() const
       {
-        return _tdomain->tslices().front().slices().at(this);
+        return _tdomain->tslices().front().slice_ptr(*this);
       }
 
       virtual const std::shared_ptr<AbstractSlice>& last_abstract_slice_ptr() const
       {
-        return _tdomain->tslices().back().slices().at(this);
+        return _tdomain->tslices().back().slice_ptr(*this);
       }
 
       const std::shared_ptr<Slice<T>> first_slice_ptr() const
@@ -193,10 +183,16 @@ namespace codac2
 
       bool is_unbounded() const
       {
-        for(const auto& s : *this)
-          if(s.is_unbounded())
-            return true;
-        return false;
+        if constexpr(std::is_same<T,Interval>::value || std::is_same<T,codac::IntervalVector>::value)
+          return _codomains.is_unbounded();
+
+        else
+        {
+          for(const auto& s : *this)
+            if(s.is_unbounded())
+              return true;
+          return false;
+        }
       }
 
       BoolInterval contains(const TrajectoryVector& x) const
@@ -217,17 +213,13 @@ namespace codac2
 
       T codomain() const
       {
-        T codomain = first_slice().codomain();
-        codomain.set_empty();
-        for(const auto& s : *this)
-          codomain |= s.codomain();
-        return codomain;
+        return _codomains.hull();
       }
       
       // Remove this? (direct access with () )
       std::shared_ptr<Slice<T>> slice_ptr(const std::list<TSlice>::iterator& it)
       {
-        return std::static_pointer_cast<Slice<T>>(it->slices().at(this));
+        return std::static_pointer_cast<Slice<T>>(it->_slices[_column]);
       }
       
       Slice<T>& operator()(const std::list<TSlice>::iterator& it)
@@ -238,7 +230,7 @@ namespace codac2
       
       const Slice<T>& operator()(const std::list<TSlice>::iterator& it) const
       {
-        return *std::static_pointer_cast<Slice<T>>(it->slices().at(this));
+        return *std::static_pointer_cast<Slice<T>>(it->_slices[_column]);
       }
       
       TubeEvaluation<T> operator()(double t)
@@ -272,9 +264,9 @@ namespace codac2
         }
         std::list<TSlice>::iterator  it_t = _tdomain->iterator_tslice(t);
         assert(it_t != _tdomain->_tslices.end());
-        T x = std::static_pointer_cast<Slice<T>>(it_t->_slices.at(this))->codomain();
+        T x = _codomains.get(it_t->row());
         if(!it_t->is_gate() && t==it_t->t0_tf().lb() && it_t!=_tdomain->_tslices.begin())
-          x &= std::static_pointer_cast<Slice<T>>((--it_t)->_slices.at(this))->codomain();
+          x &= _codomains.get(it_t->row()-1);
         return x;
       }
       
@@ -292,12 +284,12 @@ namespace codac2
           return eval(t.lb());
 
         std::list<TSlice>::iterator it = _tdomain->iterator_tslice(t.lb());
-        T codomain = std::static_pointer_cast<Slice<T>>(it->_slices.at(this))->codomain();
+        T codomain = _codomains.get(it->row());
 
         while(it != std::next(_tdomain->iterator_tslice(t.ub())))
         {
           if(it->t0_tf().lb() == t.ub()) break;
-          codomain |= std::static_pointer_cast<Slice<T>>(it->_slices.at(this))->codomain();
+          codomain |= _codomains.get(it->row());
           it++;
         }
 
@@ -328,12 +320,19 @@ namespace codac2
 
       const Tube<T>& inflate(double rad)
       {
-        for(auto& s : *this)
-          if(!s.is_gate())
-            s.inflate(rad);
-        for(auto& s : *this)
-          if(s.is_gate())
-            s.inflate(rad);
+        assert(rad >= 0. && "cannot inflate negative value");
+        if constexpr(std::is_same<T,Interval>::value || std::is_same<T,codac::IntervalVector>::value)
+          _codomains.inflate(rad); // inflations of slices are independent
+
+        else
+        {
+          for(auto& s : *this)
+            if(!s.is_gate())
+              s.inflate(rad);
+          for(auto& s : *this)
+            if(s.is_gate())
+              s.inflate(rad);
+        }
         return *this;
       }
 
@@ -348,34 +347,20 @@ namespace codac2
         if(!TDomain::are_same(tdomain(), x.tdomain()))
           return false;
 
-        std::list<TSlice>::iterator it_this = _tdomain->_tslices.begin();
-        std::list<TSlice>::const_iterator it_x = x.tdomain()->tslices().cbegin();
-
-        while(it_this != _tdomain->tslices().end())
-        {
-          if(*std::static_pointer_cast<Slice<T>>(it_this->_slices.at(this)) != 
-            *std::static_pointer_cast<Slice<T>>(it_x->slices().at(&x)))
-            return false;
-          it_this++; it_x++;
-        }
-
-        return true;
+        // Same tslices: the rows of the columns match
+        return _codomains == x._codomains;
       }
 
       Tube operator&=(const Tube& x)
       {
         assert(TDomain::are_same(tdomain(), x.tdomain()));
-        std::list<TSlice>::iterator it_this = _tdomain->_tslices.begin();
-        std::list<TSlice>::const_iterator it_x = x.tdomain()->tslices().cbegin();
-
-        while(it_this != _tdomain->tslices().end())
+        for(auto it = _tdomain->_tslices.begin() ; it != _tdomain->_tslices.end() ; ++it)
         {
-          std::shared_ptr<Slice<T>> s = std::static_pointer_cast<Slice<T>>(it_this->_slices.at(this));
-          s->set(s->codomain() & std::static_pointer_cast<Slice<T>>(it_x->slices().at(&x))->codomain());
-          it_this++; it_x++;
+          // Same tslices: the rows of the columns match
+          Slice<T>& s = (*this)(it);
+          s.set(s.codomain() & x._codomains.get(it->row()));
         }
 
-        assert(it_x == x.tdomain()->tslices().cend());
         return *this;
       }
 
@@ -390,6 +375,30 @@ namespace codac2
       }
 
 
+    protected:
+
+      void create_slices()
+      {
+        for(std::list<TSlice>::iterator it = _tdomain->_tslices.begin();
+          it != _tdomain->_tslices.end(); ++it)
+        {
+          it->_slices[_column] = std::make_shared<Slice<T>>(*this, _codomains, it);
+        }
+      }
+
+      virtual void insert_row(size_t row, size_t copied_row)
+      {
+        _codomains.insert_row(row, copied_row);
+      }
+
+      virtual void remove_rows(const std::vector<bool>& removed)
+      {
+        _codomains.remove_rows(removed);
+      }
+
+      TubeColumn<T> _codomains; // codomains of the slices, indexed by the rows of the tslices
+
+
     public:
 
       using base_container = std::list<TSlice>;
@@ -410,7 +419,7 @@ namespace codac2
 
           reference operator*()
           {
-            return static_cast<reference>(*((*this)->_slices.at(&_x)));
+            return static_cast<reference>(*((*this)->_slices[_x._column]));
           }
 
         protected:
@@ -437,7 +446,7 @@ namespace codac2
 
           reference operator*()
           {
-            return static_cast<reference>(*((*this)->_slices.at(&_x)));
+            return static_cast<reference>(*((*this)->_slices[_x._column]));
           }
 
         protected:
@@ -464,7 +473,7 @@ namespace codac2
 
           reference operator*() const
           {
-            return static_cast<reference>(*((*this)->_slices.at(&_x)));
+            return static_cast<reference>(*((*this)->_slices[_x._column]));
           }
 
         protected:
@@ -0,0 +1,333 @@
+/** 
+ *  \file
+ *  
+ * ----------------------------------------------------------------------------
+ *  \date       2022
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2022 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __CODAC2_TUBECOLUMN_H__
+#define __CODAC2_TUBECOLUMN_H__
+
+#include <vector>
+#include <cassert>
+#include <algorithm>
+#include "codac_Interval.h"
+#include "codac_IntervalVector.h"
+#include "codac_predef_values.h"
+
+namespace codac2
+{
+  using codac::Interval;
+  using codac::IntervalVector;
+  using codac::oo;
+
+  class AbstractTubeColumn
+  {
+    protected:
+
+      // Compacts the rows of a buffer of n values per row
+      template<typename V>
+      static void remove_rows(std::vector<V>& v, const std::vector<bool>& removed, size_t n)
+      {
+        assert(v.size() == removed.size()*n);
+        size_t k = 0;
+        for(size_t row = 0 ; row < removed.size() ; row++)
+          if(!removed[row])
+          {
+            for(size_t i = 0 ; i < n ; i++)
+              v[k*n+i] = v[row*n+i];
+            k++;
+          }
+        v.resize(k*n);
+      }
+  };
+
+  // Codomains of the slices of a tube, stored contiguously in the order of the
+  // tslices of its TDomain: the codomain of the slice of a TSlice is at the row
+  // TSlice::row() of the column. Scans of a tube are linear over this buffer.
+
+  template<class T>
+  class TubeColumn : public AbstractTubeColumn
+  {
+    public:
+
+      TubeColumn(size_t nb_rows, const T& x) :
+        _codomains(nb_rows, x)
+      { }
+
+      size_t nb_rows() const
+      {
+        return _codomains.size();
+      }
+
+      T get(size_t row) const
+      {
+        return _codomains[row];
+      }
+
+      void set(size_t row, const T& x)
+      {
+        _codomains[row] = x;
+      }
+
+      void insert_row(size_t row, size_t copied_row)
+      {
+        T x = _codomains[copied_row];
+        _codomains.insert(_codomains.begin() + row, x);
+      }
+
+      void remove_rows(const std::vector<bool>& removed)
+      {
+        AbstractTubeColumn::remove_rows(_codomains, removed, 1);
+      }
+
+      bool operator==(const TubeColumn& x) const
+      {
+        return _codomains == x._codomains;
+      }
+
+      T hull() const
+      {
+        assert(!_codomains.empty());
+        T hull = _codomains[0];
+        for(size_t i = 1 ; i < _codomains.size() ; i++)
+          hull |= _codomains[i];
+        return hull;
+      }
+
+
+    protected:
+
+      std::vector<T> _codomains;
+  };
+
+  // Intervals are stored as two arrays of bounds. An empty interval is stored
+  // as [+oo,-oo], so that hulls and scans need not test emptiness.
+
+  template<>
+  class TubeColumn<Interval> : public AbstractTubeColumn
+  {
+    public:
+
+      TubeColumn(size_t nb_rows, const Interval& x) :
+        _lb(nb_rows, x.is_empty() ? oo : x.lb()),
+        _ub(nb_rows, x.is_empty() ? -oo : x.ub())
+      { }
+
+      size_t nb_rows() const
+      {
+        return _lb.size();
+      }
+
+      Interval get(size_t row) const
+      {
+        return Interval(_lb[row], _ub[row]); // empty if lb > ub
+      }
+
+      void set(size_t row, const Interval& x)
+      {
+        _lb[row] = x.is_empty() ? oo : x.lb();
+        _ub[row] = x.is_empty() ? -oo : x.ub();
+      }
+
+      void insert_row(size_t row, size_t copied_row)
+      {
+        double lb = _lb[copied_row], ub = _ub[copied_row];
+        _lb.insert(_lb.begin() + row, lb);
+        _ub.insert(_ub.begin() + row, ub);
+      }
+
+      void remove_rows(const std::vector<bool>& removed)
+      {
+        AbstractTubeColumn::remove_rows(_lb, removed, 1);
+        AbstractTubeColumn::remove_rows(_ub, removed, 1);
+      }
+
+      bool operator==(const TubeColumn& x) const
+      {
+        return _lb == x._lb && _ub == x._ub;
+      }
+
+      Interval hull() const
+      {
+        double lb = oo, ub = -oo;
+        for(size_t i = 0 ; i < _lb.size() ; i++)
+        {
+          lb = std::min(lb, _lb[i]);
+          ub = std::max(ub, _ub[i]);
+        }
+        return Interval(lb, ub);
+      }
+
+      double volume() const
+      {
+        double volume = 0.;
+        for(size_t i = 0 ; i < _lb.size() ; i++)
+          volume += std::max(0., _ub[i] - _lb[i]); // 0 for empty rows
+        return volume;
+      }
+
+      bool is_unbounded() const
+      {
+        bool unbounded = false;
+        for(size_t i = 0 ; i < _lb.size() ; i++)
+          unbounded |= (_lb[i] == -oo) | (_ub[i] == oo); // empty rows are [+oo,-oo]
+        return unbounded;
+      }
+
+      void inflate(double rad)
+      {
+        for(size_t i = 0 ; i < nb_rows() ; i++)
+          set(i, get(i).inflate(rad)); // outward rounding of the interval arithmetic
+      }
+
+
+    protected:
+
+      std::vector<double> _lb, _ub;
+  };
+
+  // Boxes are stored row by row, as two arrays of n bounds per row. As for
+  // IntervalVector, a box is empty if its first component is empty.
+
+  template<>
+  class TubeColumn<IntervalVector> : public AbstractTubeColumn
+  {
+    public:
+
+      TubeColumn(size_t nb_rows, const IntervalVector& x) :
+        _n(x.size()), _lb(nb_rows*_n), _ub(nb_rows*_n)
+      {
+        for(size_t row = 0 ; row < nb_rows ; row++)
+          set(row, x);
+      }
+
+      size_t nb_rows() const
+      {
+        return _lb.size() / _n;
+      }
+
+      size_t size() const
+      {
+        return _n;
+      }
+
+      IntervalVector get(size_t row) const
+      {
+        IntervalVector x(_n);
+        for(size_t i = 0 ; i < _n ; i++)
+          x[i] = Interval(_lb[row*_n+i], _ub[row*_n+i]);
+        return x;
+      }
+
+      Interval get_component(size_t row, size_t i) const
+      {
+        assert(i < _n);
+        return Interval(_lb[row*_n+i], _ub[row*_n+i]);
+      }
+
+      void set(size_t row, const IntervalVector& x)
+      {
+        assert((size_t)x.size() == _n);
+        for(size_t i = 0 ; i < _n ; i++)
+          set_component(row, i, x[i]);
+      }
+
+      void set_component(size_t row, size_t i, const Interval& xi)
+      {
+        assert(i < _n);
+        _lb[row*_n+i] = xi.is_empty() ? oo : xi.lb();
+        _ub[row*_n+i] = xi.is_empty() ? -oo : xi.ub();
+      }
+
+      void insert_row(size_t row, size_t copied_row)
+      {
+        std::vector<double> lb(_lb.begin() + copied_row*_n, _lb.begin() + (copied_row+1)*_n);
+        std::vector<double> ub(_ub.begin() + copied_row*_n, _ub.begin() + (copied_row+1)*_n);
+        _lb.insert(_lb.begin() + row*_n, lb.begin(), lb.end());
+        _ub.insert(_ub.begin() + row*_n, ub.begin(), ub.end());
+      }
+
+      void remove_rows(const std::vector<bool>& removed)
+      {
+        AbstractTubeColumn::remove_rows(_lb, removed, _n);
+        AbstractTubeColumn::remove_rows(_ub, removed, _n);
+      }
+
+      bool operator==(const TubeColumn& x) const
+      {
+        if(_n != x._n || nb_rows() != x.nb_rows())
+          return false;
+
+        for(size_t row = 0 ; row < nb_rows() ; row++)
+        {
+          if(is_empty(row) || x.is_empty(row))
+          {
+            if(is_empty(row) != x.is_empty(row))
+              return false;
+          }
+
+          else if(!std::equal(_lb.begin() + row*_n, _lb.begin() + (row+1)*_n, x._lb.begin() + row*_n)
+            || !std::equal(_ub.begin() + row*_n, _ub.begin() + (row+1)*_n, x._ub.begin() + row*_n))
+            return false;
+        }
+
+        return true;
+      }
+
+      IntervalVector hull() const
+      {
+        std::vector<double> lb(_n, oo), ub(_n, -oo);
+        for(size_t row = 0 ; row < nb_rows() ; row++)
+          if(!is_empty(row))
+            for(size_t i = 0 ; i < _n ; i++)
+            {
+              lb[i] = std::min(lb[i], _lb[row*_n+i]);
+              ub[i] = std::max(ub[i], _ub[row*_n+i]);
+            }
+
+        IntervalVector hull(_n);
+        for(size_t i = 0 ; i < _n ; i++)
+          hull[i] = Interval(lb[i], ub[i]);
+        return hull;
+      }
+
+      bool is_unbounded() const
+      {
+        for(size_t row = 0 ; row < nb_rows() ; row++)
+          if(!is_empty(row))
+          {
+            bool unbounded = false;
+            for(size_t i = 0 ; i < _n ; i++)
+              unbounded |= (_lb[row*_n+i] == -oo) | (_ub[row*_n+i] == oo); // empty components are [+oo,-oo]
+            if(unbounded)
+              return true;
+          }
+        return false;
+      }
+
+      void inflate(double rad)
+      {
+        for(size_t row = 0 ; row < nb_rows() ; row++)
+          set(row, get(row).inflate(rad)); // outward rounding of the interval arithmetic
+      }
+
+
+    protected:
+
+      bool is_empty(size_t row) const
+      {
+        return _lb[row*_n] > _ub[row*_n];
+      }
+
+      size_t _n;
+      std::vector<double> _lb, _ub;
+  };
+
+} // namespace codac
+
+#endif
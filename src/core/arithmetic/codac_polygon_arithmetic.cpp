@@ -9,6 +9,7 @@
  *              the GNU Lesser General Public License (LGPL).
  */
 
+#include <algorithm>
 #include "codac_polygon_arithmetic.h"
 
 using namespace std;
@@ -16,6 +17,147 @@ using namespace ibex;
 
 namespace codac
 {
+  namespace
+  {
+    // Sign of x: -1 or 1 when guaranteed, 0 if x is exactly 0, 2 if undetermined
+    int sign(const Interval& x)
+    {
+      if(x.lb() > 0.) return 1;
+      if(x.ub() < 0.) return -1;
+      if(x == Interval(0.)) return 0;
+      return 2;
+    }
+
+    // Sign of the cross product (b-a)x(c-a), evaluated with interval arithmetic
+    int orientation(const Vector& a, const Vector& b, const Vector& c)
+    {
+      return sign((Interval(b[0])-a[0])*(Interval(c[1])-a[1]) - (Interval(b[1])-a[1])*(Interval(c[0])-a[0]));
+    }
+
+    // Position of p w.r.t. a convex polygon: 1 if strictly inside, -1 if outside, 2 if undetermined
+    int position(const Vector& p, const vector<Vector>& v)
+    {
+      for(size_t i = 0 ; i < v.size() ; i++)
+      {
+        int s = orientation(v[i], v[(i+1)%v.size()], p);
+        if(s == -1) return -1;
+        if(s != 1) return 2;
+      }
+      return 1;
+    }
+
+    // Vertices of p in counterclockwise order, false if p is not guaranteed to be strictly convex
+    bool ccw_vertices(const ConvexPolygon& p, vector<Vector>& v)
+    {
+      v = p.vertices();
+      size_t n = v.size();
+      if(n < 3 || p.box().is_unbounded())
+        return false;
+
+      int s = orientation(v[n-1], v[0], v[1]);
+      if(s != 1 && s != -1)
+        return false;
+
+      for(size_t i = 1 ; i < n ; i++)
+        if(orientation(v[i-1], v[i], v[(i+1)%n]) != s)
+          return false;
+
+      if(s == -1)
+        reverse(v.begin(), v.end());
+      return true;
+    }
+
+    // Linear-time intersection of convex polygons, from O'Rourke et al. (1982),
+    // "A new linear algorithm for intersecting convex polygons".
+    // The combinatorial tests are evaluated with interval arithmetic: false is
+    // returned when one of them cannot be guaranteed (degenerate configurations),
+    // the quadratic method is then used instead.
+    bool convex_inter_thickpoints(const ConvexPolygon& p1, const ConvexPolygon& p2, vector<ThickPoint>& v_pts)
+    {
+      vector<Vector> P, Q;
+      if(!ccw_vertices(p1, P) || !ccw_vertices(p2, Q))
+        return false;
+
+      const size_t n = P.size(), m = Q.size();
+      size_t a = 0, b = 0; // current edges [P[a-1],P[a]] and [Q[b-1],Q[b]]
+      size_t aa = 0, ba = 0; // number of advances on each polygon
+      enum { UNKNOWN, P_INSIDE, Q_INSIDE } inflag = UNKNOWN;
+      bool first_pt = true;
+
+      do
+      {
+        const size_t a1 = (a+n-1) % n, b1 = (b+m-1) % m;
+
+        const int cross = sign((Interval(P[a][0])-P[a1][0])*(Interval(Q[b][1])-Q[b1][1])
+                             - (Interval(P[a][1])-P[a1][1])*(Interval(Q[b][0])-Q[b1][0]));
+        const int aHB = orientation(Q[b1], Q[b], P[a]), a1HB = orientation(Q[b1], Q[b], P[a1]);
+        const int bHA = orientation(P[a1], P[a], Q[b]), b1HA = orientation(P[a1], P[a], Q[b1]);
+
+        if(cross == 2
+          || (aHB != 1 && aHB != -1) || (a1HB != 1 && a1HB != -1)
+          || (bHA != 1 && bHA != -1) || (b1HA != 1 && b1HA != -1))
+          return false;
+
+        if(aHB != a1HB && bHA != b1HA) // the edges are crossing
+        {
+          const ThickPoint pt = ThickEdge(P[a1], P[a]) & ThickEdge(Q[b1], Q[b]);
+          if(pt.does_not_exist())
+            return false;
+
+          if(inflag == UNKNOWN && first_pt)
+          {
+            aa = ba = 0;
+            first_pt = false;
+          }
+
+          v_pts.push_back(pt);
+          inflag = aHB > 0 ? P_INSIDE : (bHA > 0 ? Q_INSIDE : inflag);
+        }
+
+        if(cross == 0 && aHB < 0 && bHA < 0) // separated by parallel edges
+        {
+          v_pts.clear();
+          return true;
+        }
+
+        if(cross >= 0 ? bHA > 0 : aHB <= 0) // advancing on P
+        {
+          if(inflag == P_INSIDE)
+            v_pts.push_back(ThickPoint(P[a]));
+          aa++; a = (a+1) % n;
+        }
+
+        else // advancing on Q
+        {
+          if(inflag == Q_INSIDE)
+            v_pts.push_back(ThickPoint(Q[b]));
+          ba++; b = (b+1) % m;
+        }
+
+      } while((aa < n || ba < m) && aa < 2*n && ba < 2*m);
+
+      if(first_pt) // no crossing edges: one polygon may be inside the other
+      {
+        v_pts.clear();
+
+        int pos = position(P[0], Q);
+        if(pos == 2) return false;
+        if(pos == 1)
+        {
+          v_pts = ThickPoint::to_ThickPoints(P);
+          return true;
+        }
+
+        pos = position(Q[0], P);
+        if(pos == 2) return false;
+        if(pos == 1)
+          v_pts = ThickPoint::to_ThickPoints(Q);
+      }
+
+      return true;
+    }
+  }
+
   const ConvexPolygon operator+(const ConvexPolygon& x)
   {
     return x;
@@ -121,6 +263,10 @@ namespace codac
 
   const ConvexPolygon operator&(const ConvexPolygon& p1, const ConvexPolygon& p2)
   {
+    vector<ThickPoint> v_pts;
+    if(convex_inter_thickpoints(p1, p2, v_pts))
+      return ConvexPolygon(v_pts);
+
     return ConvexPolygon(inter_thickpoints(p1,p2));
   }
 
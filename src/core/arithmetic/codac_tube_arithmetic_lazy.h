@@ -0,0 +1,877 @@
+/**
+ *  \file
+ *  Lazy arithmetic operations on tubes (expression templates)
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __CODAC_TUBE_ARITHMETIC_LAZY_H__
+#define __CODAC_TUBE_ARITHMETIC_LAZY_H__
+
+#include <vector>
+#include <utility>
+#include <type_traits>
+#include "codac_Interval.h"
+#include "codac_IntervalVector.h"
+#include "codac_Tube.h"
+#include "codac_TubeVector.h"
+#include "codac_Trajectory.h"
+#include "codac_TrajectoryVector.h"
+
+// Operations on expressions do not compute intermediate tubes: the
+// expression is evaluated in a single pass over the slices and gates of
+// the result, when it is converted into a Tube or a TubeVector, e.g.:
+//
+//   Tube z = sqrt(sqr(lazy(x)) + sqr(lazy(y))) * dt;
+//
+// The slice-wise computations are the same as those of the operators
+// of codac_tube_arithmetic.h, so that results are identical. Tubes of
+// different slicing are handled as these operators do: the result is
+// sampled on the union of the slicings, and each sub-expression is
+// evaluated on the slicing of its own tubes, as an intermediate tube.
+// Note that the tubes and trajectories of an expression are referenced,
+// not copied: they must not be destroyed before the evaluation.
+
+namespace codac
+{
+  /// \name Scalar expressions
+  /// @{
+
+  /**
+   * \class TubeExprBase
+   * \brief Common base of scalar tube expressions, for type detection
+   */
+  class TubeExprBase { };
+
+  /**
+   * \class TubeExpr
+   * \brief Lazy expression on tubes, evaluated slice by slice
+   *
+   * Any expression E provides a cursor on the slices of its tubes:
+   * - collect_tubes(v) lists the tubes involved in the expression,
+   * - first() sets the cursors on the first slices of the tubes,
+   * - move_to(t) moves the cursors to the slices containing the temporal domain t,
+   * - slice_tdomain() is the temporal domain of the current slice on the slicing
+   *   of the expression (all reals if no tube is involved),
+   * - codomain(t) evaluates the expression on its current slice, where t is
+   *   the temporal domain of the current slice of the enclosing expression,
+   * - gate(t) evaluates the expression at time t, or on its current slice
+   *   when t is not a gate of its slicing (as a sampled intermediate tube).
+   */
+  template<typename E>
+  class TubeExpr : public TubeExprBase
+  {
+    public:
+
+      /**
+       * \brief Returns the actual expression object
+       *
+       * \return a const reference to the expression
+       */
+      const E& derived() const
+      {
+        return static_cast<const E&>(*this);
+      }
+
+      /**
+       * \brief Evaluates the expression in an existing tube
+       *
+       * \note The slicing of y is replaced by the one of the expression
+       *
+       * \param y the tube to be set
+       */
+      void eval(Tube& y) const
+      {
+        const E& e = derived();
+        std::vector<const Tube*> v_tubes;
+        e.collect_tubes(v_tubes);
+        assert(!v_tubes.empty() && "an expression involves at least one tube");
+
+        for(const auto& x : v_tubes)
+          if(x == &y) // the output is involved in the expression
+          {
+            y = eval();
+            return;
+          }
+
+        // Common slicing of the tubes of the expression
+        y = *v_tubes[0];
+        for(size_t i = 1 ; i < v_tubes.size() ; i++)
+        {
+          assert(v_tubes[i]->tdomain() == y.tdomain());
+          if(!Tube::same_slicing(y, *v_tubes[i]))
+            y.sample(*v_tubes[i]);
+        }
+
+        e.first();
+        Slice *s_y = nullptr;
+        do
+        {
+          if(s_y == nullptr) // first iteration
+            s_y = y.first_slice();
+          else
+            s_y = s_y->next_slice();
+
+          e.move_to(s_y->tdomain());
+          s_y->set_envelope(e.codomain(s_y->tdomain()), false);
+          s_y->set_input_gate(e.gate(s_y->tdomain().lb()), false);
+
+        } while(s_y->next_slice());
+
+        s_y->set_output_gate(e.gate(s_y->tdomain().ub()), false);
+      }
+
+      /**
+       * \brief Evaluates the expression
+       *
+       * \return the resulting tube
+       */
+      const Tube eval() const
+      {
+        Tube y;
+        eval(y);
+        return y;
+      }
+
+      /**
+       * \brief Evaluates the expression, see eval()
+       */
+      operator Tube() const
+      {
+        return eval();
+      }
+  };
+
+  /**
+   * \class TubeRefExpr
+   * \brief Tube involved in an expression
+   */
+  class TubeRefExpr : public TubeExpr<TubeRefExpr>
+  {
+    public:
+
+      explicit TubeRefExpr(const Tube& x)
+        : m_x(x)
+      {
+
+      }
+
+      void collect_tubes(std::vector<const Tube*>& v_tubes) const
+      {
+        v_tubes.push_back(&m_x);
+      }
+
+      void first() const
+      {
+        m_s = m_x.first_slice();
+      }
+
+      void move_to(const Interval& t) const
+      {
+        // The slicing of the result is a refinement of the slicing of x
+        while(m_s->tdomain().ub() < t.ub())
+          m_s = m_s->next_slice();
+      }
+
+      const Interval slice_tdomain() const
+      {
+        return m_s->tdomain();
+      }
+
+      const Interval codomain(const Interval&) const
+      {
+        return m_s->codomain();
+      }
+
+      const Interval gate(double t) const
+      {
+        if(t == m_s->tdomain().lb())
+          return m_s->input_gate();
+
+        else if(t == m_s->tdomain().ub())
+          return m_s->output_gate();
+
+        else // gate created by a sampling of the slice
+          return m_s->codomain();
+      }
+
+    protected:
+
+      const Tube& m_x;
+      mutable const Slice *m_s = nullptr; //!< cursor on the slices of x
+  };
+
+  /**
+   * \class IntervalExpr
+   * \brief Constant interval involved in an expression
+   */
+  class IntervalExpr : public TubeExpr<IntervalExpr>
+  {
+    public:
+
+      explicit IntervalExpr(const Interval& x)
+        : m_x(x)
+      {
+
+      }
+
+      void collect_tubes(std::vector<const Tube*>&) const { }
+      void first() const { }
+      void move_to(const Interval&) const { }
+      const Interval slice_tdomain() const { return Interval::ALL_REALS; }
+
+      const Interval codomain(const Interval&) const
+      {
+        return m_x;
+      }
+
+      const Interval gate(double) const
+      {
+        return m_x;
+      }
+
+    protected:
+
+      const Interval m_x;
+  };
+
+  /**
+   * \class TrajectoryExpr
+   * \brief Trajectory involved in an expression
+   */
+  class TrajectoryExpr : public TubeExpr<TrajectoryExpr>
+  {
+    public:
+
+      explicit TrajectoryExpr(const Trajectory& x)
+        : m_x(x)
+      {
+
+      }
+
+      void collect_tubes(std::vector<const Tube*>&) const { }
+      void first() const { }
+      void move_to(const Interval&) const { }
+      const Interval slice_tdomain() const { return Interval::ALL_REALS; }
+
+      const Interval codomain(const Interval& t) const
+      {
+        return m_x(t);
+      }
+
+      const Interval gate(double t) const
+      {
+        return m_x(Interval(t));
+      }
+
+    protected:
+
+      const Trajectory& m_x;
+  };
+
+  /**
+   * \class UnaryTubeExpr
+   * \brief Unary operation F on an expression
+   */
+  template<typename F, typename E>
+  class UnaryTubeExpr : public TubeExpr<UnaryTubeExpr<F,E> >
+  {
+    public:
+
+      explicit UnaryTubeExpr(const E& x)
+        : m_x(x)
+      {
+
+      }
+
+      void collect_tubes(std::vector<const Tube*>& v_tubes) const { m_x.collect_tubes(v_tubes); }
+      void first() const { m_x.first(); }
+      void move_to(const Interval& t) const { m_x.move_to(t); }
+      const Interval slice_tdomain() const { return m_x.slice_tdomain(); }
+
+      const Interval codomain(const Interval&) const
+      {
+        return F::apply(m_x.codomain(slice_tdomain()));
+      }
+
+      const Interval gate(double t) const
+      {
+        return F::apply(m_x.gate(t));
+      }
+
+    protected:
+
+      const E m_x;
+  };
+
+  /**
+   * \class ParamTubeExpr
+   * \brief Unary operation F on an expression, with a parameter of type P
+   */
+  template<typename F, typename E, typename P>
+  class ParamTubeExpr : public TubeExpr<ParamTubeExpr<F,E,P> >
+  {
+    public:
+
+      explicit ParamTubeExpr(const E& x, const P& p)
+        : m_x(x), m_p(p)
+      {
+
+      }
+
+      void collect_tubes(std::vector<const Tube*>& v_tubes) const { m_x.collect_tubes(v_tubes); }
+      void first() const { m_x.first(); }
+      void move_to(const Interval& t) const { m_x.move_to(t); }
+      const Interval slice_tdomain() const { return m_x.slice_tdomain(); }
+
+      const Interval codomain(const Interval&) const
+      {
+        return F::apply(m_x.codomain(slice_tdomain()), m_p);
+      }
+
+      const Interval gate(double t) const
+      {
+        return F::apply(m_x.gate(t), m_p);
+      }
+
+    protected:
+
+      const E m_x;
+      const P m_p;
+  };
+
+  /**
+   * \class BinaryTubeExpr
+   * \brief Binary operation F on two expressions
+   */
+  template<typename F, typename E1, typename E2>
+  class BinaryTubeExpr : public TubeExpr<BinaryTubeExpr<F,E1,E2> >
+  {
+    public:
+
+      explicit BinaryTubeExpr(const E1& x1, const E2& x2)
+        : m_x1(x1), m_x2(x2)
+      {
+
+      }
+
+      void collect_tubes(std::vector<const Tube*>& v_tubes) const
+      {
+        m_x1.collect_tubes(v_tubes);
+        m_x2.collect_tubes(v_tubes);
+      }
+
+      void first() const
+      {
+        m_x1.first();
+        m_x2.first();
+      }
+
+      void move_to(const Interval& t) const
+      {
+        m_x1.move_to(t);
+        m_x2.move_to(t);
+      }
+
+      const Interval slice_tdomain() const
+      {
+        return m_x1.slice_tdomain() & m_x2.slice_tdomain();
+      }
+
+      const Interval codomain(const Interval&) const
+      {
+        const Interval t = slice_tdomain();
+        assert(t.is_bounded() && "an expression involves at least one tube");
+        return F::apply(m_x1.codomain(t), m_x2.codomain(t));
+      }
+
+      const Interval gate(double t) const
+      {
+        const Interval t_slice = slice_tdomain();
+        if(t != t_slice.lb() && t != t_slice.ub()) // gate created by a sampling of the expression
+          return codomain(t_slice);
+
+        return F::apply(m_x1.gate(t), m_x2.gate(t));
+      }
+
+    protected:
+
+      const E1 m_x1;
+      const E2 m_x2;
+  };
+
+  /**
+   * \brief Starts a lazy expression on a tube
+   *
+   * \param x the tube, referenced by the expression
+   * \return the expression
+   */
+  inline const TubeRefExpr lazy(const Tube& x)
+  {
+    return TubeRefExpr(x);
+  }
+
+  // Operands of binary operations, converted into expressions
+
+  template<typename E>
+  inline const E& tube_expr_operand(const TubeExpr<E>& x) { return x.derived(); }
+  inline const TubeRefExpr tube_expr_operand(const Tube& x) { return TubeRefExpr(x); }
+  inline const IntervalExpr tube_expr_operand(const Interval& x) { return IntervalExpr(x); }
+  inline const TrajectoryExpr tube_expr_operand(const Trajectory& x) { return TrajectoryExpr(x); }
+
+  template<typename T>
+  using TubeExprOperand = typename std::decay<decltype(tube_expr_operand(std::declval<const T&>()))>::type;
+
+  template<typename T>
+  using is_tube_expr = std::is_base_of<TubeExprBase,T>;
+
+  template<typename T>
+  using is_tube_expr_operand = std::integral_constant<bool,
+    is_tube_expr<T>::value || std::is_same<T,Tube>::value || std::is_same<T,Interval>::value
+    || std::is_same<T,Trajectory>::value || std::is_arithmetic<T>::value>;
+
+  // At least one of the operands is an expression, the other one
+  // may be a tube, a trajectory or an interval
+
+  template<typename T1, typename T2, typename R>
+  using enable_if_tube_expr_binary = typename std::enable_if<
+    (is_tube_expr<T1>::value || is_tube_expr<T2>::value)
+    && is_tube_expr_operand<T1>::value && is_tube_expr_operand<T2>::value, R>::type;
+
+  #define macro_expr_unary(f) \
+    \
+    struct TubeExprOp_##f \
+    { \
+      static const Interval apply(const Interval& x) { return ibex::f(x); } \
+    }; \
+    \
+    template<typename E> \
+    const UnaryTubeExpr<TubeExprOp_##f,E> f(const TubeExpr<E>& x) \
+    { \
+      return UnaryTubeExpr<TubeExprOp_##f,E>(x.derived()); \
+    } \
+    \
+
+  macro_expr_unary(cos);
+  macro_expr_unary(sin);
+  macro_expr_unary(abs);
+  macro_expr_unary(sqr);
+  macro_expr_unary(sqrt);
+  macro_expr_unary(exp);
+  macro_expr_unary(log);
+  macro_expr_unary(tan);
+  macro_expr_unary(acos);
+  macro_expr_unary(asin);
+  macro_expr_unary(atan);
+  macro_expr_unary(cosh);
+  macro_expr_unary(sinh);
+  macro_expr_unary(tanh);
+  macro_expr_unary(acosh);
+  macro_expr_unary(asinh);
+  macro_expr_unary(atanh);
+
+  #define macro_expr_unary_param(f, p) \
+    \
+    template<typename E> \
+    const ParamTubeExpr<TubeExprOp_##f,E,p> f(const TubeExpr<E>& x, p param) \
+    { \
+      return ParamTubeExpr<TubeExprOp_##f,E,p>(x.derived(), param); \
+    } \
+    \
+
+  struct TubeExprOp_pow
+  {
+    static const Interval apply(const Interval& x, int p) { return ibex::pow(x, p); }
+    static const Interval apply(const Interval& x, double p) { return ibex::pow(x, p); }
+    static const Interval apply(const Interval& x, const Interval& p) { return ibex::pow(x, p); }
+  };
+
+  struct TubeExprOp_root
+  {
+    static const Interval apply(const Interval& x, int p) { return ibex::root(x, p); }
+  };
+
+  macro_expr_unary_param(pow, int);
+  macro_expr_unary_param(pow, double);
+  macro_expr_unary_param(pow, Interval);
+  macro_expr_unary_param(root, int);
+
+  struct TubeExprOp_minus
+  {
+    static const Interval apply(const Interval& x) { return -x; }
+  };
+
+  template<typename E>
+  const E operator+(const TubeExpr<E>& x)
+  {
+    return x.derived();
+  }
+
+  template<typename E>
+  const UnaryTubeExpr<TubeExprOp_minus,E> operator-(const TubeExpr<E>& x)
+  {
+    return UnaryTubeExpr<TubeExprOp_minus,E>(x.derived());
+  }
+
+  #define macro_expr_binary(f, name) \
+    \
+    struct TubeExprOp_##name \
+    { \
+      static const Interval apply(const Interval& x1, const Interval& x2) { return ibex::f(x1, x2); } \
+    }; \
+    \
+    template<typename T1, typename T2> \
+    const enable_if_tube_expr_binary<T1,T2, \
+      BinaryTubeExpr<TubeExprOp_##name,TubeExprOperand<T1>,TubeExprOperand<T2> > > \
+      f(const T1& x1, const T2& x2) \
+    { \
+      return BinaryTubeExpr<TubeExprOp_##name,TubeExprOperand<T1>,TubeExprOperand<T2> >( \
+        tube_expr_operand(x1), tube_expr_operand(x2)); \
+    } \
+    \
+
+  macro_expr_binary(operator+, add);
+  macro_expr_binary(operator-, sub);
+  macro_expr_binary(operator*, mul);
+  macro_expr_binary(operator|, union);
+  macro_expr_binary(operator&, inter);
+  macro_expr_binary(atan2, atan2);
+  macro_expr_binary(min, min);
+  macro_expr_binary(max, max);
+
+  struct TubeExprOp_div
+  {
+    static const Interval apply(const Interval& x1, const Interval& x2) { return x1 / x2; }
+  };
+
+  struct TubeExprOp_div_traj // same computations as operator/(const Trajectory&, const Tube&)
+  {
+    static const Interval apply(const Interval& x1, const Interval& x2) { return (Interval(1.) / x2) * x1; }
+  };
+
+  template<typename E1>
+  using TubeExprOp_div_of = typename std::conditional<
+    std::is_same<E1,TrajectoryExpr>::value, TubeExprOp_div_traj, TubeExprOp_div>::type;
+
+  template<typename T1, typename T2>
+  const enable_if_tube_expr_binary<T1,T2,
+    BinaryTubeExpr<TubeExprOp_div_of<TubeExprOperand<T1> >,TubeExprOperand<T1>,TubeExprOperand<T2> > >
+    operator/(const T1& x1, const T2& x2)
+  {
+    return BinaryTubeExpr<TubeExprOp_div_of<TubeExprOperand<T1> >,TubeExprOperand<T1>,TubeExprOperand<T2> >(
+      tube_expr_operand(x1), tube_expr_operand(x2));
+  }
+
+  /// @}
+  /// \name Vector expressions
+  /// @{
+
+  /**
+   * \class TubeVectorExprBase
+   * \brief Common base of vector tube expressions, for type detection
+   */
+  class TubeVectorExprBase { };
+
+  /**
+   * \class TubeVectorExpr
+   * \brief Lazy expression on tube vectors, evaluated component by component
+   *
+   * Any expression E provides its size() and its scalar expressions
+   * component(i), of type E::Component.
+   */
+  template<typename E>
+  class TubeVectorExpr : public TubeVectorExprBase
+  {
+    public:
+
+      /**
+       * \brief Returns the actual expression object
+       *
+       * \return a const reference to the expression
+       */
+      const E& derived() const
+      {
+        return static_cast<const E&>(*this);
+      }
+
+      /**
+       * \brief Evaluates the expression
+       *
+       * \return the resulting tube vector
+       */
+      const TubeVector eval() const
+      {
+        const E& e = derived();
+        assert(e.size() > 0);
+
+        TubeVector y(e.size(), e.component(0).eval());
+        for(int i = 1 ; i < e.size() ; i++)
+          e.component(i).eval(y[i]);
+        return y;
+      }
+
+      /**
+       * \brief Evaluates the expression, see eval()
+       */
+      operator TubeVector() const
+      {
+        return eval();
+      }
+  };
+
+  /**
+   * \class TubeVectorRefExpr
+   * \brief Tube vector involved in an expression
+   */
+  class TubeVectorRefExpr : public TubeVectorExpr<TubeVectorRefExpr>
+  {
+    public:
+
+      typedef TubeRefExpr Component;
+
+      explicit TubeVectorRefExpr(const TubeVector& x)
+        : m_x(x)
+      {
+
+      }
+
+      int size() const { return m_x.size(); }
+      const Component component(int i) const { return TubeRefExpr(m_x[i]); }
+
+    protected:
+
+      const TubeVector& m_x;
+  };
+
+  /**
+   * \class IntervalVectorExpr
+   * \brief Constant box involved in an expression
+   */
+  class IntervalVectorExpr : public TubeVectorExpr<IntervalVectorExpr>
+  {
+    public:
+
+      typedef IntervalExpr Component;
+
+      explicit IntervalVectorExpr(const IntervalVector& x)
+        : m_x(x)
+      {
+
+      }
+
+      int size() const { return m_x.size(); }
+      const Component component(int i) const { return IntervalExpr(m_x[i]); }
+
+    protected:
+
+      const IntervalVector m_x;
+  };
+
+  /**
+   * \class TrajectoryVectorExpr
+   * \brief Trajectory vector involved in an expression
+   */
+  class TrajectoryVectorExpr : public TubeVectorExpr<TrajectoryVectorExpr>
+  {
+    public:
+
+      typedef TrajectoryExpr Component;
+
+      explicit TrajectoryVectorExpr(const TrajectoryVector& x)
+        : m_x(x)
+      {
+
+      }
+
+      int size() const { return m_x.size(); }
+      const Component component(int i) const { return TrajectoryExpr(m_x[i]); }
+
+    protected:
+
+      const TrajectoryVector& m_x;
+  };
+
+  /**
+   * \class ScalarTubeVectorExpr
+   * \brief Scalar expression used for all the components of a vector expression
+   */
+  template<typename E>
+  class ScalarTubeVectorExpr : public TubeVectorExpr<ScalarTubeVectorExpr<E> >
+  {
+    public:
+
+      typedef E Component;
+
+      explicit ScalarTubeVectorExpr(const E& x, int n)
+        : m_x(x), m_n(n)
+      {
+
+      }
+
+      int size() const { return m_n; }
+      const Component component(int) const { return m_x; }
+
+    protected:
+
+      const E m_x;
+      const int m_n;
+  };
+
+  /**
+   * \class UnaryTubeVectorExpr
+   * \brief Unary operation F on each component of a vector expression
+   */
+  template<typename F, typename E>
+  class UnaryTubeVectorExpr : public TubeVectorExpr<UnaryTubeVectorExpr<F,E> >
+  {
+    public:
+
+      typedef UnaryTubeExpr<F,typename E::Component> Component;
+
+      explicit UnaryTubeVectorExpr(const E& x)
+        : m_x(x)
+      {
+
+      }
+
+      int size() const { return m_x.size(); }
+      const Component component(int i) const { return Component(m_x.component(i)); }
+
+    protected:
+
+      const E m_x;
+  };
+
+  /**
+   * \class BinaryTubeVectorExpr
+   * \brief Binary operation F on each component of two vector expressions
+   */
+  template<typename F, typename E1, typename E2>
+  class BinaryTubeVectorExpr : public TubeVectorExpr<BinaryTubeVectorExpr<F,E1,E2> >
+  {
+    public:
+
+      typedef BinaryTubeExpr<F,typename E1::Component,typename E2::Component> Component;
+
+      explicit BinaryTubeVectorExpr(const E1& x1, const E2& x2)
+        : m_x1(x1), m_x2(x2)
+      {
+        assert(x1.size() == x2.size());
+      }
+
+      int size() const { return m_x1.size(); }
+      const Component component(int i) const { return Component(m_x1.component(i), m_x2.component(i)); }
+
+    protected:
+
+      const E1 m_x1;
+      const E2 m_x2;
+  };
+
+  /**
+   * \brief Starts a lazy expression on a tube vector
+   *
+   * \param x the tube vector, referenced by the expression
+   * \return the expression
+   */
+  inline const TubeVectorRefExpr lazy(const TubeVector& x)
+  {
+    return TubeVectorRefExpr(x);
+  }
+
+  // Operands of binary operations, converted into vector expressions
+
+  template<typename E>
+  inline const E& tube_vector_expr_operand(const TubeVectorExpr<E>& x) { return x.derived(); }
+  inline const TubeVectorRefExpr tube_vector_expr_operand(const TubeVector& x) { return TubeVectorRefExpr(x); }
+  inline const IntervalVectorExpr tube_vector_expr_operand(const IntervalVector& x) { return IntervalVectorExpr(x); }
+  inline const TrajectoryVectorExpr tube_vector_expr_operand(const TrajectoryVector& x) { return TrajectoryVectorExpr(x); }
+
+  template<typename T>
+  using TubeVectorExprOperand = typename std::decay<decltype(tube_vector_expr_operand(std::declval<const T&>()))>::type;
+
+  template<typename T>
+  using is_tube_vector_expr = std::is_base_of<TubeVectorExprBase,T>;
+
+  template<typename T>
+  using is_tube_vector_expr_operand = std::integral_constant<bool,
+    is_tube_vector_expr<T>::value || std::is_same<T,TubeVector>::value
+    || std::is_same<T,IntervalVector>::value || std::is_same<T,TrajectoryVector>::value>;
+
+  template<typename T1, typename T2, typename R>
+  using enable_if_tube_vector_expr_binary = typename std::enable_if<
+    (is_tube_vector_expr<T1>::value || is_tube_vector_expr<T2>::value)
+    && is_tube_vector_expr_operand<T1>::value && is_tube_vector_expr_operand<T2>::value, R>::type;
+
+  // Products and divisions of a vector by a scalar expression
+
+  template<typename T1, typename T2, typename R>
+  using enable_if_scalar_tube_vector_expr = typename std::enable_if<
+    (is_tube_expr<T1>::value || is_tube_vector_expr<T2>::value)
+    && is_tube_expr_operand<T1>::value && is_tube_vector_expr_operand<T2>::value, R>::type;
+
+  template<typename E>
+  const UnaryTubeVectorExpr<TubeExprOp_minus,E> operator-(const TubeVectorExpr<E>& x)
+  {
+    return UnaryTubeVectorExpr<TubeExprOp_minus,E>(x.derived());
+  }
+
+  template<typename E>
+  const E operator+(const TubeVectorExpr<E>& x)
+  {
+    return x.derived();
+  }
+
+  template<typename E>
+  const UnaryTubeVectorExpr<TubeExprOp_abs,E> abs(const TubeVectorExpr<E>& x)
+  {
+    return UnaryTubeVectorExpr<TubeExprOp_abs,E>(x.derived());
+  }
+
+  #define macro_vect_expr_binary(f, name) \
+    \
+    template<typename T1, typename T2> \
+    const enable_if_tube_vector_expr_binary<T1,T2, \
+      BinaryTubeVectorExpr<TubeExprOp_##name,TubeVectorExprOperand<T1>,TubeVectorExprOperand<T2> > > \
+      f(const T1& x1, const T2& x2) \
+    { \
+      return BinaryTubeVectorExpr<TubeExprOp_##name,TubeVectorExprOperand<T1>,TubeVectorExprOperand<T2> >( \
+        tube_vector_expr_operand(x1), tube_vector_expr_operand(x2)); \
+    } \
+    \
+
+  macro_vect_expr_binary(operator+, add);
+  macro_vect_expr_binary(operator-, sub);
+  macro_vect_expr_binary(operator|, union);
+  macro_vect_expr_binary(operator&, inter);
+
+  template<typename T1, typename T2>
+  const enable_if_scalar_tube_vector_expr<T1,T2,
+    BinaryTubeVectorExpr<TubeExprOp_mul,ScalarTubeVectorExpr<TubeExprOperand<T1> >,TubeVectorExprOperand<T2> > >
+    operator*(const T1& x1, const T2& x2)
+  {
+    const TubeVectorExprOperand<T2> e2 = tube_vector_expr_operand(x2);
+    return BinaryTubeVectorExpr<TubeExprOp_mul,ScalarTubeVectorExpr<TubeExprOperand<T1> >,TubeVectorExprOperand<T2> >(
+      ScalarTubeVectorExpr<TubeExprOperand<T1> >(tube_expr_operand(x1), e2.size()), e2);
+  }
+
+  template<typename T1, typename T2>
+  const enable_if_scalar_tube_vector_expr<T2,T1,
+    BinaryTubeVectorExpr<TubeExprOp_div_of<typename TubeVectorExprOperand<T1>::Component>,
+      TubeVectorExprOperand<T1>,ScalarTubeVectorExpr<TubeExprOperand<T2> > > >
+    operator/(const T1& x1, const T2& x2)
+  {
+    const TubeVectorExprOperand<T1> e1 = tube_vector_expr_operand(x1);
+    return BinaryTubeVectorExpr<TubeExprOp_div_of<typename TubeVectorExprOperand<T1>::Component>,
+      TubeVectorExprOperand<T1>,ScalarTubeVectorExpr<TubeExprOperand<T2> > >(
+      e1, ScalarTubeVectorExpr<TubeExprOperand<T2> >(tube_expr_operand(x2), e1.size()));
+  }
+
+  /// @}
+}
+
+#endif
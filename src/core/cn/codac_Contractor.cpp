@@ -130,15 +130,10 @@ namespace codac
   //  return const_cast<vector<Domain*> >(static_cast<const Contractor&>(*this).domains());
   //}
 
-  const vector<Domain*> Contractor::domains() const
+  const vector<Domain*>& Contractor::domains() const
   {
     if(m_type == Type::T_CN)
-    {
-      vector<Domain*> v_dom; // building a vector of domains from the CN map
-      for(const auto& dom : m_cn_ctc.get().m_map_domains)
-        v_dom.push_back(dom.second);
-      return v_dom;
-    }
+      return m_cn_ctc.get().m_v_domains; // domains of the sub-CN
 
     else
       return m_v_domains;
@@ -207,6 +202,7 @@ namespace codac
   void Contractor::contract()
   {
     assert(!m_v_domains.empty() || m_type == Type::T_CN);
+    chrono::steady_clock::time_point t_start = chrono::steady_clock::now();
 
     if(m_type == Type::T_IBEX)
     {
@@ -406,6 +402,50 @@ namespace codac
 
     else
       assert(false && "unhandled case");
+
+    m_nb_calls++;
+    m_last_call_start = t_start;
+    m_last_call_duration = chrono::duration<double>(chrono::steady_clock::now() - t_start).count();
+    m_calls_duration += m_last_call_duration;
+  }
+
+  int Contractor::nb_calls() const
+  {
+    return m_nb_calls;
+  }
+
+  double Contractor::duration() const
+  {
+    return m_calls_duration;
+  }
+
+  double Contractor::cost() const
+  {
+    return m_nb_calls == 0 ? 0. : m_calls_duration / m_nb_calls;
+  }
+
+  double Contractor::gain() const
+  {
+    return m_gain;
+  }
+
+  double Contractor::cumulated_gain() const
+  {
+    return m_cumulated_gain;
+  }
+
+  void Contractor::set_gain(double gain)
+  {
+    m_gain = gain;
+    m_cumulated_gain += gain;
+  }
+
+  void Contractor::reset_stats()
+  {
+    m_nb_calls = 0;
+    m_calls_duration = 0.;
+    m_gain = 1.;
+    m_cumulated_gain = 0.;
   }
   
   const string Contractor::name() const
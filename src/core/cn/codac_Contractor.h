@@ -13,6 +13,7 @@
 #define __CODAC_CONTRACTOR_H__
 
 #include <vector>
+#include <chrono>
 #include <functional>
 #include "codac_Ctc.h"
 #include "codac_DynCtc.h"
@@ -54,12 +55,20 @@ namespace codac
       void set_active(bool active);
 
       //std::vector<Domain*> domains();
-      const std::vector<Domain*> domains() const;
+      const std::vector<Domain*>& domains() const;
 
       bool operator==(const Contractor& x) const;
 
       void contract();
 
+      int nb_calls() const;
+      double duration() const;
+      double cost() const;
+      double gain() const;
+      double cumulated_gain() const;
+      void set_gain(double gain);
+      void reset_stats();
+
       const std::string name() const;
       void set_name(const std::string& name);
 
@@ -83,9 +92,20 @@ namespace codac
       std::string m_name;
       int m_ctc_id;
 
+      // Observed behavior, for the scheduling of the contractors
+      int m_nb_calls = 0;
+      double m_calls_duration = 0.; // cumulated wall-clock time of the calls (s)
+      double m_gain = 1.; // relative volume reduction observed after the last call
+      double m_cumulated_gain = 0.; // sum of the relative volume reductions of all the calls
+      std::chrono::steady_clock::time_point m_last_call_start;
+      double m_last_call_duration = 0.;
+      double m_priority = 0.; // key in the queue of the CN, computed when queued
+      unsigned long m_queue_order = 0; // order of insertion in the queue of the CN
+
       static int ctc_counter;
       
       friend class ContractorHashcode;
+      friend class ContractorNetwork;
   };
 }
 
@@ -29,10 +29,10 @@ namespace codac
 
     ContractorNetwork::~ContractorNetwork()
     {
-      for(auto& dom : m_map_domains)
-        delete dom.second;
-      for(auto& ctc : m_map_ctc)
-        delete ctc.second;
+      for(auto& dom : m_v_domains)
+        delete dom;
+      for(auto& ctc : m_v_ctc)
+        delete ctc;
 
       if(m_ctc_deriv)
         delete m_ctc_deriv;
@@ -40,18 +40,18 @@ namespace codac
 
     int ContractorNetwork::nb_ctc() const
     {
-      return m_map_ctc.size();
+      return m_v_ctc.size();
     }
 
     int ContractorNetwork::nb_dom() const
     {
-      return m_map_domains.size();
+      return m_v_domains.size();
     }
     
     bool ContractorNetwork::emptiness() const
     {
-      for(auto& dom : m_map_domains)
-        if(dom.second->is_empty())
+      for(auto& dom : m_v_domains)
+        if(dom->is_empty())
           return true;
 
       return false;
@@ -406,9 +406,9 @@ namespace codac
       Contractor *ctc_ptr = add_ctc(cn);
 
       // Sharing domains from sub_cn to cn
-      for(auto& dom : cn.m_map_domains)
+      for(auto& dom : cn.m_v_domains)
       {
-        Domain* ad = add_dom(*dom.second);
+        Domain* ad = add_dom(*dom);
         ad->add_ctc(ctc_ptr);
       }
     }
@@ -434,12 +434,13 @@ namespace codac
       if(ad.is_empty())
         throw Exception(__func__, "domain already empty when added to the CN");
 
-      DomainHashcode hash(ad);
-      if(m_map_domains.find(hash) != m_map_domains.end())
-        return m_map_domains[hash];
+      unordered_map<DomainHashcode,Domain*>::const_iterator it = m_map_domains.find(DomainHashcode(ad));
+      if(it != m_map_domains.end())
+        return it->second;
     
       Domain *new_dom = new Domain(ad);
-      m_map_domains[hash] = new_dom;
+      m_map_domains.insert(make_pair(DomainHashcode(*new_dom), new_dom));
+      m_v_domains.push_back(new_dom);
 
       // And add possible dependencies
 
@@ -458,7 +459,10 @@ namespace codac
             vector<Domain*> v_doms(new_dom->tube_vector().size() + 1);
             v_doms[0] = new_dom;
             for(int i = 0 ; i < new_dom->tube_vector().size() ; i++)
+            {
               v_doms[i+1] = add_dom(Domain(new_dom->tube_vector()[i]));
+              v_doms[i+1]->set_parent_dom(new_dom);
+            }
 
             Contractor *ac_component = add_ctc(Contractor(Contractor::Type::T_COMPONENT, v_doms));
 
@@ -476,6 +480,7 @@ namespace codac
             // And its components
             for(int i = 0 ; i < new_dom->interval_vector().size() ; i++)
               v_doms[i+1] = add_dom(Domain::vector_component(*new_dom, i));
+            new_dom->m_v_components.assign(v_doms.begin()+1, v_doms.end());
 
             Contractor *ac_component = add_ctc(Contractor(Contractor::Type::T_COMPONENT, v_doms));
             for(auto& dom_i : v_doms)
@@ -492,6 +497,7 @@ namespace codac
             {
               i++;
               v_doms[i] = add_dom(Domain(*s));
+              v_doms[i]->set_parent_dom(new_dom);
             }
 
             // Dependencies tube <-> slice
@@ -521,14 +527,15 @@ namespace codac
 
     Contractor* ContractorNetwork::add_ctc(const Contractor& ac)
     {
-      ContractorHashcode hash(ac);
-      map<ContractorHashcode,Contractor*>::iterator it = m_map_ctc.find(hash);
+      unordered_map<ContractorHashcode,Contractor*>::iterator it = m_map_ctc.find(ContractorHashcode(ac));
 
       if(it == m_map_ctc.end())
       {
         // todo: trigger only "contracting" contractors?
         Contractor *new_ctc = new Contractor(ac);
-        m_map_ctc[hash] = new_ctc;
+        // The hashcode refers to the stored contractor, not to the temporary one
+        m_map_ctc.insert(make_pair(ContractorHashcode(*new_ctc), new_ctc));
+        m_v_ctc.push_back(new_ctc);
         add_ctc_to_queue(new_ctc, m_deque);
         return new_ctc;
       }
@@ -13,6 +13,7 @@
 #define __CODAC_CONTRACTORNETWORK_H__
 
 #include <deque>
+#include <chrono>
 #include <initializer_list>
 #include <unordered_map>
 #include "codac_Ctc.h"
@@ -36,6 +37,21 @@ namespace codac
   class CtcDeriv;
   class DomainHashcode;
   class ContractorHashcode;
+  class CtcWorkerPool;
+
+  /**
+   * \struct ProfiledCall
+   * \brief Call of a Contractor recorded during a profiled contraction process
+   */
+  struct ProfiledCall
+  {
+    const Contractor *ctc; //!< called contractor
+    int thread_id; //!< worker that performed the call (0 in sequential mode)
+    double t_start; //!< starting time of the call, since the beginning of the profiling (s)
+    double duration; //!< wall-clock duration of the call (s)
+    double gain; //!< relative contraction of the domains observed after the call
+    std::size_t queue_length; //!< number of active contractors waiting after the call
+  };
 
   /**
    * \class ContractorNetwork
@@ -49,6 +65,19 @@ namespace codac
   {
     public:
 
+      /**
+       * \enum Scheduling
+       * \brief Policies for selecting the next active contractor to be called
+       */
+      enum class Scheduling
+      {
+        DEFAULT, //!< contractors activated last are called first, component contractors being delayed
+        FIFO, //!< contractors are called in order of activation
+        LIFO, //!< contractors activated last are called first
+        PRIORITY, //!< contractors with the highest last observed gain per cost are called first
+        ROUND_ROBIN //!< contractors are taken in turn from each group of domains (a tube and its slices, ...)
+      };
+
       /// \name Definition
       /// @{
 
@@ -312,8 +341,105 @@ namespace codac
       int nb_ctc_in_stack() const;
 
       int iteration_nb() const;
+
+      /**
+       * \brief Sets the number of threads used by the contraction process
+       *
+       * With more than one thread, the active contractors are shared among a pool of
+       * workers (one queue per thread, partitioned according to the domains, with work
+       * stealing between the queues). Contractors that may access the same memory
+       * (same Domain, vector and its components, tube and its slices, adjacent slices
+       * sharing a gate) are never called at the same time.
+       *
+       * \note Static contractors (inherited from Ctc) are not reentrant: the calls of a
+       *       same Ctc object are serialized. Dynamical contractors are called concurrently
+       *       on disjoint domains only if they are thread safe (see DynCtc::is_thread_safe()).
+       *
+       * \param nb_threads number of threads (1 by default: sequential propagation)
+       */
+      void set_nb_threads(int nb_threads);
+
+      /**
+       * \brief Returns the number of threads used by the contraction process
+       *
+       * \return number of threads
+       */
+      int nb_threads() const;
+
+      /**
+       * \brief Sets the policy for selecting the next active contractor to be called
+       *
+       * The contractors record their observed cost (mean wall-clock time of a call) and gain
+       * (relative volume reduction of their domains, observed after their last call), that are
+       * used by the Scheduling::PRIORITY policy. Contractors never called are chosen first.
+       *
+       * \note In multithreaded mode, the active contractors are dispatched among the queues
+       *       of the workers in the order given by this policy.
+       *
+       * \param scheduling policy (Scheduling::DEFAULT by default)
+       */
+      void set_scheduling(Scheduling scheduling);
+
+      /**
+       * \brief Returns the policy for selecting the next active contractor to be called
+       *
+       * \return scheduling policy
+       */
+      Scheduling scheduling() const;
       
 
+      /// @}
+      /// \name Profiling
+      /// @{
+
+      /**
+       * \brief Enables or disables the profiling of the contraction process
+       *
+       * The number of calls, the cumulated wall-clock time and the relative contraction
+       * produced by each contractor are always available. When the profiling is enabled,
+       * each call is also recorded (with the length of the queue of active contractors),
+       * for exports as a trace.
+       *
+       * \param enable boolean
+       */
+      void enable_profiling(bool enable = true);
+
+      /**
+       * \brief Resets the profiling data (recorded calls, and counters of the contractors)
+       */
+      void reset_profiling();
+
+      /**
+       * \brief Returns the calls recorded since the profiling has been enabled (or reset)
+       *
+       * \return vector of calls, in chronological order of their end
+       */
+      const std::vector<ProfiledCall>& profiled_calls() const;
+
+      /**
+       * \brief Exports the profiling data in JSON format: statistics of the
+       *        contractors, and history of the length of the queue
+       *
+       * \param file_name name of the output file
+       */
+      void export_profiling_json(const std::string& file_name) const;
+
+      /**
+       * \brief Exports the statistics of the contractors in CSV format (one line per contractor)
+       *
+       * \param file_name name of the output file
+       */
+      void export_profiling_csv(const std::string& file_name) const;
+
+      /**
+       * \brief Exports the recorded calls as a trace-event file, to be loaded in
+       *        `chrome://tracing` or in Perfetto (one track per thread)
+       *
+       * \param file_name name of the output file
+       */
+      void export_chrome_trace(const std::string& file_name) const;
+
+
       /// @}
       /// \name Visualization
       /// @{
@@ -345,6 +471,9 @@ namespace codac
       /**
        * \brief Generates a dot graph for visualization in PDF file format, by using dot2tex
        *
+       * When the profiling is enabled, contractors are filled in red according to
+       * their share of the contraction time (hot contractors).
+       *
        * \param cn_name name of the graph (and rendered file)
        * \param layer_model custom layer model for rendering (dot2tex)
        *        * dot - hierarchical or layered drawings of directed graphs
@@ -402,6 +531,24 @@ namespace codac
        */
       void add_ctc_to_queue(Contractor *ac, std::deque<Contractor*>& ctc_deque);
 
+      /**
+       * \brief Removes the next Contractor to be called from the queue of active contractors,
+       *        according to the scheduling policy
+       *
+       * \return pointer to the Contractor
+       */
+      Contractor* pop_ctc_from_queue();
+
+      /**
+       * \brief Order of the contractors in the queue for the Scheduling::PRIORITY
+       *        and Scheduling::ROUND_ROBIN policies (binary heap)
+       *
+       * \param a first Contractor
+       * \param b second Contractor
+       * \return `true` if `a` has to be called after `b`
+       */
+      static bool lower_priority(const Contractor *a, const Contractor *b);
+
       void reset_value(Domain *dom);
 
       /**
@@ -409,20 +556,76 @@ namespace codac
        *
        * \param dom pointer to the Domain
        * \param ctc_to_avoid optional pointer to a Contractor to not activate
+       * \param volume optional current volume of the Domain, if already computed (negative otherwise)
+       * \return relative contraction of the Domain since its last evaluation, in \f$[0,1]\f$
        */
-      void trigger_ctc_related_to_dom(Domain *dom, Contractor *ctc_to_avoid = nullptr);
+      double trigger_ctc_related_to_dom(Domain *dom, Contractor *ctc_to_avoid = nullptr, double volume = -1.);
+
+      /**
+       * \brief Triggers on the contractors related to the domains of a Contractor,
+       *        after its contraction
+       *
+       * \note For the component contractor of a tube (or a tube vector), the components
+       *       are evaluated only if the tube has been contracted as a whole. Otherwise,
+       *       its volume is obtained incrementally from the saved volumes of its slices.
+       *
+       * \note The largest relative contraction of the domains is recorded as the gain of the Contractor.
+       *
+       * \param ctc pointer to the Contractor that has just been called
+       * \param v_volumes optional current volumes of its domains, negative values
+       *        standing for volumes to be computed
+       */
+      void trigger_ctc_related_to_domains(Contractor *ctc, const std::vector<double>& v_volumes = std::vector<double>());
 
       void replace_var_by_dom(Domain var, Domain dom);
 
+      /**
+       * \brief Propagation loop of the multithreaded mode
+       *
+       * Active contractors of the CN queue are dispatched among the workers, and the ones
+       * remaining at the end (in case of time limit) are put back in the queue.
+       *
+       * \param t_start starting time of the contraction process
+       */
+      void propagate_parallel(const std::chrono::steady_clock::time_point& t_start);
+
+      /**
+       * \brief Moves the contractors of the CN queue to the queues of the workers,
+       *        in the order given by the scheduling policy
+       *
+       * \param pool shared state of the workers
+       */
+      void dispatch_queue(CtcWorkerPool& pool);
+
+      /**
+       * \brief Records the last call of a Contractor, if the profiling is enabled
+       *
+       * \param ctc pointer to the Contractor that has just been called
+       * \param thread_id worker that performed the call
+       * \param queue_length number of active contractors waiting
+       */
+      void record_call(const Contractor *ctc, int thread_id, std::size_t queue_length);
+
     protected:
 
-      std::map<DomainHashcode,Domain*> m_map_domains; //!< pointers to the abstract Domain objects the graph is made of
-      std::map<ContractorHashcode,Contractor*> m_map_ctc; //!< pointers to the abstract Contractor objects the graph is made of
+      std::vector<Domain*> m_v_domains; //!< pointers to the abstract Domain objects the graph is made of (in order of addition)
+      std::vector<Contractor*> m_v_ctc; //!< pointers to the abstract Contractor objects the graph is made of (in order of addition)
+      std::unordered_map<DomainHashcode,Domain*> m_map_domains; //!< fast access to the Domain objects from their memory references
+      std::unordered_map<ContractorHashcode,Contractor*> m_map_ctc; //!< fast access to the Contractor objects from their signatures
       std::deque<Contractor*> m_deque; //!< queue of active contractors
 
       int m_iteration_nb = 0;
       float m_fixedpoint_ratio = 0.0001; //!< fixed point ratio for propagation limit
       double m_contraction_duration_max = std::numeric_limits<double>::infinity(); //!< computation time limit
+      int m_nb_threads = 1; //!< number of threads used by the propagation process
+      Scheduling m_scheduling = Scheduling::DEFAULT; //!< policy for selecting the next contractor
+      unsigned long m_nb_queued_ctc = 0; //!< number of insertions in the queue, for FIFO ordering of equal priorities
+      unsigned long m_round = 0; //!< current round of the ROUND_ROBIN scheduling
+      std::unordered_map<const Domain*,unsigned long> m_map_group_rounds; //!< last round given to each group of domains
+
+      bool m_profiling = false; //!< if true, all the calls of contractors are recorded
+      std::chrono::steady_clock::time_point m_profiling_start; //!< reference time of the recorded calls
+      std::vector<ProfiledCall> m_v_profiled_calls; //!< calls recorded during the contraction processes
 
       CtcDeriv *m_ctc_deriv = nullptr; //!< optional pointer to a CtcDeriv object that can be automatically added in the graph
       std::list<std::pair<Domain*,Domain*> > m_domains_related_to_ctcderiv;
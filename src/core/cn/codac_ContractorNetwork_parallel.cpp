@@ -0,0 +1,383 @@
+/**
+ *  ContractorNetwork class : multithreaded propagation
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <mutex>
+#include <thread>
+#include <algorithm>
+#include <exception>
+#include <unordered_map>
+#include <condition_variable>
+#include "codac_ContractorNetwork.h"
+
+using namespace std;
+using namespace ibex;
+
+namespace codac
+{
+  // Memory accessed by the contractors, so that two contractors
+  // possibly writing the same data are never called concurrently.
+  // A resource is an address: Interval, component of a vector, Slice or gate.
+
+  typedef vector<pair<const void*,bool> > CtcResources; // (address, write access)
+
+  namespace
+  {
+    void add_slice_resources(const Slice& s, bool write, CtcResources& v_res)
+    {
+      v_res.push_back(make_pair(&s, write));
+      v_res.push_back(make_pair(&s.input_gate(), write));
+      v_res.push_back(make_pair(&s.output_gate(), write));
+
+      if(write)
+      {
+        // Setting the gates involves reading the envelopes of the neighbour slices
+        if(s.prev_slice())
+          v_res.push_back(make_pair(s.prev_slice(), false));
+        if(s.next_slice())
+          v_res.push_back(make_pair(s.next_slice(), false));
+      }
+    }
+
+    void add_domain_resources(const Domain *dom, bool write, CtcResources& v_res)
+    {
+      switch(dom->type())
+      {
+        case Domain::Type::T_INTERVAL:
+          v_res.push_back(make_pair(&dom->interval(), write));
+          break;
+
+        case Domain::Type::T_INTERVAL_VECTOR:
+          // Components are considered separately, as they may be domains of other contractors
+          for(int i = 0 ; i < dom->interval_vector().size() ; i++)
+            v_res.push_back(make_pair(&dom->interval_vector()[i], write));
+          break;
+
+        case Domain::Type::T_SLICE:
+          add_slice_resources(dom->slice(), write, v_res);
+          break;
+
+        case Domain::Type::T_TUBE:
+          for(const Slice *s = dom->tube().first_slice() ; s ; s = s->next_slice())
+            add_slice_resources(*s, write, v_res);
+          break;
+
+        case Domain::Type::T_TUBE_VECTOR:
+          for(int i = 0 ; i < dom->tube_vector().size() ; i++)
+            for(const Slice *s = dom->tube_vector()[i].first_slice() ; s ; s = s->next_slice())
+              add_slice_resources(*s, write, v_res);
+          break;
+      }
+    }
+
+    CtcResources ctc_resources(Contractor *ctc)
+    {
+      CtcResources v_res;
+
+      // Component contractors do not contract: the domains are only
+      // read when evaluating their volumes during the propagation
+      bool write = ctc->type() != Contractor::Type::T_COMPONENT;
+      for(const auto& dom : ctc->domains())
+        add_domain_resources(dom, write, v_res);
+
+      // The contractor objects themselves may not be reentrant
+      if(ctc->type() == Contractor::Type::T_IBEX)
+        v_res.push_back(make_pair(&ctc->ibex_ctc(), true));
+
+      else if(ctc->type() == Contractor::Type::T_CODAC && !ctc->codac_ctc().is_thread_safe())
+        v_res.push_back(make_pair(&ctc->codac_ctc(), true));
+
+      // Each address appears once, with a write access if needed
+      sort(v_res.begin(), v_res.end(),
+        [](const pair<const void*,bool>& a, const pair<const void*,bool>& b) {
+          return a.first < b.first || (a.first == b.first && a.second > b.second);
+        });
+      v_res.erase(unique(v_res.begin(), v_res.end(),
+        [](const pair<const void*,bool>& a, const pair<const void*,bool>& b) {
+          return a.first == b.first;
+        }), v_res.end());
+
+      return v_res;
+    }
+
+    // Volumes of the domains of a contractor, computed after its call while its
+    // resources are still reserved (negative values stand for volumes not computed).
+    // The slices of a composite domain handled by its component contractor
+    // are only evaluated if the domain has been contracted as a whole.
+    vector<double> domains_volumes(const Contractor *ctc, bool components_outdated)
+    {
+      const vector<Domain*>& v_doms = ctc->domains();
+      vector<double> v_volumes(v_doms.size(), -1.);
+
+      bool composite = ctc->type() == Contractor::Type::T_COMPONENT && v_doms[0]->is_composite();
+      for(size_t i = composite ? 1 : 0 ; i < v_doms.size() ; i++)
+        if(!composite || components_outdated)
+          v_volumes[i] = v_doms[i]->compute_volume();
+
+      return v_volumes;
+    }
+  }
+
+  /**
+   * \class CtcWorkerPool
+   * \brief Shared state of the threads involved in a multithreaded propagation.
+   *        All the members are protected by the mutex, which is released during
+   *        the calls to the contractors and the evaluation of their domains.
+   */
+  class CtcWorkerPool
+  {
+    public:
+
+      CtcWorkerPool(int nb_threads)
+        : m_queues(nb_threads)
+      {
+
+      }
+
+      bool try_acquire(Contractor *ctc)
+      {
+        if(m_exclusive_running)
+          return false;
+
+        // Sub-CN contractors are run alone: their domains are not known
+        if(ctc->type() == Contractor::Type::T_CN)
+        {
+          if(m_nb_running != 0)
+            return false;
+          m_exclusive_running = true;
+          m_nb_running++;
+          return true;
+        }
+
+        const CtcResources& v_res = resources(ctc);
+
+        for(const auto& r : v_res)
+        {
+          unordered_map<const void*,int>::const_iterator it = m_locks.find(r.first);
+          if(it != m_locks.end() && (r.second || it->second < 0))
+            return false; // written by another contractor, or read while we need to write
+        }
+
+        for(const auto& r : v_res)
+        {
+          if(r.second)
+            m_locks[r.first] = -1; // exclusive access
+          else
+            m_locks[r.first]++; // one more reader
+        }
+
+        m_nb_running++;
+        return true;
+      }
+
+      void release(Contractor *ctc)
+      {
+        if(ctc->type() == Contractor::Type::T_CN)
+          m_exclusive_running = false;
+
+        else
+          for(const auto& r : resources(ctc))
+          {
+            unordered_map<const void*,int>::iterator it = m_locks.find(r.first);
+            assert(it != m_locks.end());
+            if(r.second || --it->second == 0)
+              m_locks.erase(it);
+          }
+
+        m_nb_running--;
+      }
+
+      Contractor* pick(int worker_id)
+      {
+        // Only the first elements of the queues are candidates, which bounds
+        // the cost of this selection when contractors are waiting for memory
+        const size_t max_candidates = 32;
+        int nb_queues = m_queues.size();
+
+        for(int k = 0 ; k < nb_queues ; k++)
+        {
+          deque<Contractor*>& q = m_queues[(worker_id + k) % nb_queues];
+          size_t n = min(q.size(), max_candidates);
+
+          for(size_t i = 0 ; i < n ; i++)
+          {
+            // The worker pops its own queue from the front (priority contractors),
+            // and steals contractors from the back of the queues of other workers
+            deque<Contractor*>::iterator it = k == 0 ? q.begin() + i : q.end() - 1 - i;
+
+            if(try_acquire(*it))
+            {
+              Contractor *ctc = *it;
+              q.erase(it);
+              return ctc;
+            }
+          }
+        }
+
+        return nullptr;
+      }
+
+      void push_front(Contractor *ctc)
+      {
+        m_queues[owner(ctc)].push_front(ctc);
+        m_nb_pending++;
+      }
+
+      void partition(const vector<Domain*>& v_doms)
+      {
+        // Domains are split into blocks in order of addition, for locality:
+        // slices of a tube are added in temporal order
+        for(size_t i = 0 ; i < v_doms.size() ; i++)
+          m_map_owners[v_doms[i]] = i * m_queues.size() / v_doms.size();
+      }
+
+      int owner(Contractor *ctc) const
+      {
+        // A contractor is handled by the worker of its first domain
+        if(ctc->domains().empty())
+          return 0;
+        unordered_map<const Domain*,int>::const_iterator it = m_map_owners.find(ctc->domains()[0]);
+        return it == m_map_owners.end() ? 0 : it->second;
+      }
+
+      const CtcResources& resources(Contractor *ctc)
+      {
+        unordered_map<Contractor*,CtcResources>::iterator it = m_map_resources.find(ctc);
+        if(it == m_map_resources.end())
+          it = m_map_resources.insert(make_pair(ctc, ctc_resources(ctc))).first;
+        return it->second;
+      }
+
+    public:
+
+      mutex m_mutex;
+      condition_variable m_cv;
+      vector<deque<Contractor*> > m_queues; //!< one queue of active contractors per worker
+      int m_nb_pending = 0; //!< number of contractors queued or being called
+      int m_nb_running = 0; //!< number of contractors being called
+      bool m_exclusive_running = false;
+      bool m_stop = false;
+      exception_ptr m_exception = nullptr;
+
+    protected:
+
+      unordered_map<const void*,int> m_locks; //!< number of readers of an address, -1 if written
+      unordered_map<Contractor*,CtcResources> m_map_resources;
+      unordered_map<const Domain*,int> m_map_owners;
+  };
+
+  // Protected methods
+
+    void ContractorNetwork::dispatch_queue(CtcWorkerPool& pool)
+    {
+      // Contractors are taken in the order of the scheduling policy
+      vector<Contractor*> v_ctc;
+      v_ctc.reserve(m_deque.size());
+      while(!m_deque.empty())
+        v_ctc.push_back(pop_ctc_from_queue());
+
+      for(vector<Contractor*>::reverse_iterator it = v_ctc.rbegin() ; it != v_ctc.rend() ; ++it)
+        pool.push_front(*it);
+    }
+
+    void ContractorNetwork::propagate_parallel(const chrono::steady_clock::time_point& t_start)
+    {
+      CtcWorkerPool pool(m_nb_threads);
+      pool.partition(m_v_domains);
+
+      // The CN queue is dispatched, keeping the relative order of the contractors
+      dispatch_queue(pool);
+
+      auto worker = [this,&pool,&t_start](int worker_id)
+      {
+        unique_lock<mutex> lock(pool.m_mutex);
+
+        while(!pool.m_stop)
+        {
+          if(pool.m_nb_pending == 0
+            || chrono::duration<double>(chrono::steady_clock::now() - t_start).count() >= m_contraction_duration_max)
+          {
+            pool.m_stop = true;
+            pool.m_cv.notify_all();
+            break;
+          }
+
+          Contractor *ctc = pool.pick(worker_id);
+          if(!ctc)
+          {
+            // Waiting for new active contractors or for the release of some memory
+            pool.m_cv.wait(lock);
+            continue;
+          }
+
+          // Updated by the propagation of other contractors: read under the lock
+          bool components_outdated = ctc->type() == Contractor::Type::T_COMPONENT
+            && ctc->domains()[0]->is_composite() && ctc->domains()[0]->m_components_outdated;
+
+          lock.unlock();
+
+          vector<double> v_volumes;
+
+          try
+          {
+            ctc->contract();
+
+            // The memory of the domains is still reserved by this worker:
+            // volumes are computed outside the lock, the deque is then updated with them
+            v_volumes = domains_volumes(ctc, components_outdated);
+          }
+
+          catch(...)
+          {
+            lock.lock();
+            if(!pool.m_exception)
+              pool.m_exception = current_exception();
+            pool.m_stop = true;
+            pool.release(ctc);
+            pool.m_nb_pending--;
+            pool.m_cv.notify_all();
+            break;
+          }
+
+          lock.lock();
+
+          if(ctc->type() != Contractor::Type::T_CN)
+            ctc->set_active(false); // Sub CN will be always triggered
+
+          // Volumes not computed above (domain contracted as a whole in the meantime)
+          // are evaluated here, the resources of the contractor being still reserved
+          trigger_ctc_related_to_domains(ctc, v_volumes);
+
+          // Newly activated contractors are dispatched among the workers
+          dispatch_queue(pool);
+          record_call(ctc, worker_id, pool.m_nb_pending - pool.m_nb_running);
+
+          pool.release(ctc);
+          pool.m_nb_pending--;
+          pool.m_cv.notify_all();
+        }
+      };
+
+      vector<thread> v_threads;
+      for(int i = 1 ; i < m_nb_threads ; i++)
+        v_threads.push_back(thread(worker, i));
+      worker(0); // the calling thread takes part in the propagation
+      for(auto& t : v_threads)
+        t.join();
+
+      // Remaining contractors (time limit reached) are kept for a next call
+      for(const auto& q : pool.m_queues)
+        m_deque.insert(m_deque.end(), q.begin(), q.end());
+      if(m_scheduling == Scheduling::PRIORITY || m_scheduling == Scheduling::ROUND_ROBIN)
+        make_heap(m_deque.begin(), m_deque.end(), lower_priority);
+
+      if(pool.m_exception)
+        rethrow_exception(pool.m_exception);
+    }
+}
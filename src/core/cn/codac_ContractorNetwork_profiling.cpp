@@ -0,0 +1,195 @@
+/**
+ *  ContractorNetwork class : profiling
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <fstream>
+#include <iomanip>
+#include "codac_ContractorNetwork.h"
+#include "codac_Exception.h"
+
+using namespace std;
+using namespace ibex;
+
+namespace codac
+{
+  namespace
+  {
+    const string ctc_type_str(const Contractor *ctc)
+    {
+      switch(ctc->type())
+      {
+        case Contractor::Type::T_COMPONENT: return "component";
+        case Contractor::Type::T_EQUALITY: return "equality";
+        case Contractor::Type::T_IBEX: return "ibex";
+        case Contractor::Type::T_CODAC: return "codac";
+        case Contractor::Type::T_CN: return "cn";
+        default:
+          assert(false && "unhandled case");
+          return "";
+      }
+    }
+
+    const string ctc_label(const Contractor *ctc)
+    {
+      // Names are LaTeX expressions (for dot2tex), possibly empty
+      const string name = ctc->name();
+      return name.empty() ? ctc_type_str(ctc) + to_string(ctc->id()) : name;
+    }
+
+    const string json_str(const string& str)
+    {
+      string json = "\"";
+      for(const auto& c : str)
+      {
+        if(c == '"' || c == '\\')
+          json += '\\';
+        json += c;
+      }
+      return json + "\"";
+    }
+
+    const string csv_str(const string& str)
+    {
+      string csv = "\"";
+      for(const auto& c : str)
+      {
+        if(c == '"')
+          csv += '"';
+        csv += c;
+      }
+      return csv + "\"";
+    }
+
+    ofstream open_export_file(const string& file_name)
+    {
+      ofstream file(file_name, ios::out);
+      if(!file.is_open())
+        throw Exception(__func__, "unable to create the file " + file_name);
+      file << setprecision(9);
+      return file;
+    }
+  }
+
+  // Public methods
+
+    void ContractorNetwork::enable_profiling(bool enable)
+    {
+      if(enable && !m_profiling)
+        m_profiling_start = chrono::steady_clock::now();
+      m_profiling = enable;
+    }
+
+    void ContractorNetwork::reset_profiling()
+    {
+      m_v_profiled_calls.clear();
+      m_profiling_start = chrono::steady_clock::now();
+
+      for(auto& ctc : m_v_ctc)
+        ctc->reset_stats();
+    }
+
+    const vector<ProfiledCall>& ContractorNetwork::profiled_calls() const
+    {
+      return m_v_profiled_calls;
+    }
+
+    void ContractorNetwork::export_profiling_json(const string& file_name) const
+    {
+      ofstream file = open_export_file(file_name);
+
+      file << "{" << endl;
+      file << "  \"contractors\": [";
+      for(size_t i = 0 ; i < m_v_ctc.size() ; i++)
+      {
+        const Contractor *ctc = m_v_ctc[i];
+        file << (i == 0 ? "" : ",") << endl
+             << "    { \"id\": " << ctc->id()
+             << ", \"name\": " << json_str(ctc_label(ctc))
+             << ", \"type\": " << json_str(ctc_type_str(ctc))
+             << ", \"nb_domains\": " << ctc->domains().size()
+             << ", \"calls\": " << ctc->nb_calls()
+             << ", \"time\": " << ctc->duration()
+             << ", \"mean_time\": " << ctc->cost()
+             << ", \"cumulated_gain\": " << ctc->cumulated_gain() << " }";
+      }
+      file << endl << "  ]," << endl;
+
+      // History of the length of the queue, after each recorded call
+      file << "  \"queue\": [";
+      for(size_t i = 0 ; i < m_v_profiled_calls.size() ; i++)
+      {
+        const ProfiledCall& call = m_v_profiled_calls[i];
+        file << (i == 0 ? "" : ",") << endl
+             << "    [" << call.t_start + call.duration << ", " << call.queue_length << "]";
+      }
+      file << endl << "  ]" << endl;
+      file << "}" << endl;
+    }
+
+    void ContractorNetwork::export_profiling_csv(const string& file_name) const
+    {
+      ofstream file = open_export_file(file_name);
+
+      file << "id,name,type,nb_domains,calls,time,mean_time,cumulated_gain" << endl;
+      for(const auto& ctc : m_v_ctc)
+        file << ctc->id() << ","
+             << csv_str(ctc_label(ctc)) << ","
+             << ctc_type_str(ctc) << ","
+             << ctc->domains().size() << ","
+             << ctc->nb_calls() << ","
+             << ctc->duration() << ","
+             << ctc->cost() << ","
+             << ctc->cumulated_gain() << endl;
+    }
+
+    void ContractorNetwork::export_chrome_trace(const string& file_name) const
+    {
+      ofstream file = open_export_file(file_name);
+
+      // Timestamps of the trace-event format are in microseconds
+      file << "{ \"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+      for(size_t i = 0 ; i < m_v_profiled_calls.size() ; i++)
+      {
+        const ProfiledCall& call = m_v_profiled_calls[i];
+
+        // Complete event, for the call
+        file << (i == 0 ? "" : ",") << endl
+             << "  { \"name\": " << json_str(ctc_label(call.ctc))
+             << ", \"cat\": " << json_str(ctc_type_str(call.ctc))
+             << ", \"ph\": \"X\", \"pid\": 0, \"tid\": " << call.thread_id
+             << ", \"ts\": " << 1e6 * call.t_start
+             << ", \"dur\": " << 1e6 * call.duration
+             << ", \"args\": { \"id\": " << call.ctc->id() << ", \"gain\": " << call.gain << " } },";
+
+        // Counter event, for the length of the queue
+        file << endl
+             << "  { \"name\": \"queue\", \"ph\": \"C\", \"pid\": 0"
+             << ", \"ts\": " << 1e6 * (call.t_start + call.duration)
+             << ", \"args\": { \"length\": " << call.queue_length << " } }";
+      }
+      file << endl << "] }" << endl;
+    }
+
+  // Protected methods
+
+    void ContractorNetwork::record_call(const Contractor *ctc, int thread_id, size_t queue_length)
+    {
+      if(!m_profiling)
+        return;
+
+      ProfiledCall call;
+      call.ctc = ctc;
+      call.thread_id = thread_id;
+      call.t_start = chrono::duration<double>(ctc->m_last_call_start - m_profiling_start).count();
+      call.duration = ctc->m_last_call_duration;
+      call.gain = ctc->gain();
+      call.queue_length = queue_length;
+      m_v_profiled_calls.push_back(call);
+    }
+}
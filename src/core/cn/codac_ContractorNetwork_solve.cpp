@@ -8,7 +8,9 @@
  *              the GNU Lesser General Public License (LGPL).
  */
 
-#include <time.h>
+#include <chrono>
+#include <algorithm>
+#include <unordered_set>
 #include "codac_ContractorNetwork.h"
 #include "codac_Exception.h"
 
@@ -25,55 +27,65 @@ namespace codac
     {
       // Checking existance of remaining variables
       // All of them should be associated to domains
-      for(const auto& dom : m_map_domains)
+      for(const auto& dom : m_v_domains)
       {
-        if(dom.second->is_var_not_associated())
+        if(dom->is_var_not_associated())
           throw Exception(__func__, "some CN variables are not associated to domains");
       }
 
-      clock_t t_start = clock();
-      for(auto& dom : m_map_domains)
-        dom.second->set_volume(dom.second->compute_volume());
+      // Wall-clock time: CPU time would be cumulated over threads in multithreaded mode
+      chrono::steady_clock::time_point t_start = chrono::steady_clock::now();
+      auto elapsed_time = [&t_start]() {
+        return chrono::duration<double>(chrono::steady_clock::now() - t_start).count();
+      };
+
+      for(auto& dom : m_v_domains)
+        dom->set_volume(dom->compute_volume());
 
       if(verbose)
       {
-        cout << "Contractor network has " << m_map_ctc.size()
-             << " contractors and " << m_map_domains.size() << " domains" << endl;
+        cout << "Contractor network has " << m_v_ctc.size()
+             << " contractors and " << m_v_domains.size() << " domains" << endl;
         cout << "Computing, " << nb_ctc_in_stack() << " contractors currently in stack";
         if(!std::isinf(m_contraction_duration_max))
           cout << " during " << m_contraction_duration_max << "s";
+        if(m_nb_threads > 1)
+          cout << " with " << m_nb_threads << " threads";
         cout << endl;
       }
 
-      while(!m_deque.empty()
-        && (double)(clock() - t_start)/CLOCKS_PER_SEC < m_contraction_duration_max)
-      {
-        Contractor *ctc = m_deque.front();
-        m_deque.pop_front();
+      if(m_nb_threads > 1)
+        propagate_parallel(t_start);
 
-        ctc->contract();
-        if(ctc->type() != Contractor::Type::T_CN)
-          ctc->set_active(false); // Sub CN will be always triggered
-        
-        for(auto& ctc_dom : ctc->domains()) // for each domain related to this contractor
-          // If the domain has "changed" after the contraction
-          trigger_ctc_related_to_dom(ctc_dom, ctc);
-      }
+      else
+        while(!m_deque.empty() && elapsed_time() < m_contraction_duration_max)
+        {
+          Contractor *ctc = pop_ctc_from_queue();
+
+          ctc->contract();
+          if(ctc->type() != Contractor::Type::T_CN)
+            ctc->set_active(false); // Sub CN will be always triggered
+          
+          // For each domain related to this contractor,
+          // if the domain has "changed" after the contraction
+          trigger_ctc_related_to_domains(ctc);
+          record_call(ctc, 0, m_deque.size());
+        }
 
       if(verbose)
-        cout << "  Constraint propagation time: " << (double)(clock() - t_start)/CLOCKS_PER_SEC << "s" << endl;
+        cout << "  Constraint propagation time: " << elapsed_time() << "s" << endl;
 
       // Emptiness test
       // todo: test only contracted domains?
       if(verbose)
-        for(const auto& dom : m_map_domains)
-          if(dom.second->is_empty())
+        for(const auto& dom : m_v_domains)
+          if(dom->is_empty())
           {
             cout << "  Warning: empty set" << endl;
             break;
           }
 
-      return (double)(clock() - t_start)/CLOCKS_PER_SEC;
+      return elapsed_time();
     }
 
     double ContractorNetwork::contract(const unordered_map<Domain,Domain>& var_dom, bool verbose)
@@ -99,22 +111,90 @@ namespace codac
     double ContractorNetwork::contract_ordered_mode(bool verbose)
     {
       // todo: reset all saved domains' volumes
-      clock_t t_start = clock();
+      chrono::steady_clock::time_point t_start = chrono::steady_clock::now();
 
       if(verbose)
       {
-        cout << "Contractor network has " << m_map_ctc.size()
-             << " contractors and " << m_map_domains.size() << " domains" << endl;
+        cout << "Contractor network has " << m_v_ctc.size()
+             << " contractors and " << m_v_domains.size() << " domains" << endl;
         cout << "Computing in ordered mode, " << nb_ctc_in_stack() << " contractors currently in stack";
         cout << endl;
       }
 
-      map<DomainHashcode,Domain*> involved_domains;
+      unordered_set<Domain*> involved_domains;
       for(const auto& ctc : m_deque)
         for(const auto& dom : ctc->domains())
-          involved_domains[DomainHashcode(*dom)] = dom;
+          involved_domains.insert(dom);
       assert(!involved_domains.empty());
 
+      // Components are evaluated before the composite domains (tubes, then tube vectors):
+      // the volume of a composite domain is obtained incrementally when all its components
+      // are involved in the propagation, which is the case when its component contractor is
+      vector<Domain*> v_involved_doms(involved_domains.begin(), involved_domains.end());
+      auto rank = [](const Domain *dom) {
+        return dom->type() == Domain::Type::T_TUBE_VECTOR ? 2 : (dom->type() == Domain::Type::T_TUBE ? 1 : 0);
+      };
+      sort(v_involved_doms.begin(), v_involved_doms.end(),
+        [&rank](const Domain *a, const Domain *b) {
+          return rank(a) < rank(b) || (rank(a) == rank(b) && a->id() < b->id());
+        });
+
+      unordered_map<const Domain*,int> nb_involved_components;
+      for(const auto& dom : v_involved_doms)
+        if(dom->m_parent_dom && involved_domains.count(dom->m_parent_dom))
+          nb_involved_components[dom->m_parent_dom]++;
+
+      vector<bool> v_incremental(v_involved_doms.size(), false);
+      for(size_t i = 0 ; i < v_involved_doms.size() ; i++)
+      {
+        const Domain *dom = v_involved_doms[i];
+        if(dom->type() == Domain::Type::T_TUBE)
+          v_incremental[i] = nb_involved_components[dom] == dom->tube().nb_slices();
+        else if(dom->type() == Domain::Type::T_TUBE_VECTOR)
+          v_incremental[i] = nb_involved_components[dom] == dom->tube_vector().size();
+      }
+
+      auto current_volume = [&](size_t i) {
+        return v_incremental[i] ? v_involved_doms[i]->components_volume() : v_involved_doms[i]->compute_volume();
+      };
+
+      // Relative contractions of the involved domains during the last pass
+      unordered_map<const Domain*,double> reductions;
+
+      // Updates the volumes of the involved domains,
+      // returns false if one of them has been significantly contracted
+      auto update_volumes = [&]()
+      {
+        bool fixed_point = true;
+        for(size_t i = 0 ; i < v_involved_doms.size() ; i++)
+        {
+          Domain *dom = v_involved_doms[i];
+          double vol = current_volume(i);
+          fixed_point &= !((vol/dom->get_saved_volume()) < 1.-m_fixedpoint_ratio);
+
+          // Undefined values (volumes not computed, unbounded or empty domains) being ignored
+          double reduction = dom->get_saved_volume() > 0. ? 1. - vol/dom->get_saved_volume() : 0.;
+          reductions[dom] = reduction > 0. ? min(reduction, 1.) : 0.;
+
+          dom->set_volume(vol); // updating old volume
+        }
+        return fixed_point;
+      };
+
+      // The contractors of a pass are recorded once the volumes have been updated:
+      // their gain is the largest relative contraction of their domains during the pass
+      auto record_pass = [&](auto first, auto last)
+      {
+        for(auto it = first ; it != last ; ++it)
+        {
+          double gain = 0.;
+          for(const auto& dom : (*it)->domains())
+            gain = max(gain, reductions[dom]);
+          (*it)->set_gain(gain);
+          record_call(*it, 0, m_deque.size());
+        }
+      };
+
       bool fixed_point;
       m_iteration_nb = 0;
 
@@ -127,8 +207,8 @@ namespace codac
           (*it)->contract();
 
         // Volumes are computed before bwd
-        for(auto& dom : involved_domains)
-          dom.second->set_volume(dom.second->compute_volume());
+        update_volumes();
+        record_pass(m_deque.rbegin(), m_deque.rend());
 
         // Backward: all contractors are called in reverse order
         deque<Contractor*>::iterator rit = m_deque.begin();
@@ -137,27 +217,22 @@ namespace codac
           (*rit)->contract();
 
         // Looking for fixed point
-        fixed_point = true;
-        for(auto& dom : involved_domains)
-        {
-          double current_volume = dom.second->compute_volume();
-          fixed_point &= !((current_volume/dom.second->get_saved_volume()) < 1.-m_fixedpoint_ratio);
-          dom.second->set_volume(current_volume); // updating old volume
-        }
+        fixed_point = update_volumes();
+        record_pass(next(m_deque.begin()), m_deque.end());
 
       } while(!fixed_point);
 
       // Emptiness test
       // todo: test only contracted domains?
       if(verbose)
-        for(const auto& dom : m_map_domains)
-          if(dom.second->is_empty())
+        for(const auto& dom : m_v_domains)
+          if(dom->is_empty())
           {
             cout << "  Warning: empty set" << endl;
             break;
           }
 
-      return (double)(clock() - t_start)/CLOCKS_PER_SEC;
+      return chrono::duration<double>(chrono::steady_clock::now() - t_start).count();
     }
 
     double ContractorNetwork::contract_during(double dt, bool verbose)
@@ -174,38 +249,38 @@ namespace codac
       assert(Interval(0.,1).contains(r) && "invalid ratio");
       m_fixedpoint_ratio = r;
 
-      for(const auto& ctc : m_map_ctc)
-        if(ctc.second->type() == Contractor::Type::T_CN)
-          ctc.second->cn_ctc().set_fixedpoint_ratio(r);
+      for(const auto& ctc : m_v_ctc)
+        if(ctc->type() == Contractor::Type::T_CN)
+          ctc->cn_ctc().set_fixedpoint_ratio(r);
     }
 
     void ContractorNetwork::trigger_all_contractors()
     {
       m_deque.clear();
 
-      for(const auto& ctc : m_map_ctc)
+      for(const auto& ctc : m_v_ctc)
       {
-        if(ctc.second->type() == Contractor::Type::T_IBEX
-          || ctc.second->type() == Contractor::Type::T_CODAC
-          || ctc.second->type() == Contractor::Type::T_EQUALITY)
+        if(ctc->type() == Contractor::Type::T_IBEX
+          || ctc->type() == Contractor::Type::T_CODAC
+          || ctc->type() == Contractor::Type::T_EQUALITY)
         {
           // Only "contracting" contractors are triggered
-          ctc.second->set_active(true);
-          add_ctc_to_queue(ctc.second, m_deque);
+          ctc->set_active(true);
+          add_ctc_to_queue(ctc, m_deque);
         }
 
         else
-          ctc.second->set_active(false);
+          ctc->set_active(false);
       }
     }
 
     void ContractorNetwork::reset_interm_vars()
     {
-      for(auto& dom : m_map_domains)
-        if(dom.second->is_interm_var())
+      for(auto& dom : m_v_domains)
+        if(dom->is_interm_var())
         {
-          reset_value(dom.second);
-          trigger_ctc_related_to_dom(dom.second);
+          reset_value(dom);
+          trigger_ctc_related_to_dom(dom);
         }
 
       trigger_all_contractors();
@@ -222,17 +297,114 @@ namespace codac
       return m_iteration_nb;
     }
 
+    void ContractorNetwork::set_nb_threads(int nb_threads)
+    {
+      assert(nb_threads > 0 && "invalid number of threads");
+      m_nb_threads = nb_threads;
+    }
+
+    int ContractorNetwork::nb_threads() const
+    {
+      return m_nb_threads;
+    }
+
+    void ContractorNetwork::set_scheduling(Scheduling scheduling)
+    {
+      m_scheduling = scheduling;
+
+      // The active contractors are queued again according to the new policy
+      deque<Contractor*> prev_deque;
+      prev_deque.swap(m_deque);
+      for(const auto& ctc : prev_deque)
+        add_ctc_to_queue(ctc, m_deque);
+    }
+
+    ContractorNetwork::Scheduling ContractorNetwork::scheduling() const
+    {
+      return m_scheduling;
+    }
+
   // Protected methods
 
     void ContractorNetwork::add_ctc_to_queue(Contractor *ac, deque<Contractor*>& ctc_deque)
     {
       // todo: propagate for EQUALITY contractors even in case of poor contractions?
 
-      if(ac->type() == Contractor::Type::T_COMPONENT)
-        ctc_deque.push_back(ac);
+      switch(m_scheduling)
+      {
+        case Scheduling::DEFAULT:
+          if(ac->type() == Contractor::Type::T_COMPONENT)
+            ctc_deque.push_back(ac);
+
+          else
+            ctc_deque.push_front(ac); // priority
+          break;
+
+        case Scheduling::FIFO:
+          ctc_deque.push_back(ac);
+          break;
+
+        case Scheduling::LIFO:
+          ctc_deque.push_front(ac);
+          break;
+
+        case Scheduling::PRIORITY:
+        case Scheduling::ROUND_ROBIN:
+        {
+          if(m_scheduling == Scheduling::PRIORITY)
+            // Contractors never called are tried first, so that their behavior is observed
+            ac->m_priority = ac->nb_calls() == 0 ? POS_INFINITY : ac->gain() / max(ac->cost(), 1e-9);
+
+          else
+          {
+            // A tube and its slices (or a tube vector and its components) form a group
+            const Domain *group = ac->domains().empty() ? nullptr : ac->domains()[0];
+            while(group && group->m_parent_dom)
+              group = group->m_parent_dom;
+
+            unsigned long& group_round = m_map_group_rounds[group];
+            group_round = max(group_round, m_round) + 1;
+            ac->m_priority = -(double)group_round;
+          }
+
+          // The queue is a binary heap
+          ac->m_queue_order = m_nb_queued_ctc++;
+          ctc_deque.push_back(ac);
+          push_heap(ctc_deque.begin(), ctc_deque.end(), lower_priority);
+        }
+        break;
+      }
+    }
+
+    Contractor* ContractorNetwork::pop_ctc_from_queue()
+    {
+      assert(!m_deque.empty());
+      Contractor *ctc;
+
+      if(m_scheduling == Scheduling::PRIORITY || m_scheduling == Scheduling::ROUND_ROBIN)
+      {
+        pop_heap(m_deque.begin(), m_deque.end(), lower_priority);
+        ctc = m_deque.back();
+        m_deque.pop_back();
+
+        if(m_scheduling == Scheduling::ROUND_ROBIN)
+          m_round = (unsigned long)(-ctc->m_priority);
+      }
 
       else
-        ctc_deque.push_front(ac); // priority
+      {
+        ctc = m_deque.front();
+        m_deque.pop_front();
+      }
+
+      return ctc;
+    }
+
+    bool ContractorNetwork::lower_priority(const Contractor *a, const Contractor *b)
+    {
+      // Equal priorities: the first queued contractor is taken first
+      return a->m_priority < b->m_priority
+        || (a->m_priority == b->m_priority && a->m_queue_order > b->m_queue_order);
     }
 
     void ContractorNetwork::reset_value(Domain *dom)
@@ -252,23 +424,38 @@ namespace codac
       // todo: }
     }
 
-    void ContractorNetwork::trigger_ctc_related_to_dom(Domain *dom, Contractor *ctc_to_avoid)
+    double ContractorNetwork::trigger_ctc_related_to_dom(Domain *dom, Contractor *ctc_to_avoid, double volume)
     {
-      double current_volume = dom->compute_volume(); // new volume after contraction
+      double current_volume; // new volume after contraction
+
+      if(dom->is_composite() && ctc_to_avoid
+        && ctc_to_avoid->type() == Contractor::Type::T_COMPONENT && ctc_to_avoid->domains()[0] == dom)
+        // Contracted through its components, that have already been triggered:
+        // the volume is the sum of their saved volumes
+        current_volume = dom->components_volume();
+
+      else
+      {
+        current_volume = volume >= 0. ? volume : dom->compute_volume();
+        if(dom->is_composite()) // contracted as a whole
+          dom->m_components_outdated = true;
+      }
 
       if(current_volume/dom->get_saved_volume() < 1.-m_fixedpoint_ratio)
       {
         // We activate each contractor related to these domains, according to graph orientation
 
         // Local deque, for specific order related to this domain
+        // (with the default scheduling, other policies directly order the CN queue)
         deque<Contractor*> ctc_deque;
+        deque<Contractor*>& queue = m_scheduling == Scheduling::DEFAULT ? ctc_deque : m_deque;
 
         for(auto& ctc_of_dom : dom->contractors())
         {
           if(ctc_of_dom != ctc_to_avoid && !ctc_of_dom->is_active())
           {
             ctc_of_dom->set_active(true);
-            add_ctc_to_queue(ctc_of_dom, ctc_deque);
+            add_ctc_to_queue(ctc_of_dom, queue);
           }
         }
 
@@ -277,24 +464,59 @@ namespace codac
           m_deque.push_front(c);
       }
       
+      // Relative contraction, undefined values (unbounded or empty domains) being ignored
+      double reduction = 1. - current_volume/dom->get_saved_volume();
+      reduction = reduction > 0. ? min(reduction, 1.) : 0.;
+
       dom->set_volume(current_volume); // updating old volume
 
       switch(dom->m_type)
       {
         case Domain::Type::T_INTERVAL_VECTOR:
-          for(int j = 0 ; j < dom->interval_vector().size() ; j++)
-          {
-            DomainHashcode hash(Domain::vector_component(*dom,j));
-            assert(m_map_domains.find(hash) != m_map_domains.end() 
-                    && "component of the domain cannot be found in CN");
-            trigger_ctc_related_to_dom(m_map_domains[hash], ctc_to_avoid);
-          }
+          // Components have been referenced when the vector domain was added to the CN
+          assert((int)dom->m_v_components.size() == dom->interval_vector().size()
+                  && "components of the domain cannot be found in CN");
+          for(auto& dom_j : dom->m_v_components)
+            trigger_ctc_related_to_dom(dom_j, ctc_to_avoid);
           break;
 
         default:
           // .
           break;
       }
+
+      return reduction;
+    }
+
+    void ContractorNetwork::trigger_ctc_related_to_domains(Contractor *ctc, const vector<double>& v_volumes)
+    {
+      const vector<Domain*>& v_doms = ctc->domains();
+      assert(v_volumes.empty() || v_volumes.size() == v_doms.size());
+      double gain = 0.; // largest relative contraction among the domains
+
+      // Volume of the ith domain, if already computed
+      auto volume = [&v_volumes](size_t i) { return v_volumes.empty() ? -1. : v_volumes[i]; };
+
+      if(ctc->type() == Contractor::Type::T_COMPONENT && v_doms[0]->is_composite())
+      {
+        // The slices (or tubes) contracted by other contractors have already been
+        // triggered, and their volumes are accounted in the composite domain:
+        // all the components are evaluated only when it has been contracted as a whole
+        if(v_doms[0]->m_components_outdated)
+        {
+          v_doms[0]->m_components_outdated = false;
+          for(size_t i = 1 ; i < v_doms.size() ; i++)
+            gain = max(gain, trigger_ctc_related_to_dom(v_doms[i], ctc, volume(i)));
+        }
+
+        gain = max(gain, trigger_ctc_related_to_dom(v_doms[0], ctc));
+      }
+
+      else
+        for(size_t i = 0 ; i < v_doms.size() ; i++)
+          gain = max(gain, trigger_ctc_related_to_dom(v_doms[i], ctc, volume(i)));
+
+      ctc->set_gain(gain);
     }
 
     void ContractorNetwork::replace_var_by_dom(Domain var, Domain dom)
@@ -303,7 +525,8 @@ namespace codac
       bool var_partially_present_in_graph = false;
 
       DomainHashcode hashcode(var);
-      if(m_map_domains.find(hashcode) == m_map_domains.end())
+      unordered_map<DomainHashcode,Domain*>::const_iterator it_var = m_map_domains.find(hashcode);
+      if(it_var == m_map_domains.end())
       {
         // The variable may not be in the graph..
         var_fully_present_in_graph = false;
@@ -333,7 +556,7 @@ namespace codac
       if(!var_fully_present_in_graph)
         throw Exception(__func__, "unknown variable domain");
 
-      Domain* var_ptr = m_map_domains[hashcode];
+      Domain* var_ptr = it_var->second;
       var_ptr->set_ref_values(dom);
       trigger_ctc_related_to_dom(var_ptr);
 
@@ -341,7 +341,7 @@ namespace codac
   {
     assert(m_type == ad.m_type);
 
-    m_volume = ad.m_volume;
+    set_volume(ad.m_volume);
 
     switch(ad.m_type)
     {
@@ -501,6 +501,40 @@ namespace codac
     return false;
   }
 
+  namespace
+  {
+    double gate_volume(const Interval& gate)
+    {
+      if(gate.is_empty())
+        return 0.;
+      else if(gate.is_unbounded())
+        return 999999.; // todo: manage the unbounded case for fixed point detection
+      else
+        return gate.diam();
+    }
+
+    double slice_volume(const Slice& s)
+    {
+      // A gate shared with a neighbour slice is counted half in each slice,
+      // so that the volumes of the slices sum to the volume of the tube
+      double vol = s.codomain().is_empty() ? 0. : s.volume();
+      vol += (s.prev_slice() ? 0.5 : 1.) * gate_volume(s.input_gate());
+      vol += (s.next_slice() ? 0.5 : 1.) * gate_volume(s.output_gate());
+      return vol;
+    }
+
+    double tube_volume(const Tube& x)
+    {
+      // Volume of the codomain, each gate being counted once. Defined as the sum of the
+      // volumes of the slices, so that it can be updated incrementally from the volumes
+      // of the slice domains of the CN
+      double vol = 0.;
+      for(const Slice *s = x.first_slice() ; s ; s = s->next_slice())
+        vol += slice_volume(*s);
+      return vol;
+    }
+  }
+
   double Domain::compute_volume() const
   {
     switch(m_type)
@@ -519,50 +553,16 @@ namespace codac
         return interval_vector().volume();
 
       case Type::T_SLICE:
-      {
-        double vol = slice().volume();
-
-        // todo: clean the following:
-
-        if(slice().input_gate().is_empty())
-          vol += 0.;
-        else if(slice().input_gate().is_unbounded())
-          vol += 999999.; // todo: manage the unbounded case for fixed point detection
-        else
-          vol += slice().input_gate().diam();
-
-        if(slice().output_gate().is_empty())
-          vol += 0.;
-        else if(slice().output_gate().is_unbounded())
-          vol += 999999.; // todo: manage the unbounded case for fixed point detection
-        else
-          vol += slice().output_gate().diam();
-
-        return vol;
-      }
+        return slice_volume(slice());
 
       case Type::T_TUBE:
-      {
-        double vol = tube().volume();
-        vol += tube().first_slice()->input_gate().diam();
-        for(const Slice *s = tube().first_slice() ; s ; s = s->next_slice())
-          vol += s->output_gate().diam();
-        return vol;
-      }
+        return tube_volume(tube());
 
       case Type::T_TUBE_VECTOR:
       {
-        // todo: improve this
         double vol = 0.;
-
         for(int i = 0 ; i < tube_vector().size() ; i++)
-        {
-          vol += tube_vector()[i].volume();
-          vol += tube_vector()[i].first_slice()->input_gate().diam();
-          for(const Slice *s = tube_vector()[i].first_slice() ; s ; s = s->next_slice())
-            vol += s->output_gate().diam();
-        }
-        
+          vol += tube_volume(tube_vector()[i]);
         return vol;
       }
 
@@ -580,9 +580,55 @@ namespace codac
 
   void Domain::set_volume(double vol)
   {
+    if(m_parent_dom)
+    {
+      // Negative values stand for volumes not computed yet
+      if(m_volume >= 0.)
+      {
+        if(std::isinf(m_volume))
+          m_parent_dom->m_nb_unbounded_components--;
+        else
+          m_parent_dom->m_components_volume -= m_volume;
+      }
+
+      if(vol >= 0.)
+      {
+        if(std::isinf(vol))
+          m_parent_dom->m_nb_unbounded_components++;
+        else
+          m_parent_dom->m_components_volume += vol;
+      }
+    }
+
     m_volume = vol;
   }
 
+  bool Domain::is_composite() const
+  {
+    return m_type == Type::T_TUBE || m_type == Type::T_TUBE_VECTOR;
+  }
+
+  double Domain::components_volume() const
+  {
+    assert(is_composite());
+    return m_nb_unbounded_components > 0 ? POS_INFINITY : m_components_volume;
+  }
+
+  void Domain::set_parent_dom(Domain *parent)
+  {
+    assert(parent && parent->is_composite());
+    assert(!m_parent_dom || m_parent_dom == parent);
+
+    if(m_parent_dom == parent)
+      return;
+
+    // The saved volume of this component is now accounted in the parent
+    double vol = m_volume;
+    m_volume = -1.;
+    m_parent_dom = parent;
+    set_volume(vol);
+  }
+
   bool Domain::is_interm_var() const
   {
     switch(m_type)
@@ -612,7 +658,7 @@ namespace codac
   {
     assert(is_interm_var());
 
-    m_volume = -1.;
+    set_volume(-1.);
     
     switch(m_type)
     {
@@ -917,7 +963,7 @@ namespace codac
     }
   }
   
-  const string Domain::var_name(const map<DomainHashcode,Domain*> m_domains) const
+  const string Domain::var_name(const vector<Domain*>& v_domains) const
   {
     string output_name = m_name;
 
@@ -928,15 +974,15 @@ namespace codac
         // The variable may be a component of a vector one
         case Type::T_INTERVAL:
         case Type::T_TUBE:
-          for(const auto& dom : m_domains) // looking for this possible vector
+          for(const auto& dom : v_domains) // looking for this possible vector
           {
-            if(dom.second != this)
+            if(dom != this)
             {
-              if(dom.second->type() == Type::T_INTERVAL_VECTOR || dom.second->type() == Type::T_TUBE_VECTOR)
+              if(dom->type() == Type::T_INTERVAL_VECTOR || dom->type() == Type::T_TUBE_VECTOR)
               {
                 int component_id = 0;
-                if(is_component_of(*dom.second, component_id))
-                  output_name = dom.second->var_name(m_domains) + std::to_string(component_id+1); // adding component id
+                if(is_component_of(*dom, component_id))
+                  output_name = dom->var_name(v_domains) + std::to_string(component_id+1); // adding component id
               }
             }
           }
@@ -944,14 +990,14 @@ namespace codac
 
         // The variable may be a slice of a tube
         case Type::T_SLICE:
-          for(const auto& dom : m_domains) // looking for this possible vector
+          for(const auto& dom : v_domains) // looking for this possible vector
           {
-            if(dom.second != this && dom.second->type() == Type::T_TUBE)
+            if(dom != this && dom->type() == Type::T_TUBE)
             {
               int slice_id = 0;
-              if(is_slice_of(*dom.second, slice_id))
+              if(is_slice_of(*dom, slice_id))
               {
-                output_name = dom.second->var_name(m_domains) + "^{(" + std::to_string(slice_id+1) + ")}"; // adding slice id
+                output_name = dom->var_name(v_domains) + "^{(" + std::to_string(slice_id+1) + ")}"; // adding slice id
               }
             }
           }
@@ -976,7 +1022,7 @@ namespace codac
           {
             if(dom != this)
             {
-              string dom_var_name = dom->var_name(m_domains);
+              string dom_var_name = dom->var_name(v_domains);
               if(!dom_var_name.empty() && dom_var_name.find("?") == string::npos)
                 output_name += (!output_name.empty() ? "/" : "") + dom_var_name;
             }
@@ -1077,9 +1123,9 @@ namespace codac
     return n;
   }
 
-  const string Domain::dom_name(const map<DomainHashcode,Domain*> m_domains) const
+  const string Domain::dom_name(const vector<Domain*>& v_domains) const
   {
-    string output_name = var_name(m_domains);
+    string output_name = var_name(v_domains);
 
     switch(m_type)
     {
@@ -85,6 +85,9 @@ namespace codac
       double compute_volume() const;
       double get_saved_volume() const;
       void set_volume(double vol);
+      bool is_composite() const;
+      double components_volume() const;
+      void set_parent_dom(Domain *parent);
 
       bool is_interm_var() const;
       void reset_value();
@@ -103,7 +106,7 @@ namespace codac
       void add_data(double t, const Interval& y, ContractorNetwork& cn);
       void add_data(double t, const IntervalVector& y, ContractorNetwork& cn);
 
-      const std::string dom_name(const std::map<DomainHashcode,Domain*> m_domains) const;
+      const std::string dom_name(const std::vector<Domain*>& v_domains) const;
       void set_name(const std::string& name);
 
       static bool all_dyn(const std::vector<Domain>& v_domains);
@@ -119,7 +122,7 @@ namespace codac
     protected:
 
       Domain(Type type, MemoryRef memory_type);
-      const std::string var_name(const std::map<DomainHashcode,Domain*> m_domains) const;
+      const std::string var_name(const std::vector<Domain*>& v_domains) const;
 
       // Theoretical type of domain
 
@@ -177,8 +180,17 @@ namespace codac
       Trajectory m_traj_lb, m_traj_ub;
 
       std::vector<Contractor*> m_v_ctc;
+      std::vector<Domain*> m_v_components; // domains of the components in the CN (vector case), for fast propagations
       double m_volume = -1.;
 
+      // Incremental volume of a composite domain (tube or tube vector), defined from the
+      // saved volumes of its components (slices or tubes), for fast fixed point detections.
+      // The gates shared by two slices are counted half in the volume of each slice.
+      Domain *m_parent_dom = nullptr; // composite domain this one is a component of
+      double m_components_volume = 0.; // sum of the bounded saved volumes of the components
+      int m_nb_unbounded_components = 0;
+      bool m_components_outdated = true; // the domain has been contracted as a whole
+
       std::string m_name;
       int m_dom_id;
 
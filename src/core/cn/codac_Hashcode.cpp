@@ -20,74 +20,79 @@ using namespace ibex;
 namespace codac
 {
   // ContractorHashcode class
+
+  namespace
+  {
+    size_t hash_combine(size_t seed, uintptr_t v)
+    {
+      return seed ^ (std::hash<uintptr_t>()(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+    }
+  }
   
   ContractorHashcode::ContractorHashcode(const Contractor& ctc)
+    : m_type(static_cast<int>(ctc.m_type))
   {
-    if(ctc.m_type == Contractor::Type::T_CN)
+    switch(ctc.m_type)
     {
-      m_ptr = new std::uintptr_t[1];
-      m_ptr[0] = reinterpret_cast<std::uintptr_t>(&ctc.m_cn_ctc.get());
-    }
+      case Contractor::Type::T_CN:
+        m_code = reinterpret_cast<std::uintptr_t>(&ctc.m_cn_ctc.get());
+        break;
 
-    else
-    {
-      m_n = ctc.m_v_domains.size()+1;
-      m_ptr = new std::uintptr_t[m_n];
+      case Contractor::Type::T_EQUALITY:
+        m_code = 0; // todo: check this
+        break;
 
-      for(size_t i = 0 ; i < m_n-1 ; i++)
-        m_ptr[i] = DomainHashcode::uintptr(*ctc.m_v_domains[i]);
+      case Contractor::Type::T_COMPONENT:
+        m_code = 1; // todo: check this
+        break;
+        
+      case Contractor::Type::T_IBEX:
+        m_code = reinterpret_cast<std::uintptr_t>(&ctc.m_static_ctc.get());
+        assert(m_code > 4); // reserved codes
+        break;
 
-      switch(ctc.m_type)
-      {
-        case Contractor::Type::T_EQUALITY:
-          m_ptr[m_n-1] = 0; // todo: check this
-          break;
+      case Contractor::Type::T_CODAC:
 
-        case Contractor::Type::T_COMPONENT:
-          m_ptr[m_n-1] = 1; // todo: check this
-          break;
-          
-        case Contractor::Type::T_IBEX:
-          m_ptr[m_n-1] = reinterpret_cast<std::uintptr_t>(&ctc.m_static_ctc.get());
-          assert(m_ptr[m_n-1] > 4); // reserved codes
-          break;
+        if(typeid(ctc.m_dyn_ctc.get()) == typeid(CtcEval))
+          m_code = 2;
 
-        case Contractor::Type::T_CODAC:
+        else if(typeid(ctc.m_dyn_ctc.get()) == typeid(CtcDeriv))
+          m_code = 3;
 
-          if(typeid(ctc.m_dyn_ctc.get()) == typeid(CtcEval))
-            m_ptr[m_n-1] = 2;
+        else if(typeid(ctc.m_dyn_ctc.get()) == typeid(CtcDist))
+          m_code = 4;
 
-          else if(typeid(ctc.m_dyn_ctc.get()) == typeid(CtcDeriv))
-            m_ptr[m_n-1] = 3;
+        else
+        {
+          m_code = reinterpret_cast<std::uintptr_t>(&ctc.m_dyn_ctc.get());
+          assert(m_code > 4); // reserved codes
+        }
 
-          else if(typeid(ctc.m_dyn_ctc.get()) == typeid(CtcDist))
-            m_ptr[m_n-1] = 4;
+        break;
 
-          else
-          {
-            m_ptr[m_n-1] = reinterpret_cast<std::uintptr_t>(&ctc.m_dyn_ctc.get());
-            assert(m_ptr[m_n-1] > 4); // reserved codes
-          }
+      default:
+        assert(false && "unhandled case");
+    }
 
-          break;
+    if(ctc.m_type != Contractor::Type::T_CN)
+      for(const auto& dom : ctc.m_v_domains)
+        m_v_dom_codes.push_back(DomainHashcode::uintptr(*dom));
 
-        default:
-          assert(false && "unhandled case");
-      }
-    }
+    m_hash = hash_combine(0, m_code);
+    for(const auto& dom_code : m_v_dom_codes)
+      m_hash = hash_combine(m_hash, dom_code);
   }
 
-  bool ContractorHashcode::operator<(const ContractorHashcode& a) const
+  bool ContractorHashcode::operator==(const ContractorHashcode& a) const
   {
-    for(size_t i = 0 ; i < std::min(m_n, a.m_n) ; i++)
-    {
-      if(m_ptr[i] == a.m_ptr[i])
-        continue;
-
-      return m_ptr[i] < a.m_ptr[i];
-    }
+    // Codes frozen at construction, as the hash value
+    return m_hash == a.m_hash && m_code == a.m_code && m_type == a.m_type
+      && m_v_dom_codes == a.m_v_dom_codes;
+  }
 
-    return false;
+  size_t ContractorHashcode::hash() const
+  {
+    return m_hash;
   }
 
   // DomainHashcode class
@@ -102,6 +107,16 @@ namespace codac
     return m_ptr < a.m_ptr;
   }
 
+  bool DomainHashcode::operator==(const DomainHashcode& a) const
+  {
+    return m_ptr == a.m_ptr;
+  }
+
+  size_t DomainHashcode::hash() const
+  {
+    return std::hash<uintptr_t>()(m_ptr);
+  }
+
   uintptr_t DomainHashcode::uintptr(const Domain& dom)
   {
     uintptr_t ptr = 0;
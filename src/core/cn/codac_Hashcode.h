@@ -14,6 +14,7 @@
 
 #include <cstdint>
 #include <cstdlib>
+#include <vector>
 #include <functional>
 
 namespace codac
@@ -21,17 +22,28 @@ namespace codac
   class Domain;
   class Contractor;
   
+  /**
+   * \class ContractorHashcode
+   * \brief Signature of a Contractor (type, related domains), used to detect
+   *        identical contractors in a ContractorNetwork.
+   *
+   * \note The signature is computed at construction: equality and hash value
+   *       do not depend on later changes of the domains of the contractor.
+   */
   class ContractorHashcode
   {
     public:
 
       ContractorHashcode(const Contractor& ctc);
-      bool operator<(const ContractorHashcode& a) const;
+      bool operator==(const ContractorHashcode& a) const;
+      std::size_t hash() const;
 
     protected:
 
-      size_t m_n;
-      std::uintptr_t *m_ptr;
+      int m_type; //!< type of the contractor (Contractor::Type)
+      std::uintptr_t m_code; //!< type of contractor, or pointer to its implementation
+      std::vector<std::uintptr_t> m_v_dom_codes; //!< memory references of the domains
+      std::size_t m_hash; //!< hash value combining the code and the domains
   };
 
   class DomainHashcode
@@ -40,6 +52,8 @@ namespace codac
 
       DomainHashcode(const Domain& dom);
       bool operator<(const DomainHashcode& a) const;
+      bool operator==(const DomainHashcode& a) const;
+      std::size_t hash() const;
 
       static std::uintptr_t uintptr(const Domain& dom);
 
@@ -59,7 +73,24 @@ namespace std
       return codac::DomainHashcode::uintptr(dom);
     }
   };
-}
 
+  template <>
+  struct hash<codac::DomainHashcode>
+  {
+    std::size_t operator()(const codac::DomainHashcode& h) const
+    {
+      return h.hash();
+    }
+  };
+
+  template <>
+  struct hash<codac::ContractorHashcode>
+  {
+    std::size_t operator()(const codac::ContractorHashcode& h) const
+    {
+      return h.hash();
+    }
+  };
+}
 
 #endif
\ No newline at end of file
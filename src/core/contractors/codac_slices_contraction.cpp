@@ -0,0 +1,169 @@
+/**
+ *  Slice-wise contractions on several threads
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <exception>
+#include <functional>
+#include "codac_slices_contraction.h"
+
+using namespace std;
+using namespace ibex;
+
+#define SLICES_CHUNK_SIZE 512
+
+namespace codac
+{
+  int slices_contraction_nb_threads(int nb_threads)
+  {
+    if(nb_threads == 0)
+      nb_threads = thread::hardware_concurrency();
+    return max(1, nb_threads);
+  }
+
+  void contract_slices(Slice **v_x_slices, int n, const vector<Ctc*>& v_ctc,
+                       bool temporal_ctc, const Interval& restricted_tdomain)
+  {
+    assert(n > 0 && !v_ctc.empty());
+    int nb_threads = v_ctc.size();
+    int m = temporal_ctc ? 1 : 0;
+    int dim = n + m;
+
+    // Slices of the tubes, stored slice after slice: v_slices[k*n+i] is the
+    // k-th slice of the i-th tube. Slices out of the restricted tdomain are skipped.
+
+    vector<Slice*> v_slices;
+    vector<bool> v_active;
+
+    for(Slice **s = v_x_slices ; s[0] ; )
+    {
+      v_active.push_back(s[0]->tdomain().intersects(restricted_tdomain));
+      for(int i = 0 ; i < n ; i++)
+      {
+        v_slices.push_back(s[i]);
+        s[i] = s[i]->next_slice();
+      }
+    }
+
+    size_t nb_slices = v_active.size();
+    if(nb_slices == 0)
+      return;
+
+    // Contracted values, computed before any update of the slices
+    vector<Interval> v_envelopes(nb_slices*n), v_ingates(nb_slices*n);
+
+    // An exception raised by a thread stops the computations, and is rethrown at the end
+    exception_ptr exception = nullptr;
+    mutex exception_mutex;
+    atomic<bool> stop(false);
+
+    auto run = [&](const function<void(size_t,IntervalVector&,Ctc&)>& contract_slice)
+    {
+      atomic<size_t> next_chunk(0);
+
+      auto worker = [&](int thread_id)
+      {
+        IntervalVector box(dim);
+
+        try
+        {
+          size_t k0;
+          while(!stop && (k0 = next_chunk.fetch_add(SLICES_CHUNK_SIZE)) < nb_slices)
+            for(size_t k = k0 ; k < min(k0 + SLICES_CHUNK_SIZE, nb_slices) ; k++)
+              if(v_active[k])
+                contract_slice(k, box, *v_ctc[thread_id]);
+        }
+
+        catch(...)
+        {
+          lock_guard<mutex> lock(exception_mutex);
+          if(!exception)
+            exception = current_exception();
+          stop = true;
+        }
+      };
+
+      vector<thread> v_threads;
+      for(int i = 1 ; i < nb_threads ; i++)
+        v_threads.push_back(thread(worker, i));
+      worker(0); // the calling thread takes part in the computations
+      for(auto& t : v_threads)
+        t.join();
+
+      if(exception)
+        rethrow_exception(exception);
+    };
+
+    // Envelopes are contracted independently
+
+    run([&](size_t k, IntervalVector& box, Ctc& ctc)
+    {
+      if(m)
+        box[0] = v_slices[k*n]->tdomain();
+      for(int i = 0 ; i < n ; i++)
+        box[i+m] = v_slices[k*n+i]->codomain();
+
+      ctc.contract(box);
+
+      for(int i = 0 ; i < n ; i++)
+        v_envelopes[k*n+i] = box[i+m];
+    });
+
+    // In the sequential loop, the input gate of a slice has been reduced by the
+    // contracted envelope of the previous slice (shared gate) before its contraction.
+    // This reduction is computed here, from the contracted envelopes of all the slices,
+    // so that the contraction does not depend on the chunks.
+
+    run([&](size_t k, IntervalVector& box, Ctc& ctc)
+    {
+      if(m)
+        box[0] = v_slices[k*n]->tdomain().lb();
+      for(int i = 0 ; i < n ; i++)
+      {
+        box[i+m] = v_slices[k*n+i]->input_gate();
+        if(k > 0 && v_active[k-1])
+          box[i+m] &= v_envelopes[(k-1)*n+i];
+      }
+
+      ctc.contract(box);
+
+      for(int i = 0 ; i < n ; i++)
+        v_ingates[k*n+i] = box[i+m];
+    });
+
+    // Updating the slices in the temporal order, as the sequential loop does
+
+    for(size_t k = 0 ; k < nb_slices ; k++)
+      if(v_active[k])
+        for(int i = 0 ; i < n ; i++)
+        {
+          v_slices[k*n+i]->set_envelope(v_envelopes[k*n+i]);
+          v_slices[k*n+i]->set_input_gate(v_ingates[k*n+i]);
+        }
+
+    if(v_active[nb_slices-1]) // output gate
+    {
+      Slice **v_last_slices = &v_slices[(nb_slices-1)*n];
+      IntervalVector outgate(dim);
+
+      if(m)
+        outgate[0] = v_last_slices[0]->tdomain().ub();
+
+      for(int i = 0 ; i < n ; i++)
+        outgate[i+m] = v_last_slices[i]->output_gate();
+
+      v_ctc[0]->contract(outgate);
+
+      for(int i = 0 ; i < n ; i++)
+        v_last_slices[i]->set_output_gate(outgate[i+m]);
+    }
+  }
+}
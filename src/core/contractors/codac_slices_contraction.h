@@ -0,0 +1,50 @@
+/**
+ *  \file
+ *  Slice-wise contractions on several threads
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __CODAC_SLICES_CONTRACTION_H__
+#define __CODAC_SLICES_CONTRACTION_H__
+
+#include <vector>
+#include "codac_Ctc.h"
+#include "codac_Slice.h"
+
+namespace codac
+{
+  /**
+   * \brief Contracts an array of slices (representing a slice vector) with a static contractor,
+   *        on several threads
+   *
+   * The contractor is applied on each envelope and gate, as the sequential loops
+   * of CtcStatic and CtcFunction do, and the result is exactly the same: the slices are
+   * split into chunks contracted concurrently, and the contracted values are then set
+   * in the slices by the calling thread, in the temporal order.
+   *
+   * \note IBEX contractors are not reentrant: one contractor object is expected for each thread.
+   *
+   * \param v_x_slices the first slices of the tubes to be contracted
+   * \param n the dimension of the array
+   * \param v_ctc the equivalent contractors, one for each thread (the first one is used by the calling thread)
+   * \param temporal_ctc if true, the temporal tdomain is the first dimension of the (n+1) boxes
+   * \param restricted_tdomain slices that do not intersect this tdomain are not contracted
+   */
+  void contract_slices(Slice **v_x_slices, int n, const std::vector<Ctc*>& v_ctc,
+                       bool temporal_ctc = false, const Interval& restricted_tdomain = Interval::ALL_REALS);
+
+  /**
+   * \brief Returns the number of threads to be used for a requested amount
+   *
+   * \param nb_threads requested number of threads (0: number of concurrent threads supported by the hardware)
+   * \return the number of threads, at least 1
+   */
+  int slices_contraction_nb_threads(int nb_threads);
+}
+
+#endif
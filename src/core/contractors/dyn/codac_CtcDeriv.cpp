@@ -21,7 +21,7 @@ namespace codac
   CtcDeriv::CtcDeriv()
     : DynCtc(false)
   {
-
+    m_thread_safe = true; // no internal state is modified by the contractions
   }
 
   // Static members for contractor signature (mainly used for CN Exceptions)
@@ -119,27 +119,130 @@ namespace codac
 
   void CtcDeriv::contract(codac2::Tube<Interval>& x, const codac2::Tube<Interval>& v, TimePropag t_propa)
   {
-    Tube _x = codac2::to_codac1(x);
-    Tube _v = codac2::to_codac1(v);
-    contract(_x,_v,t_propa);
-    x &= codac2::to_codac2(_x);
+    contract_tslices(x, 0, v, 0, t_propa);
   }
 
   void CtcDeriv::contract(codac2::Tube<IntervalVector>& xv, TimePropag t_propa)
   {
-    Tube x = codac2::to_codac1(xv)[0];
-    Tube v = codac2::to_codac1(xv)[1];
-    contract(x,v,t_propa);
-    xv &= codac2::to_codac2(TubeVector({x,v}));
+    assert(xv.size() == 2);
+    contract_tslices(xv, 0, xv, 1, t_propa);
   }
   
   void CtcDeriv::contract(codac2::Tube<IntervalVector>& x, int i, codac2::Tube<IntervalVector>& v, int j, TimePropag t_propa)
   {
-    TubeVector _x = codac2::to_codac1(x);
-    TubeVector _v = codac2::to_codac1(v);
-    contract(_x[i],_v[j],t_propa);
-    x &= codac2::to_codac2(_x);
-    v &= codac2::to_codac2(_v);
+    assert(i >= 0 && (size_t)i < x.size());
+    assert(j >= 0 && (size_t)j < v.size());
+    contract_tslices(x, i, v, j, t_propa);
+  }
+
+  namespace
+  {
+    // Access to the ith component of codac2 slices
+
+    Interval slice_component(const codac2::Slice<Interval>& s, size_t)
+    {
+      return s.codomain();
+    }
+
+    Interval slice_component(const codac2::Slice<IntervalVector>& s, size_t i)
+    {
+      return s.codomain()[i];
+    }
+
+    void set_slice_component(codac2::Slice<Interval>& s, size_t, const Interval& y)
+    {
+      s.set(y);
+    }
+
+    void set_slice_component(codac2::Slice<IntervalVector>& s, size_t i, const Interval& y)
+    {
+      s.set_component(i, y);
+    }
+  }
+
+  template<typename T, typename U>
+  void CtcDeriv::contract_tslices(codac2::Tube<T>& x, size_t i, const codac2::Tube<U>& v, size_t j, TimePropag t_propa)
+  {
+    // Slices of x and v are reached from the same tslices
+    assert(x.tdomain() == v.tdomain());
+
+    list<codac2::TSlice>& tslices = x.tdomain()->tslices();
+
+    auto contract_tslice = [&](const list<codac2::TSlice>::iterator& it)
+    {
+      if(it->is_gate() || it->t0_tf().is_unbounded() || !it->t0_tf().intersects(m_restricted_tdomain))
+        return;
+
+      codac2::Slice<T>& sx = x(it);
+      Interval envelope = slice_component(sx, i);
+
+      // Gates are either explicit (degenerated tslices),
+      // or the intersections with the neighbour slices
+      codac2::Slice<T> *s_in = nullptr, *s_out = nullptr;
+      Interval ingate = envelope, outgate = envelope;
+
+      if(it != tslices.begin())
+      {
+        s_in = &x(std::prev(it));
+        ingate &= slice_component(*s_in, i);
+      }
+
+      if(std::next(it) != tslices.end())
+      {
+        s_out = &x(std::next(it));
+        outgate &= slice_component(*s_out, i);
+      }
+
+      contract(it->t0_tf().diam(), ingate, envelope, outgate, slice_component(v(it), j));
+
+      set_slice_component(sx, i, envelope);
+      if(s_in && s_in->is_gate())
+        set_slice_component(*s_in, i, ingate);
+      if(s_out && s_out->is_gate())
+        set_slice_component(*s_out, i, outgate);
+    };
+
+    if(t_propa & TimePropag::FORWARD)
+      for(list<codac2::TSlice>::iterator it = tslices.begin() ; it != tslices.end() ; ++it)
+        contract_tslice(it);
+
+    if(t_propa & TimePropag::BACKWARD)
+      for(list<codac2::TSlice>::iterator it = tslices.end() ; it != tslices.begin() ; )
+        contract_tslice(--it);
+  }
+
+  void CtcDeriv::contract(double dt, Interval& ingate, Interval& envelope, Interval& outgate, const Interval& v)
+  {
+    // Gates contraction
+    Interval ingate_ = ingate;
+    ingate &= outgate - dt * v;
+    outgate &= ingate_ + dt * v;
+
+    envelope &= ingate + Interval(0.,dt) * v;
+    envelope &= outgate - Interval(0.,dt) * v;
+
+    if(envelope.is_empty() || v.is_unbounded() || v.is_degenerated()
+      || ingate.is_unbounded() || outgate.is_unbounded())
+      return;
+
+    // Optimal envelope: bounding box of the slice polygon (see Slice::polygon()),
+    // reached at the gates or at the intersections of the lines bounding the polygon
+
+    Interval t(0.,dt);
+
+    Interval t_inter_ub = (Interval(outgate.ub()) - ingate.ub() - v.lb() * Interval(dt)) / (Interval(v.ub()) - v.lb());
+    if(t_inter_ub.is_subset(t))
+    {
+      Interval y_inter_ub = Interval(ingate.ub()) + v.ub() * t_inter_ub;
+      envelope &= Interval(NEG_INFINITY, max(max(ingate.ub(), outgate.ub()), y_inter_ub.ub()));
+    }
+
+    Interval t_inter_lb = (Interval(ingate.lb()) - outgate.lb() + v.ub() * Interval(dt)) / (Interval(v.ub()) - v.lb());
+    if(t_inter_lb.is_subset(t))
+    {
+      Interval y_inter_lb = Interval(ingate.lb()) + v.lb() * t_inter_lb;
+      envelope &= Interval(min(min(ingate.lb(), outgate.lb()), y_inter_lb.lb()), POS_INFINITY);
+    }
   }
 
   void CtcDeriv::contract(Slice& x, const Slice& v, TimePropag t_propa)
@@ -101,6 +101,35 @@ namespace codac
        * \param v the derivative slice \f$\llbracket v\rrbracket(\cdot)\f$
        */
       void contract_gates(Slice& x, const Slice& v);
+
+      /**
+       * \brief Contracts the envelope and the gates of a slice given by its bounds,
+       *        regarding its derivative set
+       *
+       * \note Used for codac2 tubes, for which gates are not owned by the slices.
+       *
+       * \param dt the width of the temporal domain of the slice
+       * \param ingate the input gate of the slice
+       * \param envelope the codomain of the slice
+       * \param outgate the output gate of the slice
+       * \param v the derivative codomain over the slice
+       */
+      static void contract(double dt, Interval& ingate, Interval& envelope, Interval& outgate, const Interval& v);
+
+      /**
+       * \brief Contracts in place the ith component of the codac2 tube \f$[\mathbf{x}](\cdot)\f$
+       *        with respect to the jth component of its derivative \f$[\mathbf{v}](\cdot)\f$
+       *
+       * \pre \f$[\mathbf{x}](\cdot)\f$ and \f$[\mathbf{v}](\cdot)\f$ must be defined on the same TDomain.
+       *
+       * \param x the codac2 tube \f$[\mathbf{x}](\cdot)\f$
+       * \param i the component of \f$[\mathbf{x}](\cdot)\f$ to be contracted
+       * \param v the codac2 derivative tube \f$[\mathbf{v}](\cdot)\f$
+       * \param j the component of \f$[\mathbf{v}](\cdot)\f$ to be considered
+       * \param t_propa temporal way of propagation
+       */
+      template<typename T, typename U>
+      void contract_tslices(codac2::Tube<T>& x, size_t i, const codac2::Tube<U>& v, size_t j, TimePropag t_propa);
       
       friend class CtcEval; // contract_gates used by CtcEval
 
@@ -19,7 +19,7 @@ using namespace ibex;
 
 namespace codac
 {
-  IntervalMatrix exp_At(const Matrix& A, const Interval& t) // computes e^At
+  IntervalMatrix CtcLinobs::exp_At(const Matrix& A, const Interval& t) // computes e^At
   {
     assert(A.nb_rows() == 2 && A.nb_cols() == 2);
     IntervalMatrix A_exp(2, 2, Interval::EMPTY_SET);
@@ -243,20 +243,38 @@ namespace codac
   void CtcLinobs::ctc_fwd_gate(ConvexPolygon& p_k, const ConvexPolygon& p_km1,
     double dt_km1_k, const Matrix& A, const Vector& b, const Interval& u_km1)
   {
-    p_k = p_k & (exp_At(A,dt_km1_k)*p_km1 + dt_km1_k*exp_At(A,Interval(0.,dt_km1_k))*(u_km1*b));
+    p_k = p_k & (cached_exp_At(A,dt_km1_k)*p_km1 + dt_km1_k*cached_exp_At(A,Interval(0.,dt_km1_k))*(u_km1*b));
     p_k.simplify(m_polygon_max_edges);
   }
 
   void CtcLinobs::ctc_bwd_gate(ConvexPolygon& p_k, const ConvexPolygon& p_kp1,
     double dt_k_kp1, const Matrix& A, const Vector& b, const Interval& u_k)
   {
-    p_k = p_k & (exp_At(-A,dt_k_kp1)*p_kp1 - dt_k_kp1*exp_At(-A,Interval(0.,dt_k_kp1))*(u_k*b));
+    p_k = p_k & (cached_exp_At(-A,dt_k_kp1)*p_kp1 - dt_k_kp1*cached_exp_At(-A,Interval(0.,dt_k_kp1))*(u_k*b));
     p_k.simplify(m_polygon_max_edges);
   }
 
   ConvexPolygon CtcLinobs::polygon_envelope(const ConvexPolygon& p_k,
     double dt_k_kp1, const Matrix& A, const Vector& b, const Interval& u_k)
   {
-    return exp_At(A,Interval(0.,dt_k_kp1))*p_k + Interval(0.,dt_k_kp1)*exp_At(A,Interval(0.,dt_k_kp1))*(u_k*b);
+    const IntervalMatrix A_exp = cached_exp_At(A,Interval(0.,dt_k_kp1));
+    return A_exp*p_k + Interval(0.,dt_k_kp1)*A_exp*(u_k*b);
+  }
+
+  IntervalMatrix CtcLinobs::cached_exp_At(const Matrix& A, const Interval& t)
+  {
+    assert(A.nb_rows() == 2 && A.nb_cols() == 2);
+    const array<double,6> key = {{ A[0][0], A[0][1], A[1][0], A[1][1], t.lb(), t.ub() }};
+
+    map<array<double,6>,IntervalMatrix>::const_iterator it = m_exp_At_cache.find(key);
+    if(it != m_exp_At_cache.end())
+      return it->second;
+
+    if(m_exp_At_cache.size() >= m_exp_At_cache_max_size)
+      m_exp_At_cache.clear();
+
+    const IntervalMatrix A_exp = exp_At(A,t);
+    m_exp_At_cache.emplace(key, A_exp);
+    return A_exp;
   }
 }
\ No newline at end of file
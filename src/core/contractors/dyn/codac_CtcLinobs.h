@@ -13,6 +13,7 @@
 #define __CODAC_CTCLINOBS_H__
 
 #include <map>
+#include <array>
 #include <vector>
 #include <functional>
 #include "codac_DynCtc.h"
@@ -55,6 +56,8 @@ namespace codac
 
       void ctc_fwd_gate(ConvexPolygon& p_k, const ConvexPolygon& p_km1, double dt_km1_k, const Matrix& A, const Vector& b, const Interval& u_km1);
       void ctc_bwd_gate(ConvexPolygon& p_k, const ConvexPolygon& p_kp1, double dt_k_kp1, const Matrix& A, const Vector& b, const Interval& u_k);
+      static IntervalMatrix exp_At(const Matrix& A, const Interval& t);
+      IntervalMatrix cached_exp_At(const Matrix& A, const Interval& t); // exp_At memoized for the time values repeated over the slices
 
 
     protected:
@@ -64,6 +67,9 @@ namespace codac
 
       const int m_polygon_max_edges = 15;
 
+      std::map<std::array<double,6>,IntervalMatrix> m_exp_At_cache; //!< enclosures of e^At, indexed by the coefficients of A and the bounds of t
+      static const std::size_t m_exp_At_cache_max_size = 1024; //!< bounded memory for tubes with non-uniform slicing
+
       static const std::string m_ctc_name; //!< class name (mainly used for CN Exceptions)
       static std::vector<std::string> m_str_expected_doms; //!< allowed domains signatures (mainly used for CN Exceptions)
       friend class ContractorNetwork;
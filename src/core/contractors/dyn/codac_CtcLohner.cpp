@@ -112,6 +112,15 @@ private:
   Matrix B, Binv;
   Vector u_hat; //!< center of the box u
   const Function *f; //!< litteral function of the system \f$\dot{\mathbf{x}}=\mathbf{f}(\mathbf{x})\f$
+
+  // Temporaries of integrate(), kept between calls to avoid reallocations at each step
+  IntervalVector z1, r1, u1, u_t;
+  Matrix B1, B1inv;
+  Vector u_hat1, m1;
+  const Matrix I; //!< identity matrix of dimension dim
+  IntervalMatrix A;
+  Eigen::MatrixXd Q;
+  Eigen::HouseholderQR<Eigen::MatrixXd> qr;
 };
 
 // --
@@ -133,21 +142,29 @@ LohnerAlgorithm::LohnerAlgorithm(const Function *f,
       B(Matrix::eye(dim)),
       Binv(Matrix::eye(dim)),
       u_hat(u0.mid()),
-      f(f) {}
+      f(f),
+      z1(z), r1(r), u1(u), u_t(u),
+      B1(B), B1inv(Binv),
+      u_hat1(u_hat), m1(u_hat),
+      I(Matrix::eye(dim)),
+      A(dim, dim),
+      Q(dim, dim),
+      qr(dim, dim) {}
 
 const IntervalVector &LohnerAlgorithm::integrate(unsigned int steps, double H) {
   if (H > 0) h = H;
   for (unsigned int i = 0; i < steps; ++i) {
-    auto z1 = z, r1 = r, u1 = u;
-    auto B1 = B, B1inv = Binv;
-    auto u_hat1 = u_hat;
-    IntervalVector u_t = globalEnclosure(u, FWD);
+    z1 = z, r1 = r, u1 = u;
+    B1 = B, B1inv = Binv;
+    u_hat1 = u_hat;
+    u_t = globalEnclosure(u, FWD);
     for (int j = 0; j < contractions; ++j) {
       z1 = 0.5 * h * h * f->jacobian(u_t) * f->eval_vector(u_t);
-      Vector m1 = z1.mid();
-      IntervalMatrix A = Matrix::eye(dim) + h * direction * f->jacobian(u);
-      Eigen::HouseholderQR<Eigen::MatrixXd> qr(EigenHelpers::i2e((A * B).mid()));
-      B1 = EigenHelpers::e2i(qr.householderQ());
+      m1 = z1.mid();
+      A = I + h * direction * f->jacobian(u);
+      qr.compute(EigenHelpers::i2e((A * B).mid())); // decomposition storage is reused
+      Q = qr.householderQ();
+      B1 = EigenHelpers::e2i(Q);
       B1inv = ibex::real_inverse(B1);
       r1 = (B1inv * A * B) * r + B1inv * (z1 - m1);
       u_hat1 = u_hat + h * direction * f->eval_vector(u_hat).mid() + m1;
@@ -199,41 +216,49 @@ void CtcLohner::contract(codac::TubeVector &tube, TimePropag t_propa) {
   assert((!tube.is_empty()) && (tube.size() == dim));
   IntervalVector input_gate(dim, Interval(0)), output_gate(dim, Interval(0)), slice(dim, Interval(0));
   double h;
+  // Slices of all the components are swept in lockstep, without indexed accesses
+  vector<Slice*> v_slices(dim);
   if (t_propa & TimePropag::FORWARD) {
     for (int j = 0; j < dim; ++j) {
-      input_gate[j] = tube[j].slice(0)->input_gate();
+      v_slices[j] = tube[j].first_slice();
+      input_gate[j] = v_slices[j]->input_gate();
     }
     LohnerAlgorithm lo(&m_f, 0.1, true, input_gate, contractions, eps);
     // Forward loop
-    for (int i = 0; i < tube.nb_slices(); ++i) {
-      h = tube[0].slice(i)->tdomain().diam();
+    while (v_slices[0]) {
+      h = v_slices[0]->tdomain().diam();
       for (int j = 0; j < dim; ++j) {
-        output_gate[j] = tube[j].slice(i)->output_gate();
-        slice[j] = tube[j].slice(i)->codomain();
+        output_gate[j] = v_slices[j]->output_gate();
+        slice[j] = v_slices[j]->codomain();
       }
       lo.integrate(1, h);
       lo.contractStep(output_gate);
-      for (int j = 0; j < dim; ++j)
-        tube[j].slice(i)->set_envelope(slice[j] & lo.getGlobalEnclosure()[j]);
+      for (int j = 0; j < dim; ++j) {
+        v_slices[j]->set_envelope(slice[j] & lo.getGlobalEnclosure()[j]);
+        v_slices[j] = v_slices[j]->next_slice();
+      }
     }
     tube.set(output_gate & lo.getLocalEnclosure(), tube.tdomain().ub());
   }
   if (t_propa & TimePropag::BACKWARD) {
     for (int j = 0; j < dim; ++j) {
-      input_gate[j] = tube[j].last_slice()->output_gate();
+      v_slices[j] = tube[j].last_slice();
+      input_gate[j] = v_slices[j]->output_gate();
     }
     LohnerAlgorithm lo2(&m_f, 0.1, false, input_gate, contractions, eps);
     // Backward loop
-    for (int i = tube.nb_slices() - 1; i >= 0; --i) {
-      h = tube[0].slice(i)->tdomain().diam();
+    while (v_slices[0]) {
+      h = v_slices[0]->tdomain().diam();
       for (int j = 0; j < dim; ++j) {
-        output_gate[j] = tube[j].slice(i)->input_gate();
-        slice[j] = tube[j].slice(i)->codomain();
+        output_gate[j] = v_slices[j]->input_gate();
+        slice[j] = v_slices[j]->codomain();
       }
       lo2.integrate(1, h);
       lo2.contractStep(output_gate);
-      for (int j = 0; j < dim; ++j)
-        tube[j].slice(i)->set_envelope(slice[j] & lo2.getGlobalEnclosure()[j]);
+      for (int j = 0; j < dim; ++j) {
+        v_slices[j]->set_envelope(slice[j] & lo2.getGlobalEnclosure()[j]);
+        v_slices[j] = v_slices[j]->prev_slice();
+      }
     }
     tube.set(output_gate & lo2.getLocalEnclosure(), tube.tdomain().lb());
   }
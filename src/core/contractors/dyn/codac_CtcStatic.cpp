@@ -10,6 +10,7 @@
 
 #include "codac_CtcStatic.h"
 #include "codac_DomainsTypeException.h"
+#include "codac_slices_contraction.h"
 
 using namespace std;
 using namespace ibex;
@@ -22,6 +23,23 @@ namespace codac
 
   }
 
+  void CtcStatic::set_nb_threads(int nb_threads, const function<unique_ptr<Ctc>()>& ctc_factory)
+  {
+    nb_threads = slices_contraction_nb_threads(nb_threads);
+
+    m_v_ctc_clones.clear();
+    for(int i = 1 ; i < nb_threads ; i++)
+    {
+      m_v_ctc_clones.push_back(ctc_factory());
+      assert(m_v_ctc_clones.back()->nb_var == m_static_ctc.nb_var);
+    }
+  }
+
+  int CtcStatic::nb_threads() const
+  {
+    return 1 + m_v_ctc_clones.size();
+  }
+
   // Static members for contractor signature (mainly used for CN Exceptions)
   const string CtcStatic::m_ctc_name = "CtcStatic";
   vector<string> CtcStatic::m_str_expected_doms(
@@ -146,6 +164,16 @@ namespace codac
 
   void CtcStatic::contract(Slice **v_x_slices, int n)
   {
+    if(!m_v_ctc_clones.empty())
+    {
+      vector<Ctc*> v_ctc(1, &m_static_ctc);
+      for(const auto& ctc : m_v_ctc_clones)
+        v_ctc.push_back(ctc.get());
+
+      contract_slices(v_x_slices, n, v_ctc, m_temporal_ctc, m_restricted_tdomain);
+      return;
+    }
+
     IntervalVector envelope(n + m_temporal_ctc);
     IntervalVector ingate(n + m_temporal_ctc);
 
@@ -12,6 +12,9 @@
 #ifndef __CODAC_CTCSTATIC_H__
 #define __CODAC_CTCSTATIC_H__
 
+#include <vector>
+#include <memory>
+#include <functional>
 #include "codac_Ctc.h"
 #include "codac_DynCtc.h"
 #include "codac_Domain.h"
@@ -37,6 +40,26 @@ namespace codac
        */
       CtcStatic(Ctc& ibex_ctc, bool temporal_ctc = false);
 
+      /**
+       * \brief Sets the number of threads used for contracting the slices
+       *
+       * The slices are split into chunks that are contracted concurrently. IBEX
+       * contractors are not reentrant: the related static contractor is used by the
+       * calling thread, and one equivalent contractor is created for each other thread
+       * by the `ctc_factory` function. Results are the same as for the sequential contraction.
+       *
+       * \param nb_threads number of threads (0: number of concurrent threads supported by the hardware, 1: sequential contraction)
+       * \param ctc_factory function creating a new contractor equivalent to the IBEX contractor of this object
+       */
+      void set_nb_threads(int nb_threads, const std::function<std::unique_ptr<Ctc>()>& ctc_factory);
+
+      /**
+       * \brief Returns the number of threads used for contracting the slices
+       *
+       * \return number of threads
+       */
+      int nb_threads() const;
+
       /*
        * \brief Contracts a set of abstract domains
        *
@@ -124,6 +147,7 @@ namespace codac
 
       Ctc& m_static_ctc; //!< related static contractor
       int m_temporal_ctc; //!< specifies either the temporal tdomain is part of the constraint or not
+      std::vector<std::unique_ptr<Ctc>> m_v_ctc_clones; //!< contractors of the additional threads
 
       static const std::string m_ctc_name; //!< class name (mainly used for CN Exceptions)
       static std::vector<std::string> m_str_expected_doms; //!< allowed domains signatures (mainly used for CN Exceptions)
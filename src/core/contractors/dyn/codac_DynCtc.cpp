@@ -45,4 +45,9 @@ namespace codac
   {
     return m_intertemporal;
   }
+
+  bool DynCtc::is_thread_safe() const
+  {
+    return m_thread_safe;
+  }
 }
\ No newline at end of file
@@ -113,12 +113,22 @@ namespace codac
        */
       bool is_intertemporal() const;
 
+      /**
+       * \brief Tests if the contractor can be called concurrently on disjoint domains
+       *
+       * \note Used by the multithreaded propagation of a ContractorNetwork
+       *
+       * \return `true` if concurrent calls are safe
+       */
+      bool is_thread_safe() const;
+
     protected:
 
       bool m_preserve_slicing = true; //!< if `true`, tube's slicing will not be affected by the contractor
       bool m_fast_mode = false; //!< some contractors may propose more pessimistic but faster execution modes
       Interval m_restricted_tdomain; //!< limits the contractions to the specified temporal domain
       const bool m_intertemporal = true; //!< defines if the related constraint is inter-temporal or not (true by default)
+      bool m_thread_safe = false; //!< defines if concurrent calls on disjoint domains are safe (false by default)
   };
 }
 
@@ -9,6 +9,7 @@
  */
 
 #include "codac_CtcFunction.h"
+#include "codac_slices_contraction.h"
 
 using namespace std;
 using namespace ibex;
@@ -39,6 +40,25 @@ namespace codac
     // todo: clean delete
   }
 
+  void CtcFunction::set_nb_threads(int nb_threads)
+  {
+    nb_threads = slices_contraction_nb_threads(nb_threads);
+
+    m_v_ctc_clones.clear(); // contractors refer to the functions
+    m_v_f_clones.clear();
+
+    for(int i = 1 ; i < nb_threads ; i++)
+    {
+      m_v_f_clones.push_back(unique_ptr<Function>(new Function(f)));
+      m_v_ctc_clones.push_back(unique_ptr<CtcFwdBwd>(new CtcFwdBwd(*m_v_f_clones.back(), d)));
+    }
+  }
+
+  int CtcFunction::nb_threads() const
+  {
+    return 1 + m_v_ctc_clones.size();
+  }
+
   void CtcFunction::contract(IntervalVector& x)
   {
     assert(x.size() == nb_var);
@@ -214,6 +234,16 @@ namespace codac
 
   void CtcFunction::contract(Slice **v_x_slices)
   {
+    if(!m_v_ctc_clones.empty())
+    {
+      vector<Ctc*> v_ctc(1, this);
+      for(const auto& ctc : m_v_ctc_clones)
+        v_ctc.push_back(ctc.get());
+
+      contract_slices(v_x_slices, nb_var, v_ctc);
+      return;
+    }
+
     IntervalVector envelope(nb_var);
     IntervalVector ingate(nb_var);
 
@@ -13,6 +13,8 @@
 #define __CODAC_CTCFUNCTION_H__
 
 #include <string>
+#include <vector>
+#include <memory>
 #include "codac_Function.h"
 #include "ibex_CtcFwdBwd.h"
 #include "ibex_Domain.h"
@@ -63,6 +65,24 @@ namespace codac
        * \param y the IntervalVector \f$[\mathbf{y}]\f$
        */
       CtcFunction(const Function& f, const IntervalVector& y);
+
+      /**
+       * \brief Sets the number of threads used for contracting the slices of tubes
+       *
+       * The slices are split into chunks that are contracted concurrently, each
+       * thread with its own copy of the contractor. Results are the same as
+       * for the sequential contraction.
+       *
+       * \param nb_threads number of threads (0: number of concurrent threads supported by the hardware, 1: sequential contraction)
+       */
+      void set_nb_threads(int nb_threads);
+
+      /**
+       * \brief Returns the number of threads used for contracting the slices of tubes
+       *
+       * \return number of threads
+       */
+      int nb_threads() const;
       
       /**
        * \brief \f$\mathcal{C}\big([\mathbf{x}]\big)\f$
@@ -201,6 +221,11 @@ namespace codac
        * \param v_x_slices the slices to be contracted
        */
       void contract(Slice **v_x_slices);
+
+    protected:
+
+      std::vector<std::unique_ptr<Function>> m_v_f_clones; //!< functions of the contractors of the additional threads
+      std::vector<std::unique_ptr<ibex::CtcFwdBwd>> m_v_ctc_clones; //!< contractors of the additional threads
   };
 }
 
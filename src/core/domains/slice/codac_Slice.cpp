@@ -22,17 +22,15 @@ namespace codac
     // Definition
 
     Slice::Slice(const Interval& tdomain, const Interval& codomain)
-      : m_tdomain(tdomain), m_codomain(codomain)
+      : Slice(tdomain, codomain, nullptr)
     {
-      assert(valid_tdomain(tdomain));
-      m_input_gate = new Interval(codomain);
-      m_output_gate = new Interval(codomain);
+
     }
 
     Slice::Slice(const Slice& x)
-      : Slice(x.tdomain(), x.codomain()) // in order to instantiate gates
+      : Slice(x, nullptr)
     {
-      *this = x;
+
     }
 
     Slice::~Slice()
@@ -42,8 +40,8 @@ namespace codac
       if(m_next_slice) m_next_slice->m_prev_slice = nullptr;
 
       // Gates are deleted if not shared with other slices
-      if(m_prev_slice == nullptr) delete m_input_gate;
-      if(m_next_slice == nullptr) delete m_output_gate;
+      if(m_prev_slice == nullptr) delete_gate(m_input_gate);
+      if(m_next_slice == nullptr) delete_gate(m_output_gate);
     }
 
     int Slice::size() const
@@ -539,6 +537,46 @@ namespace codac
 
 
   // Protected methods
+
+    // Definition
+
+    Slice::Slice(const Interval& tdomain, const Interval& codomain, SliceArena *arena)
+      : m_tdomain(tdomain), m_codomain(codomain), m_arena(arena)
+    {
+      assert(valid_tdomain(tdomain));
+      m_input_gate = new_gate(codomain);
+      m_output_gate = new_gate(codomain);
+    }
+
+    Slice::Slice(const Slice& x, SliceArena *arena)
+      : Slice(x.tdomain(), x.codomain(), arena) // in order to instantiate gates
+    {
+      *this = x;
+    }
+
+    Interval* Slice::new_gate(const Interval& x) const
+    {
+      if(m_arena)
+        return m_arena->new_gate(x);
+      return new Interval(x);
+    }
+
+    void Slice::delete_gate(Interval *&gate) const
+    {
+      if(m_arena)
+        m_arena->delete_gate(gate);
+      else
+        delete gate;
+      gate = nullptr;
+    }
+
+    void Slice::delete_slice(Slice *s)
+    {
+      if(s->m_arena)
+        s->m_arena->delete_slice(s);
+      else
+        delete s;
+    }
     
     void Slice::set_tdomain(const Interval& tdomain)
     {
@@ -590,12 +628,12 @@ namespace codac
       first_slice->set_tdomain(first_slice->tdomain() | second_slice->tdomain());
 
       // Deleting objects after fusion
-      first_slice->m_output_gate = new Interval(second_slice->output_gate());
+      first_slice->m_output_gate = first_slice->new_gate(second_slice->output_gate());
 
       second_slice->m_prev_slice = nullptr;
       second_slice->m_next_slice = nullptr;
-      delete second_slice; // will destroy both input/output gates because
-                           // pointers to neighbor slices have been set to nullptr
+      delete_slice(second_slice); // will destroy both input/output gates because
+                                  // pointers to neighbor slices have been set to nullptr
 
       // Chaining slices
       first_slice->m_next_slice = next_slice_after_merge;
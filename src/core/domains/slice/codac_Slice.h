@@ -18,6 +18,7 @@
 #include "codac_ConvexPolygon.h"
 #include "codac_TubeTreeSynthesis.h"
 #include "codac_BoolInterval.h"
+#include "codac_SliceArena.h"
 
 namespace codac
 {
@@ -617,6 +618,45 @@ namespace codac
 
     protected:
 
+      /**
+       * \brief Creates a slice \f$\llbracket x\rrbracket\f$, possibly in the memory arena of a tube
+       *
+       * \param tdomain Interval temporal domain \f$[t^k_0,t^k_f]\f$
+       * \param codomain Interval value of the slice
+       * \param arena pointer to the SliceArena of the gates, or nullptr for heap allocations
+       */
+      Slice(const Interval& tdomain, const Interval& codomain, SliceArena *arena);
+
+      /**
+       * \brief Creates a copy of the slice \f$\llbracket x\rrbracket\f$, possibly in the memory arena of a tube
+       *
+       * \param x Slice to be duplicated
+       * \param arena pointer to the SliceArena of the gates, or nullptr for heap allocations
+       */
+      Slice(const Slice& x, SliceArena *arena);
+
+      /**
+       * \brief Creates a gate, from the same memory as this slice
+       *
+       * \param x value of the gate
+       * \return a pointer to the new gate
+       */
+      Interval* new_gate(const Interval& x) const;
+
+      /**
+       * \brief Deletes a gate created by new_gate() and sets its pointer to nullptr
+       *
+       * \param gate pointer to the gate, possibly nullptr
+       */
+      void delete_gate(Interval *&gate) const;
+
+      /**
+       * \brief Deletes a slice, from the memory it has been created with
+       *
+       * \param s pointer to the Slice object
+       */
+      static void delete_slice(Slice *s);
+
       /**
        * \brief Specifies the temporal domain \f$[t_0,t_f]\f$ of this slice
        *
@@ -671,11 +711,15 @@ namespace codac
         Interval *m_input_gate = nullptr, *m_output_gate = nullptr; //!< input and output gates
         Slice *m_prev_slice = nullptr, *m_next_slice = nullptr; //!< pointers to previous and next slices of the related tube
         mutable TubeTreeSynthesis *m_synthesis_reference = nullptr; //!< pointer to a leaf of the optional synthesis tree of the related tube
+        SliceArena *m_arena = nullptr; //!< memory of the slice and of its gates, nullptr if allocated on the heap
 
       friend class Tube;
+      friend class SliceArena;
       friend class TubeTreeSynthesis;
       friend class CtcEval;
       friend void deserialize_Tube(std::ifstream& bin_file, Tube *&tube);
+      friend void deserialize_Tube(int nb_slices, const double *t,
+        const double *y_lb, const double *y_ub, const double *g_lb, const double *g_ub, Tube *&tube);
   };
 }
 
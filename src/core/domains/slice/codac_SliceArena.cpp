@@ -0,0 +1,107 @@
+/**
+ *  SliceArena class
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <new>
+#include "codac_SliceArena.h"
+#include "codac_Slice.h"
+
+using namespace std;
+using namespace ibex;
+
+namespace codac
+{
+  // Public methods
+
+    SliceArena::SliceArena()
+    {
+
+    }
+
+    SliceArena::~SliceArena()
+    {
+
+    }
+
+    void SliceArena::reserve(size_t n)
+    {
+      m_slices.reserve(n);
+      // Each slice allocates two gates before sharing its input gate with its
+      // previous slice: the released gate is reused by the next slice
+      m_gates.reserve(n + 1);
+    }
+
+    Slice* SliceArena::new_slice(const Interval& tdomain, const Interval& codomain)
+    {
+      return new (m_slices.allocate()) Slice(tdomain, codomain, this);
+    }
+
+    Slice* SliceArena::new_slice(const Slice& x)
+    {
+      return new (m_slices.allocate()) Slice(x, this);
+    }
+
+    void SliceArena::delete_slice(Slice *s)
+    {
+      assert(s && s->m_arena == this);
+      s->~Slice();
+      m_slices.deallocate(s);
+    }
+
+    Interval* SliceArena::new_gate(const Interval& x)
+    {
+      return new (m_gates.allocate()) Interval(x);
+    }
+
+    void SliceArena::delete_gate(Interval *gate)
+    {
+      if(gate)
+      {
+        gate->~Interval();
+        m_gates.deallocate(gate);
+      }
+    }
+
+    void SliceArena::release(Slice *first_slice)
+    {
+      // Each gate is destroyed once: the input gate of the first slice,
+      // then the output gates of all the slices
+      if(first_slice)
+        first_slice->m_input_gate->~Interval();
+
+      Slice *s = first_slice;
+      while(s)
+      {
+        assert(s->m_arena == this);
+        Slice *next_slice = s->m_next_slice;
+
+        s->m_output_gate->~Interval();
+        s->m_input_gate = nullptr;
+        s->m_output_gate = nullptr;
+
+        // The slice is unchained, so that its destructor has no side effect
+        s->m_prev_slice = nullptr;
+        s->m_next_slice = nullptr;
+        if(next_slice)
+          next_slice->m_prev_slice = nullptr;
+
+        s->~Slice();
+        s = next_slice;
+      }
+
+      // Memory blocks are released without any bookkeeping
+      m_slices.clear();
+      m_gates.clear();
+    }
+
+    size_t SliceArena::nb_blocks() const
+    {
+      return m_slices.nb_blocks() + m_gates.nb_blocks();
+    }
+}
@@ -0,0 +1,218 @@
+/**
+ *  \file
+ *  SliceArena class
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __CODAC_SLICEARENA_H__
+#define __CODAC_SLICEARENA_H__
+
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include "codac_Interval.h"
+
+namespace codac
+{
+  class Slice;
+
+  /**
+   * \class SlabPool
+   * \brief Storage of objects of type T in large memory blocks (slabs)
+   *
+   * Consecutive allocations are contiguous in memory, unless some
+   * released locations are available for reuse. Objects are not
+   * constructed nor destroyed by the pool.
+   *
+   * \note Member functions are only instantiated where T is complete.
+   */
+  template<typename T>
+  class SlabPool
+  {
+    public:
+
+      SlabPool() { }
+      SlabPool(const SlabPool&) = delete;
+      SlabPool& operator=(const SlabPool&) = delete;
+
+      ~SlabPool()
+      {
+        clear();
+      }
+
+      /**
+       * \brief Ensures that the n next allocations will be contiguous
+       *        in memory, if no released location is available
+       *
+       * \param n number of objects
+       */
+      void reserve(std::size_t n)
+      {
+        if(n > m_available)
+          new_block(n);
+      }
+
+      T* allocate()
+      {
+        if(!m_v_released.empty())
+        {
+          T *ptr = m_v_released.back();
+          m_v_released.pop_back();
+          return ptr;
+        }
+
+        if(m_available == 0) // geometric growth of the blocks
+          new_block(m_v_blocks.empty() ? 16 : std::min<std::size_t>(2 * m_last_block_size, 4096));
+
+        m_available--;
+        return m_next++;
+      }
+
+      void deallocate(T *ptr)
+      {
+        m_v_released.push_back(ptr);
+      }
+
+      /**
+       * \brief Releases all the memory blocks at once
+       *
+       * \note Objects still located in the blocks must have been destroyed before
+       */
+      void clear()
+      {
+        for(auto& block : m_v_blocks)
+          ::operator delete(block);
+        m_v_blocks.clear();
+        m_v_released.clear();
+        m_next = nullptr;
+        m_available = 0;
+        m_last_block_size = 0;
+      }
+
+      std::size_t nb_blocks() const
+      {
+        return m_v_blocks.size();
+      }
+
+    protected:
+
+      void new_block(std::size_t n)
+      {
+        // The remaining locations of the current block are lost until clear()
+        m_next = static_cast<T*>(::operator new(n * sizeof(T)));
+        m_v_blocks.push_back(m_next);
+        m_available = n;
+        m_last_block_size = n;
+      }
+
+      std::vector<void*> m_v_blocks; //!< memory blocks, allocated once for several objects
+      std::vector<T*> m_v_released; //!< released locations, available for reuse
+      T *m_next = nullptr; //!< next free location in the last block
+      std::size_t m_available = 0; //!< number of free locations in the last block
+      std::size_t m_last_block_size = 0;
+  };
+
+  /**
+   * \class SliceArena
+   * \brief Memory of the Slice objects of a Tube, and of their gates
+   *
+   * Each tube owns its arena: slices and gates are allocated in contiguous
+   * blocks, which limits the number of system allocations and improves
+   * the locality of the slices during the iterations on the tube.
+   * The whole memory is released at once when the tube is destroyed.
+   */
+  class SliceArena
+  {
+    public:
+
+      /**
+       * \brief Creates an empty arena
+       */
+      SliceArena();
+
+      SliceArena(const SliceArena&) = delete;
+      SliceArena& operator=(const SliceArena&) = delete;
+
+      /**
+       * \brief SliceArena destructor
+       *
+       * \note The slices must have been destroyed before, see release()
+       */
+      ~SliceArena();
+
+      /**
+       * \brief Prepares the contiguous allocation of n slices and of their gates
+       *
+       * \param n number of slices to be created
+       */
+      void reserve(std::size_t n);
+
+      /**
+       * \brief Creates a slice \f$\llbracket x\rrbracket\f$ in this arena
+       *
+       * \param tdomain Interval temporal domain \f$[t^k_0,t^k_f]\f$
+       * \param codomain Interval value of the slice (all reals \f$[-\infty,\infty]\f$ by default)
+       * \return a pointer to the new slice
+       */
+      Slice* new_slice(const Interval& tdomain, const Interval& codomain = Interval::ALL_REALS);
+
+      /**
+       * \brief Creates a copy of the slice \f$\llbracket x\rrbracket\f$ in this arena
+       *
+       * \param x Slice to be duplicated
+       * \return a pointer to the new slice
+       */
+      Slice* new_slice(const Slice& x);
+
+      /**
+       * \brief Destroys a slice created by this arena
+       *
+       * \param s pointer to the Slice object
+       */
+      void delete_slice(Slice *s);
+
+      /**
+       * \brief Creates a gate in this arena
+       *
+       * \param x value of the gate
+       * \return a pointer to the new gate
+       */
+      Interval* new_gate(const Interval& x);
+
+      /**
+       * \brief Destroys a gate created by this arena
+       *
+       * \param gate pointer to the Interval object, possibly nullptr
+       */
+      void delete_gate(Interval *gate);
+
+      /**
+       * \brief Destroys at once the chain of slices starting from first_slice,
+       *        together with their gates, and releases the memory of the arena
+       *
+       * \note All the objects of the arena are expected to belong to this chain
+       *
+       * \param first_slice pointer to the first Slice object of the chain, possibly nullptr
+       */
+      void release(Slice *first_slice);
+
+      /**
+       * \brief Returns the number of memory blocks allocated by this arena
+       *
+       * \return the number of blocks
+       */
+      std::size_t nb_blocks() const;
+
+    protected:
+
+      SlabPool<Slice> m_slices; //!< storage of the slices
+      SlabPool<Interval> m_gates; //!< storage of the gates
+  };
+}
+
+#endif
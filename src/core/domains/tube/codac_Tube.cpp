@@ -8,6 +8,7 @@
  *              the GNU Lesser General Public License (LGPL).
  */
 
+#include <algorithm>
 #include "codac_Tube.h"
 #include "codac_Exception.h"
 #include "codac_CtcDeriv.h"
@@ -21,6 +22,24 @@ using namespace ibex;
 
 namespace codac
 {
+  namespace
+  {
+    // Tests if the values of a slice may intersect [y], knowing its derivative:
+    // cheap test performed before the polygon inversion of the slice
+
+    bool may_intersect(const Slice& x, const Slice& v, const Interval& y)
+    {
+      if(x.codomain().is_empty()) // the inversion of the slice is its tdomain
+        return true;
+
+      Interval dt(0., x.tdomain().diam());
+      Interval reachable = x.codomain()
+        & (x.input_gate() + dt * v.codomain())
+        & (x.output_gate() - dt * v.codomain());
+      return reachable.intersects(y);
+    }
+  }
+
   // Public methods
 
     // Definition
@@ -35,7 +54,7 @@ namespace codac
       assert(valid_tdomain(tdomain));
 
       // By default, the tube is defined as one single slice
-      m_first_slice = new Slice(tdomain, codomain);
+      m_v_slices.push_back(m_arena.new_slice(tdomain, codomain));
       
       // Redundant information for fast access
       m_tdomain = tdomain;
@@ -55,22 +74,25 @@ namespace codac
       if(timestep == 0.)
         timestep = tdomain.diam();
 
+      size_t nb_slices = (size_t)std::ceil(tdomain.diam() / timestep);
+      m_v_slices.reserve(nb_slices);
+      m_arena.reserve(nb_slices); // slices and gates will be contiguous
+
       do
       {
         lb = ub; // we guarantee all slices are adjacent
         ub = std::min(lb + timestep, tdomain.ub()); // the tdomain of the last slice may be smaller
 
-        slice = new Slice(Interval(lb,ub));
+        slice = m_arena.new_slice(Interval(lb,ub));
 
         if(prev_slice)
         {
-          delete slice->m_input_gate;
-          slice->m_input_gate = nullptr;
+          slice->delete_gate(slice->m_input_gate);
           Slice::chain_slices(prev_slice, slice);
         }
 
         prev_slice = slice;
-        if(m_first_slice == nullptr) m_first_slice = slice;
+        m_v_slices.push_back(slice);
         slice = slice->next_slice();
 
       } while(ub < tdomain.ub());
@@ -105,8 +127,13 @@ namespace codac
         tube_tdomain |= v_tdomains[i];
       }
 
-      m_first_slice = new Slice(tube_tdomain, Interval::ALL_REALS);
-      Slice *s = m_first_slice;
+      // Redundant information for fast access
+      m_tdomain = tube_tdomain;
+
+      m_v_slices.reserve(v_tdomains.size());
+      m_arena.reserve(v_tdomains.size());
+      m_v_slices.push_back(m_arena.new_slice(tube_tdomain, Interval::ALL_REALS));
+      Slice *s = first_slice();
 
       for(size_t i = 0 ; i < v_tdomains.size() ; i++)
       {
@@ -114,9 +141,6 @@ namespace codac
         s->set_envelope(v_codomains[i]);
         s = s->next_slice();
       }
-      
-      // Redundant information for fast access
-      m_tdomain = tube_tdomain;
     }
 
     Tube::Tube(const Tube& x)
@@ -171,13 +195,8 @@ namespace codac
       delete_synthesis_tree();
       delete_polynomial_synthesis();
 
-      Slice *slice = first_slice();
-      while(slice)
-      {
-        Slice *next_slice = slice->next_slice();
-        delete slice;
-        slice = next_slice;
-      }
+      // Bulk destruction of the slices and gates
+      m_arena.release(first_slice());
     }
 
     int Tube::size() const
@@ -199,43 +218,36 @@ namespace codac
     {
       // Destroying already existing structure
 
-        Slice *prev_slice, *slice = first_slice();
-        while(slice)
-        {
-          Slice *next_slice = slice->next_slice();
-          delete slice;
-          slice = next_slice;
-        }
-
         delete_synthesis_tree();
         delete_polynomial_synthesis();
+        m_arena.release(first_slice());
+        m_v_slices.clear();
       
       // Creating new structure
 
-        prev_slice = nullptr; slice = nullptr;
+        Slice *prev_slice = nullptr, *slice = nullptr;
+        m_v_slices.reserve(x.nb_slices());
+        m_arena.reserve(x.nb_slices()); // the copy is made in one contiguous block
 
         for(const Slice *s = x.first_slice() ; s ; s = s->next_slice())
         {
           if(slice == nullptr)
-          {
-            slice = new Slice(*s);
-            m_first_slice = slice;
-          }
+            slice = m_arena.new_slice(*s);
 
           else
           {
-            slice->m_next_slice = new Slice(*s);
+            slice->m_next_slice = m_arena.new_slice(*s);
             slice = slice->next_slice();
           }
 
           if(prev_slice)
           {
-            delete slice->m_input_gate;
-            slice->m_input_gate = nullptr;
+            slice->delete_gate(slice->m_input_gate);
             Slice::chain_slices(prev_slice, slice);
           }
 
           prev_slice = slice;
+          m_v_slices.push_back(slice);
         }
 
         // Redundant information for fast access
@@ -318,16 +330,7 @@ namespace codac
 
     int Tube::nb_slices() const
     {
-      if(m_synthesis_mode == SynthesisMode::BINARY_TREE) // fast evaluation
-        return m_synthesis_tree->nb_slices();
-      
-      else
-      {
-        int size = 0;
-        for(const Slice *s = first_slice() ; s ; s = s->next_slice())
-          size ++;
-        return size;
-      }
+      return static_cast<int>(m_v_slices.size());
     }
 
     Slice* Tube::slice(int slice_id)
@@ -337,25 +340,10 @@ namespace codac
 
     const Slice* Tube::slice(int slice_id) const
     {
-      if(slice_id < 0 && slice_id >= nb_slices())
+      if(slice_id < 0 || slice_id >= nb_slices())
         return nullptr;
 
-      if(m_synthesis_mode == SynthesisMode::BINARY_TREE) // fast access
-        return m_synthesis_tree->slice(slice_id);
-      
-      else
-      {
-        int i = 0;
-
-        for(const Slice *s = first_slice() ; s ; s = s->next_slice())
-        {
-          if(i == slice_id)
-            return s;
-          i++;
-        }
-
-        return nullptr;
-      }
+      return m_v_slices[slice_id];
     }
 
     Slice* Tube::slice(double t)
@@ -368,22 +356,7 @@ namespace codac
       if(!tdomain().contains(t))
         return nullptr;
 
-      if(m_synthesis_mode == SynthesisMode::BINARY_TREE) // fast evaluation
-        return m_synthesis_tree->slice(t);
-      
-      else
-      {
-        const Slice *last_s = nullptr;
-        for(const Slice *s = first_slice() ; s ; s = s->next_slice())
-        {
-          if(t < s->tdomain().ub())
-            return s;
-          last_s = s;
-        }
-        
-        assert(last_s);
-        return last_s;
-      }
+      return m_v_slices[time_to_index(t)];
     }
 
     Slice* Tube::first_slice()
@@ -393,7 +366,9 @@ namespace codac
 
     const Slice* Tube::first_slice() const
     {
-      return m_first_slice;
+      if(m_v_slices.empty())
+        return nullptr;
+      return m_v_slices.front();
     }
 
     Slice* Tube::last_slice()
@@ -403,16 +378,9 @@ namespace codac
 
     const Slice* Tube::last_slice() const
     {
-      if(m_synthesis_mode == SynthesisMode::BINARY_TREE) // fast evaluation
-        return m_synthesis_tree->slice(nb_slices() - 1);
-      
-      else
-      {
-        for(const Slice *s = first_slice() ; true ; s = s->next_slice())
-          if(s->next_slice() == nullptr)
-            return s;
+      if(m_v_slices.empty())
         return nullptr;
-      }
+      return m_v_slices.back();
     }
 
     Slice* Tube::wider_slice()
@@ -492,34 +460,28 @@ namespace codac
     {
       assert(tdomain().contains(t));
 
-      if(m_synthesis_mode == SynthesisMode::BINARY_TREE) // fast evaluation
-        return m_synthesis_tree->time_to_index(t);
-      
-      else
-      {
-        int i = -1;
-        for(const Slice *s = first_slice() ; s ; s = s->next_slice())
-        {
-          i++;
-          if(t < s->tdomain().ub())
-            return i;
-        }
+      // Binary search of the first slice such that t < ub,
+      // the last slice being returned for t = tdomain().ub()
+      vector<Slice*>::const_iterator it = upper_bound(m_v_slices.begin(), m_v_slices.end(), t,
+        [](double t_, const Slice *s) { return t_ < s->tdomain().ub(); });
 
-        return i;
-      }
+      if(it == m_v_slices.end())
+        return nb_slices() - 1;
+      return static_cast<int>(it - m_v_slices.begin());
     }
 
     int Tube::index(const Slice* slice) const
     {
-      int i = 0;
-      const Slice *it = first_slice();
-      while(it && it != slice)
-      {
-        it = it->next_slice();
-        if(it == nullptr) return -1;
-        i++;
-      }
-      return i;
+      if(slice == nullptr)
+        return -1;
+
+      // Binary search on the lower bounds of the slices
+      vector<Slice*>::const_iterator it = lower_bound(m_v_slices.begin(), m_v_slices.end(), slice->tdomain().lb(),
+        [](const Slice *s, double t_) { return s->tdomain().lb() < t_; });
+
+      if(it == m_v_slices.end() || *it != slice)
+        return -1;
+      return static_cast<int>(it - m_v_slices.begin());
     }
 
     void Tube::sample(double t)
@@ -544,22 +506,28 @@ namespace codac
 
       else
       {
-        delete_synthesis_tree(); // todo: update tree if created, instead of delete
         delete_polynomial_synthesis(); // todo: update tree if created, instead of delete
 
+        int slice_id = index(slice_to_be_sampled);
+        assert(slice_id != -1 && "the slice does not belong to this tube");
         Slice *next_slice = slice_to_be_sampled->next_slice();
 
         // Creating new slice
-        Slice *new_slice = new Slice(*slice_to_be_sampled);
+        Slice *new_slice = m_arena.new_slice(*slice_to_be_sampled);
         new_slice->set_tdomain(Interval(t, slice_to_be_sampled->tdomain().ub()));
         slice_to_be_sampled->set_tdomain(Interval(slice_to_be_sampled->tdomain().lb(), t));
 
         // Updated slices structure
-        delete new_slice->m_input_gate;
-        new_slice->m_input_gate = nullptr;
+        new_slice->delete_gate(new_slice->m_input_gate);
         Slice::chain_slices(new_slice, next_slice);
         Slice::chain_slices(slice_to_be_sampled, new_slice);
+
+        // The leaf of the sampled slice is split in the synthesis tree
+        if(m_synthesis_mode == SynthesisMode::BINARY_TREE)
+          slice_to_be_sampled->m_synthesis_reference->split(new_slice);
+
         new_slice->set_input_gate(new_slice->codomain());
+        m_v_slices.insert(m_v_slices.begin() + slice_id + 1, new_slice);
       }
     }
 
@@ -567,7 +535,6 @@ namespace codac
     {
       assert(tdomain().contains(t));
 
-      delete_synthesis_tree(); // todo: update tree if created, instead of delete
       delete_polynomial_synthesis(); // todo: update tree if created, instead of delete
 
       sample(t);
@@ -599,8 +566,10 @@ namespace codac
       Slice *s2 = slice(t);
       assert(s2->tdomain().lb() == t && "the gate must already exist");
       Slice *s1 = s2->prev_slice();
+      int s2_id = index(s2);
 
       Slice::merge_slices(s1, s2);
+      m_v_slices.erase(m_v_slices.begin() + s2_id);
     }
 
     void Tube::merge_similar_slices(double distance_threshold)
@@ -616,6 +585,8 @@ namespace codac
       
         s2 = next_slice;
       }
+
+      index_slices(first_slice());
     }
 
     // Accessing values
@@ -803,12 +774,8 @@ namespace codac
 
     void Tube::invert(const Interval& y, vector<Interval> &v_t, const Interval& search_tdomain) const
     {
-      // todo: optimize this:
-      // todo: fast inversion with binary tree considering derivative information
       v_t.clear();
 
-      // todo: tree computations
-
       if(search_tdomain.is_empty())
         return;
 
@@ -818,11 +785,21 @@ namespace codac
         return;
       }
 
+      // Slices that are not listed have an empty inversion
+      vector<int> v_slices_ids;
+      invert_slices(y, v_slices_ids, search_tdomain);
+
       Interval invert = Interval::EMPTY_SET;
 
-      const Slice *s_x = slice(search_tdomain.lb());
-      while(s_x && s_x->tdomain().lb() <= search_tdomain.ub())
+      for(size_t i = 0 ; i < v_slices_ids.size() ; i++)
       {
+        if(i > 0 && v_slices_ids[i] != v_slices_ids[i-1] + 1 && !invert.is_empty())
+        {
+          v_t.push_back(invert);
+          invert.set_empty();
+        }
+
+        const Slice *s_x = slice(v_slices_ids[i]);
         Interval local_invert = s_x->invert(y, search_tdomain & s_x->tdomain());
         if(local_invert.is_empty() && !invert.is_empty())
         {
@@ -832,8 +809,6 @@ namespace codac
 
         else
           invert |= local_invert;
-
-        s_x = s_x->next_slice();
       }
 
       if(!invert.is_empty())
@@ -851,17 +826,16 @@ namespace codac
       else if(search_tdomain.lb() < tdomain().lb() || search_tdomain.ub() > tdomain().ub())
         return Interval::all_reals();
 
-      // todo: tree computations
+      vector<int> v_slices_ids;
+      invert_slices(y, v_slices_ids, search_tdomain);
 
       Interval invert = Interval::EMPTY_SET;
 
-      const Slice *s_x = slice(search_tdomain.lb());
-      const Slice *s_v = v.slice(search_tdomain.lb());
-      while(s_x && s_x->tdomain().lb() < search_tdomain.ub())
+      for(int k : v_slices_ids)
       {
-        invert |= s_x->invert(y, *s_v, search_tdomain & s_x->tdomain());
-        s_x = s_x->next_slice();
-        s_v = s_v->next_slice();
+        const Slice *s_x = slice(k), *s_v = v.slice(k);
+        if(s_x->tdomain().lb() < search_tdomain.ub() && may_intersect(*s_x, *s_v, y))
+          invert |= s_x->invert(y, *s_v, search_tdomain & s_x->tdomain());
       }
 
       return invert;
@@ -873,8 +847,6 @@ namespace codac
       assert(same_slicing(*this, v));
       v_t.clear();
 
-      // todo: tree computations
-
       if(search_tdomain.is_empty())
         return;
 
@@ -884,13 +856,26 @@ namespace codac
         return;
       }
 
+      // Slices that are not listed, or that cannot reach [y] according
+      // to the derivative, have an empty inversion
+      vector<int> v_slices_ids;
+      invert_slices(y, v_slices_ids, search_tdomain);
+
       Interval invert = Interval::EMPTY_SET;
 
-      const Slice *s_x = slice(search_tdomain.lb());
-      const Slice *s_v = v.slice(search_tdomain.lb());
-      while(s_x && s_x->tdomain().lb() <= search_tdomain.ub())
+      for(size_t i = 0 ; i < v_slices_ids.size() ; i++)
       {
-        Interval local_invert = s_x->invert(y, *s_v, search_tdomain & s_x->tdomain());
+        if(i > 0 && v_slices_ids[i] != v_slices_ids[i-1] + 1 && !invert.is_empty())
+        {
+          v_t.push_back(invert);
+          invert.set_empty();
+        }
+
+        const Slice *s_x = slice(v_slices_ids[i]), *s_v = v.slice(v_slices_ids[i]);
+        Interval local_invert = Interval::EMPTY_SET;
+        if(may_intersect(*s_x, *s_v, y)) // before the polygon inversion
+          local_invert = s_x->invert(y, *s_v, search_tdomain & s_x->tdomain());
+
         if(local_invert.is_empty() && !invert.is_empty())
         {
           v_t.push_back(invert);
@@ -899,9 +884,6 @@ namespace codac
 
         else
           invert |= local_invert;
-
-        s_x = s_x->next_slice();
-        s_v = s_v->next_slice();
       }
 
       if(!invert.is_empty())
@@ -1251,26 +1233,28 @@ namespace codac
       assert(tdomain().is_superset(t));
 
       // The first slice is the slice containing t.lb()
-      while(!m_first_slice->tdomain().contains(t.lb()) || (t & m_first_slice->tdomain()).is_degenerated())
+      Slice *s_first = first_slice();
+      while(!s_first->tdomain().contains(t.lb()) || (t & s_first->tdomain()).is_degenerated())
       {
-        Slice *s_next = m_first_slice->next_slice();
-        delete m_first_slice;
-        m_first_slice = s_next;
+        Slice *s_next = s_first->next_slice();
+        Slice::delete_slice(s_first);
+        s_first = s_next;
       }
 
-      m_first_slice->set_tdomain(t & m_first_slice->tdomain());
+      s_first->set_tdomain(t & s_first->tdomain());
 
       // After this iteration, the last slice will be the one containing t.ub()
       Slice *s_last = last_slice();
       while(!s_last->tdomain().contains(t.ub()) || (t & s_last->tdomain()).is_degenerated())
       {
         Slice *s_prev = s_last->prev_slice();
-        delete s_last;
+        Slice::delete_slice(s_last);
         s_last = s_prev;
       }
 
       s_last->set_tdomain(t & s_last->tdomain());
 
+      index_slices(s_first);
       m_tdomain = t;
       delete_synthesis_tree(); // todo: update tree if created, instead of delete
       delete_polynomial_synthesis(); // todo: update tree if created, instead of delete
@@ -1286,6 +1270,25 @@ namespace codac
       delete_polynomial_synthesis();
     }
 
+    void Tube::extend_tdomain(double t, const Interval& codomain)
+    {
+      assert(t > tdomain().ub());
+
+      Slice *prev_last_slice = last_slice();
+      Slice *s = m_arena.new_slice(Interval(tdomain().ub(), t), codomain);
+      s->delete_gate(s->m_input_gate);
+      Slice::chain_slices(prev_last_slice, s); // the output gate of the last slice is shared
+      m_v_slices.push_back(s);
+
+      m_tdomain = Interval(m_tdomain.lb(), t);
+
+      // The leaf of the previous last slice is split in the synthesis tree
+      if(m_synthesis_mode == SynthesisMode::BINARY_TREE)
+        prev_last_slice->m_synthesis_reference->split(s);
+
+      delete_polynomial_synthesis();
+    }
+
     // Bisection
     
     const pair<Tube,Tube> Tube::bisect(double t, float ratio) const
@@ -1595,16 +1598,47 @@ namespace codac
       bin_file.close();
     }
 
+    // Slices index
+
+    void Tube::invert_slices(const Interval& y, vector<int>& v_slices_ids, const Interval& search_tdomain) const
+    {
+      assert(tdomain().is_superset(search_tdomain));
+      v_slices_ids.clear();
+
+      // Slices from the one covering search_tdomain.lb(),
+      // to the last one starting before search_tdomain.ub()
+      int k0 = time_to_index(search_tdomain.lb());
+      int kf = time_to_index(search_tdomain.ub());
+
+      if(m_synthesis_mode == SynthesisMode::BINARY_TREE
+        && m_synthesis_tree->nb_slices() == nb_slices()) // tree up to date with the sampling
+      {
+        Interval t(slice(k0)->tdomain().lb(), slice(kf)->tdomain().ub());
+        m_synthesis_tree->invert(y, v_slices_ids, t);
+      }
+
+      else
+      {
+        v_slices_ids.reserve(kf - k0 + 1);
+        for(int k = k0 ; k <= kf ; k++)
+          v_slices_ids.push_back(k);
+      }
+    }
+
+    void Tube::index_slices(Slice *first_slice)
+    {
+      m_v_slices.clear();
+      for(Slice *s = first_slice ; s ; s = s->next_slice())
+        m_v_slices.push_back(s);
+    }
+
     // Synthesis tree
     
     void Tube::create_synthesis_tree() const
     {
       delete_synthesis_tree();
 
-      vector<const Slice*> v_slices;
-      for(const Slice* s = first_slice() ; s ; s = s->next_slice())
-        v_slices.push_back(s);
-
+      vector<const Slice*> v_slices(m_v_slices.begin(), m_v_slices.end());
       m_synthesis_tree = new TubeTreeSynthesis(this, 0, nb_slices() - 1, v_slices);
       m_synthesis_mode = SynthesisMode::BINARY_TREE;
     }
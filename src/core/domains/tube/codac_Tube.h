@@ -16,6 +16,7 @@
 #include <list>
 #include <vector>
 #include "codac_TFnc.h"
+#include "codac_SliceArena.h"
 #include "codac_Slice.h"
 #include "codac_Trajectory.h"
 #include "codac_serialize_tubes.h"
@@ -232,6 +233,8 @@ namespace codac
       /**
        * \brief Returns the number of slices of this tube
        *
+       * \note Constant time: the number of slices is cached
+       *
        * \return an integer
        */
       int nb_slices() const;
@@ -365,6 +368,8 @@ namespace codac
       /**
        * \brief Returns the Slice index related to the temporal key \f$t\f$
        *
+       * \note Binary search on the slices bounds, in \f$\mathcal{O}(\log n)\f$
+       *
        * \param t the temporal key (double, must belong to the Tube's tdomain)
        * \return an integer
        */
@@ -837,6 +842,18 @@ namespace codac
        */
       void shift_tdomain(double a);
 
+      /**
+       * \brief Extends the tdomain \f$[t_0,t_f]\f$ of \f$[x](\cdot)\f$ by appending a slice
+       *        \f$\llbracket x\rrbracket([t_f,t])\f$
+       *
+       * \note The complexity is amortized constant: the tube can be built
+       *       incrementally, for instance from a stream of data
+       *
+       * \param t the new upper bound of the tdomain, greater than \f$t_f\f$
+       * \param codomain Interval value of the new slice and of its output gate
+       */
+      void extend_tdomain(double t, const Interval& codomain = Interval::ALL_REALS);
+
       /// @}
       /// \name Bisection
       /// @{
@@ -1201,6 +1218,28 @@ namespace codac
        */
       void delete_synthesis_tree() const;
 
+      /**
+       * \brief Computes the indices of the slices involved in an inversion \f$[x]^{-1}([y])\f$
+       *
+       * \note Slices whose values cannot intersect \f$[y]\f$ are skipped thanks to the
+       *       synthesis tree, if enabled: the complexity is then \f$\mathcal{O}(k\log(n))\f$
+       *       for \f$k\f$ involved slices. Otherwise, all the slices of search_tdomain are listed.
+       *
+       * \param y the interval codomain
+       * \param v_slices_ids the indices of the slices, in temporal order
+       * \param search_tdomain the temporal domain of the inversion, subset of the tdomain
+       */
+      void invert_slices(const Interval& y, std::vector<int>& v_slices_ids, const Interval& search_tdomain) const;
+
+      /**
+       * \brief Rebuilds the index of slices from the chain starting at first_slice
+       *
+       * \note To be called after structural changes on the slices (merging, truncation)
+       *
+       * \param first_slice a pointer to the first Slice object of this tube
+       */
+      void index_slices(Slice *first_slice);
+
       /**
        * \brief Creates the synthesis tree associated to the values of this tube
        *
@@ -1217,13 +1256,16 @@ namespace codac
 
       // Class variables:
 
-        Slice *m_first_slice = nullptr; //!< pointer to the first Slice object of this tube
+        SliceArena m_arena; //!< memory of the slices and gates of this tube
+        std::vector<Slice*> m_v_slices; //!< contiguous index of the (chained) Slice objects of this tube, for fast access
         mutable TubeTreeSynthesis *m_synthesis_tree = nullptr; //!< pointer to the optional synthesis tree
         mutable TubePolynomialSynthesis *m_polynomial_synthesis = nullptr; //!< pointer to the optional synthesis tree
         mutable SynthesisMode m_synthesis_mode = SynthesisMode::NONE; //!< enables of the use of a synthesis tree
         Interval m_tdomain; //!< redundant information for fast evaluations
 
       friend void deserialize_Tube(std::ifstream& bin_file, Tube *&tube);
+      friend void deserialize_Tube(int nb_slices, const double *t,
+        const double *y_lb, const double *y_ub, const double *g_lb, const double *g_ub, Tube *&tube);
       friend void deserialize_TubeVector(std::ifstream& bin_file, TubeVector *&tube);
       friend class TubeVector;
       friend class CtcEval;
@@ -15,10 +15,19 @@ using namespace ibex;
 
 namespace codac
 {
+  // Balance factor of the tree: the tree is locally rebuilt when the
+  // number of slices of a subtree exceeds this ratio of its parent's
+  #define TREE_SYNTHESIS_BALANCE 0.7
+
   TubeTreeSynthesis::TubeTreeSynthesis(const Tube* tube, int k0, int kf, const vector<const Slice*>& v_tube_slices)
     : m_tube_ref(tube), m_parent(nullptr)
   {
     assert(tube);
+    build(k0, kf, v_tube_slices);
+  }
+
+  void TubeTreeSynthesis::build(int k0, int kf, const vector<const Slice*>& v_tube_slices)
+  {
     assert(k0 >= 0 && k0 < (int)v_tube_slices.size()); // todo: use size_t
     assert(kf >= 0 && kf < (int)v_tube_slices.size()); // todo: use size_t
 
@@ -40,12 +49,12 @@ namespace codac
       m_nb_slices = kf - k0 + 1;
       int kmid = k0 + ceil(m_nb_slices / 2.) - 1;
 
-      m_first_subtree = new TubeTreeSynthesis(tube, k0, kmid, v_tube_slices);
+      m_first_subtree = new TubeTreeSynthesis(m_tube_ref, k0, kmid, v_tube_slices);
       m_first_subtree->m_parent = this;
 
       if(kmid + 1 <= kf)
       {
-        m_second_subtree = new TubeTreeSynthesis(tube, kmid + 1, kf, v_tube_slices);
+        m_second_subtree = new TubeTreeSynthesis(m_tube_ref, kmid + 1, kf, v_tube_slices);
         m_second_subtree->m_parent = this;
       }
 
@@ -136,6 +145,31 @@ namespace codac
     }
   }
   
+  void TubeTreeSynthesis::invert(const Interval& y, vector<int>& v_slices_ids, const Interval& t, int k0)
+  {
+    // Collects, in temporal order, the indices of the slices covering t whose
+    // values (envelope or gates) may intersect y: subtrees outside t,
+    // or whose codomain bounds are disjoint from y, are skipped.
+    // Subtrees containing an empty slice are kept: its inversion is its tdomain.
+    // k0 is the index of the first slice of this subtree.
+
+    if(m_tdomain.ub() <= t.lb() || m_tdomain.lb() >= t.ub())
+      return;
+
+    pair<Interval,Interval> bounds = codomain_bounds();
+    if(!m_with_empty_slice && !y.intersects(codomain() | bounds.first | bounds.second))
+      return;
+
+    if(is_leaf())
+      v_slices_ids.push_back(k0);
+
+    else
+    {
+      m_first_subtree->invert(y, v_slices_ids, t, k0);
+      m_second_subtree->invert(y, v_slices_ids, t, k0 + m_first_subtree->nb_slices());
+    }
+  }
+
   const Interval TubeTreeSynthesis::codomain()
   {
     if(m_values_update_needed)
@@ -232,7 +266,8 @@ namespace codac
 
     else
     {
-      int mid_id = ceil(nb_slices() / 2.);
+      // The tree may not be perfectly balanced after some samplings
+      int mid_id = m_first_subtree->nb_slices();
 
       if(slice_id < mid_id)
         return m_first_subtree->slice(slice_id);
@@ -265,6 +300,81 @@ namespace codac
     }
   }
 
+  void TubeTreeSynthesis::split(const Slice *new_slice)
+  {
+    assert(is_leaf());
+    assert(new_slice && m_slice_ref->next_slice() == new_slice);
+    assert(m_tdomain == (m_slice_ref->tdomain() | new_slice->tdomain())
+      || (!new_slice->next_slice() && m_tdomain == m_slice_ref->tdomain()));
+
+    // The leaf becomes a node of two leaves: the sampled slice and the new one,
+    // that may also extend the tdomain when appended at the end of the tube
+    const vector<const Slice*> v_slices { m_slice_ref, new_slice };
+    m_slice_ref = nullptr;
+    build(0, 1, v_slices);
+
+    for(TubeTreeSynthesis *node = m_parent ; node ; node = node->m_parent)
+    {
+      node->m_nb_slices++;
+      node->m_tdomain |= m_tdomain;
+    }
+
+    request_values_update();
+    request_integrals_update(false);
+
+    // The subtree of lowest level that is no more balanced is rebuilt,
+    // so that the depth of the tree remains logarithmic (scapegoat tree)
+    int n = root()->nb_slices();
+    if(depth() + 1 > log(n) / log(1. / TREE_SYNTHESIS_BALANCE))
+    {
+      TubeTreeSynthesis *node = this;
+      while(node->m_parent
+        && max(node->m_first_subtree->nb_slices(), node->m_second_subtree->nb_slices())
+          <= TREE_SYNTHESIS_BALANCE * node->nb_slices())
+        node = node->m_parent;
+      node->rebuild();
+    }
+  }
+
+  void TubeTreeSynthesis::rebuild()
+  {
+    assert(!is_leaf());
+
+    vector<const Slice*> v_slices;
+    v_slices.reserve(m_nb_slices);
+    collect_slices(v_slices);
+
+    delete m_first_subtree;
+    delete m_second_subtree;
+    build(0, (int)v_slices.size() - 1, v_slices);
+
+    // The values of this node are unchanged, but its new subtrees have to be computed
+    m_values_update_needed = false;
+    m_integrals_update_needed = false;
+    request_values_update();
+    request_integrals_update(false);
+  }
+
+  void TubeTreeSynthesis::collect_slices(vector<const Slice*>& v_slices) const
+  {
+    if(is_leaf())
+      v_slices.push_back(m_slice_ref);
+
+    else
+    {
+      m_first_subtree->collect_slices(v_slices);
+      m_second_subtree->collect_slices(v_slices);
+    }
+  }
+
+  int TubeTreeSynthesis::depth() const
+  {
+    int d = 0;
+    for(const TubeTreeSynthesis *node = m_parent ; node ; node = node->m_parent)
+      d++;
+    return d;
+  }
+
   void TubeTreeSynthesis::request_values_update()
   {
     if(m_values_update_needed)
@@ -331,6 +441,7 @@ namespace codac
         m_codomain_bounds.first |= m_slice_ref->output_gate().lb();
         m_codomain_bounds.second |= m_slice_ref->input_gate().ub();
         m_codomain_bounds.second |= m_slice_ref->output_gate().ub();
+        m_with_empty_slice = m_codomain.is_empty();
         m_values_update_needed = false;
       }
 
@@ -343,6 +454,7 @@ namespace codac
         pair<Interval,Interval> p_first = m_first_subtree->m_codomain_bounds;
         pair<Interval,Interval> p_second = m_second_subtree->m_codomain_bounds;
         m_codomain_bounds = make_pair(p_first.first | p_second.first, p_first.second | p_second.second);
+        m_with_empty_slice = m_first_subtree->m_with_empty_slice || m_second_subtree->m_with_empty_slice;
 
         m_values_update_needed = false;
       }
@@ -351,7 +463,7 @@ namespace codac
 
   void TubeTreeSynthesis::update_integrals()
   {
-    if(m_values_update_needed)
+    if(m_integrals_update_needed)
     {
       // 1. Updating leafs values (leaf nodes)
 
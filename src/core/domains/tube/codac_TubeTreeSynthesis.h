@@ -26,6 +26,7 @@ namespace codac
       int nb_slices() const;
       const Interval operator()(const Interval& t);
       const Interval invert(const Interval& y, const Interval& search_tdomain);
+      void invert(const Interval& y, std::vector<int>& v_slices_ids, const Interval& t, int k0 = 0);
       const Interval codomain();
       const std::pair<Interval,Interval> codomain_bounds();
       const std::pair<Interval,Interval> eval(const Interval& t = Interval::ALL_REALS);
@@ -40,6 +41,8 @@ namespace codac
       bool is_root() const;
       TubeTreeSynthesis* root();
 
+      void split(const Slice *new_slice);
+
       void request_values_update();
       void request_integrals_update(bool propagate_to_other_slices = true);
       void update_values();
@@ -49,6 +52,11 @@ namespace codac
 
     protected:
 
+      void build(int k0, int kf, const std::vector<const Slice*>& v_tube_slices);
+      void rebuild();
+      void collect_slices(std::vector<const Slice*>& v_slices) const;
+      int depth() const;
+
       // Slices connections
       const Slice *m_slice_ref = nullptr;
       const Tube *m_tube_ref = nullptr;
@@ -61,6 +69,7 @@ namespace codac
       Interval m_tdomain, m_codomain;
       std::pair<Interval,Interval> m_codomain_bounds;
       std::pair<Interval,Interval> m_partial_primitive;
+      bool m_with_empty_slice = false; // one of the slices of the subtree has an empty codomain
 
       bool m_integrals_update_needed = true;
       bool m_values_update_needed = true;
@@ -851,6 +851,19 @@ namespace codac
         (*this)[i].shift_tdomain(shift_ref);
     }
 
+    void TubeVector::extend_tdomain(double t, const IntervalVector& codomain)
+    {
+      assert(size() == codomain.size());
+      for(int i = 0 ; i < size() ; i++)
+        (*this)[i].extend_tdomain(t, codomain[i]);
+    }
+
+    void TubeVector::extend_tdomain(double t)
+    {
+      for(int i = 0 ; i < size() ; i++)
+        (*this)[i].extend_tdomain(t);
+    }
+
     // Bisection
     
     const pair<TubeVector,TubeVector> TubeVector::bisect(double t, float ratio) const
@@ -780,6 +780,23 @@ namespace codac
        */
       void shift_tdomain(double a);
 
+      /**
+       * \brief Extends the tdomain \f$[t_0,t_f]\f$ of \f$[\mathbf{x}](\cdot)\f$ by appending
+       *        a slice to each component, see Tube::extend_tdomain()
+       *
+       * \param t the new upper bound of the tdomain, greater than \f$t_f\f$
+       * \param codomain IntervalVector value of the new slices and of their output gates
+       */
+      void extend_tdomain(double t, const IntervalVector& codomain);
+
+      /**
+       * \brief Extends the tdomain \f$[t_0,t_f]\f$ of \f$[\mathbf{x}](\cdot)\f$ by appending
+       *        a slice to each component, see Tube::extend_tdomain()
+       *
+       * \param t the new upper bound of the tdomain, greater than \f$t_f\f$
+       */
+      void extend_tdomain(double t);
+
       /// @}
       /// \name Bisection
       /// @{
@@ -1204,6 +1221,7 @@ namespace codac
         Tube *m_v_tubes = nullptr; //!< array of components (scalar tubes)
 
       friend void deserialize_TubeVector(std::ifstream& bin_file, TubeVector *&tube);
+      friend class MappedTubeFile;
   };
 }
 
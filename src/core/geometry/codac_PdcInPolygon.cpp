@@ -24,6 +24,7 @@ PdcInPolygon::PdcInPolygon(vector< vector< vector<double> > > &points) : Pdc(2)
         bx[i] = points[i][1][0];
         by[i] = points[i][1][1];
     }
+    edge_grid = unique_ptr<PolygonEdgeGrid>(new PolygonEdgeGrid(ax, ay, bx, by));
 }
 
 PdcInPolygon::PdcInPolygon(vector< vector<double> > &vertices) : Pdc(2) {
@@ -37,6 +38,7 @@ PdcInPolygon::PdcInPolygon(vector< vector<double> > &vertices) : Pdc(2) {
         bx[i] = vertices[(i+1) % n_vertices][0];
         by[i] = vertices[(i+1) % n_vertices][1];
     }
+    edge_grid = unique_ptr<PolygonEdgeGrid>(new PolygonEdgeGrid(ax, ay, bx, by));
 }
 
 PdcInPolygon::PdcInPolygon(vector<double> &_ax, vector<double> &_ay, vector<double> &_bx, vector<double> &_by) : Pdc(2),
@@ -44,6 +46,11 @@ PdcInPolygon::PdcInPolygon(vector<double> &_ax, vector<double> &_ay, vector<doub
             ay(_ay),
             bx(_bx),
             by(_by) {
+    edge_grid = unique_ptr<PolygonEdgeGrid>(new PolygonEdgeGrid(ax, ay, bx, by));
+}
+
+const PolygonEdgeGrid& PdcInPolygon::grid() const {
+    return *edge_grid;
 }
 
 namespace {
@@ -68,8 +75,18 @@ Interval argument(Interval mx, Interval my, double xa, double ya, double xb, dou
 
 BoolInterval PdcInPolygon::test(const IntervalVector& x) {
 
-    Interval mx = Interval(x[0].mid());
-    Interval my = Interval(x[1].mid());
+    double mx = x[0].mid();
+    double my = x[1].mid();
+
+    // Winding number from the indexed edges (precomputed for cells without edges)
+    BoolInterval res = edge_grid->contains(mx, my);
+    if(res != ibex::MAYBE)
+        return res;
+
+    return test_angles(Interval(mx), Interval(my));
+}
+
+BoolInterval PdcInPolygon::test_angles(const Interval& mx, const Interval& my) const {
 
     Interval theta = Interval(0);
     for(size_t i = 0; i < ax.size(); i++) {
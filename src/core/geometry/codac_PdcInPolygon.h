@@ -12,6 +12,8 @@
 
 #include "ibex_Pdc.h"
 #include <vector>
+#include <memory>
+#include "codac_PolygonEdgeGrid.h"
 
 using ibex::Interval;
 using ibex::IntervalVector;
@@ -30,6 +32,9 @@ namespace codac {
  *
  * The polygon is not necessarily convex.
  *
+ * The edges are indexed in a uniform grid (see PolygonEdgeGrid), so that
+ * the test of a box does not involve all the edges of the polygon.
+ *
  * The polygon is defined by an union of oriented
  * segment given in counter-clockwise order.
  *
@@ -98,7 +103,27 @@ public:
 	 */
 	virtual BoolInterval test(const IntervalVector& box);
 
+    /**
+     * \brief Returns the grid indexing the edges of the polygon.
+     *
+     * \return a const reference to the grid
+     */
+    const PolygonEdgeGrid& grid() const;
+
 protected:
+
+    /**
+     * \brief Test a point by summing the angles under which the edges are seen.
+     *
+     * This computation involves all the edges of the polygon. It is used
+     * when the grid cannot conclude (point close to an edge).
+     *
+     * \param mx x coordinate of the point
+     * \param my y coordinate of the point
+     * \return YES if the point is inside the close polygon, NO if outside, else MAYBE.
+     */
+    BoolInterval test_angles(const Interval& mx, const Interval& my) const;
+
     /**
      * Definition of the segment of the polygon
      */
@@ -106,6 +131,11 @@ protected:
     std::vector<double> ay;
     std::vector<double> bx;
     std::vector<double> by;
+
+    /**
+     * Edges indexed in a uniform grid
+     */
+    std::unique_ptr<PolygonEdgeGrid> edge_grid;
 };
 
 } // namespace pyibex
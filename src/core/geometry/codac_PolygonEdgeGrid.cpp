@@ -0,0 +1,186 @@
+/**
+ *  PolygonEdgeGrid class
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <cmath>
+#include <algorithm>
+#include "codac_PolygonEdgeGrid.h"
+
+using namespace std;
+using namespace ibex;
+
+#define POLYGON_GRID_MAX_SIZE 1024 // maximal number of cells along each dimension
+
+namespace codac
+{
+  PolygonEdgeGrid::PolygonEdgeGrid(const vector<double>& ax, const vector<double>& ay,
+                                   const vector<double>& bx, const vector<double>& by)
+    : m_ax(ax), m_ay(ay), m_bx(bx), m_by(by)
+  {
+    assert(ax.size() == ay.size() && ax.size() == bx.size() && ax.size() == by.size());
+
+    m_hull.set_empty();
+    for(size_t k = 0 ; k < m_ax.size() ; k++)
+    {
+      m_hull[0] |= Interval(min(m_ax[k], m_bx[k]), max(m_ax[k], m_bx[k]));
+      m_hull[1] |= Interval(min(m_ay[k], m_by[k]), max(m_ay[k], m_by[k]));
+    }
+
+    if(m_ax.empty())
+      return;
+
+    // The number of cells is about the number of edges
+
+    double n = m_ax.size(), w = m_hull[0].diam(), h = m_hull[1].diam();
+
+    if(w > 0. && h > 0.)
+    {
+      m_nx = (int)min(ceil(sqrt(n * w / h)), (double)POLYGON_GRID_MAX_SIZE);
+      m_ny = (int)min(ceil(sqrt(n * h / w)), (double)POLYGON_GRID_MAX_SIZE);
+    }
+
+    else if(w > 0.)
+      m_nx = (int)min(n, (double)POLYGON_GRID_MAX_SIZE);
+
+    else if(h > 0.)
+      m_ny = (int)min(n, (double)POLYGON_GRID_MAX_SIZE);
+
+    m_nx = max(1, m_nx); m_ny = max(1, m_ny);
+    m_wx = w > 0. ? w / m_nx : 1.;
+    m_wy = h > 0. ? h / m_ny : 1.;
+
+    // Each edge is listed in the cells intersecting its bounding box
+
+    m_cells.resize(m_nx * m_ny);
+    for(size_t k = 0 ; k < m_ax.size() ; k++)
+    {
+      int i0 = cell_x(min(m_ax[k], m_bx[k])), i1 = cell_x(max(m_ax[k], m_bx[k]));
+      int j0 = cell_y(min(m_ay[k], m_by[k])), j1 = cell_y(max(m_ay[k], m_by[k]));
+
+      for(int j = j0 ; j <= j1 ; j++)
+        for(int i = i0 ; i <= i1 ; i++)
+          m_cells[j*m_nx+i].push_back(k);
+    }
+
+    // The winding number is constant over a cell without edges:
+    // it is computed once at the center of the cell
+
+    m_raster.resize(m_nx * m_ny, ibex::MAYBE);
+    for(int j = 0 ; j < m_ny ; j++)
+      for(int i = 0 ; i < m_nx ; i++)
+        if(m_cells[j*m_nx+i].empty())
+        {
+          double x = m_hull[0].lb() + (i + 0.5) * m_wx;
+          double y = m_hull[1].lb() + (j + 0.5) * m_wy;
+
+          int wn;
+          if(winding_number(x, y, cell_x(x), cell_y(y), wn))
+            m_raster[j*m_nx+i] = wn != 0 ? ibex::YES : ibex::NO;
+        }
+  }
+
+  int PolygonEdgeGrid::nb_edges() const
+  {
+    return m_ax.size();
+  }
+
+  void PolygonEdgeGrid::edges(const IntervalVector& x, vector<int>& v_edges) const
+  {
+    assert(x.size() == 2);
+    v_edges.clear();
+
+    if(m_cells.empty() || !x.intersects(m_hull))
+      return;
+
+    int i0 = cell_x(x[0].lb()), i1 = cell_x(x[0].ub());
+    int j0 = cell_y(x[1].lb()), j1 = cell_y(x[1].ub());
+
+    for(int j = j0 ; j <= j1 ; j++)
+      for(int i = i0 ; i <= i1 ; i++)
+        for(int k : m_cells[j*m_nx+i])
+          if(x[0].intersects(Interval(min(m_ax[k], m_bx[k]), max(m_ax[k], m_bx[k])))
+            && x[1].intersects(Interval(min(m_ay[k], m_by[k]), max(m_ay[k], m_by[k]))))
+            v_edges.push_back(k);
+
+    // An edge may be listed in several cells
+    sort(v_edges.begin(), v_edges.end());
+    v_edges.erase(unique(v_edges.begin(), v_edges.end()), v_edges.end());
+  }
+
+  BoolInterval PolygonEdgeGrid::contains(double x, double y) const
+  {
+    if(m_cells.empty() || !m_hull[0].contains(x) || !m_hull[1].contains(y))
+      return ibex::NO; // no edge around the point
+
+    int i = cell_x(x), j = cell_y(y);
+    if(m_raster[j*m_nx+i] != ibex::MAYBE)
+      return m_raster[j*m_nx+i];
+
+    int wn;
+    if(!winding_number(x, y, i, j, wn))
+      return ibex::MAYBE;
+    return wn != 0 ? ibex::YES : ibex::NO;
+  }
+
+  // Protected methods
+
+  bool PolygonEdgeGrid::winding_number(double x, double y, int i, int j, int& wn) const
+  {
+    // The edges crossing the half-line are listed in the cells
+    // of the row j, from the column i
+
+    wn = 0;
+
+    for(int ik = i ; ik < m_nx ; ik++)
+      for(int k : m_cells[j*m_nx+ik])
+      {
+        double ax = m_ax[k], ay = m_ay[k], bx = m_bx[k], by = m_by[k];
+
+        if(max(i, cell_x(min(ax, bx))) != ik)
+          continue; // edge already considered in a previous cell
+
+        if(ay == y && by == y) // horizontal edge on the line of the half-line
+        {
+          if(min(ax, bx) <= x && x <= max(ax, bx))
+            return false; // point on the edge
+          continue;
+        }
+
+        // Half-open rule: vertices on the half-line are counted once
+        bool upward = ay <= y && y < by;
+        bool downward = by <= y && y < ay;
+        if(!upward && !downward)
+          continue;
+
+        // Position of the point with respect to the edge
+        Interval side = (Interval(bx) - ax) * (Interval(y) - ay) - (Interval(by) - ay) * (Interval(x) - ax);
+        if(side.contains(0.))
+          return false;
+
+        if(upward && side.lb() > 0.)
+          wn++;
+        else if(downward && side.ub() < 0.)
+          wn--;
+      }
+
+    return true;
+  }
+
+  int PolygonEdgeGrid::cell_x(double x) const
+  {
+    double i = floor((x - m_hull[0].lb()) / m_wx);
+    return i < 0. ? 0 : (i >= m_nx ? m_nx - 1 : (int)i);
+  }
+
+  int PolygonEdgeGrid::cell_y(double y) const
+  {
+    double j = floor((y - m_hull[1].lb()) / m_wy);
+    return j < 0. ? 0 : (j >= m_ny ? m_ny - 1 : (int)j);
+  }
+}
@@ -0,0 +1,104 @@
+/**
+ *  \file
+ *  PolygonEdgeGrid class
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __CODAC_POLYGONEDGEGRID_H__
+#define __CODAC_POLYGONEDGEGRID_H__
+
+#include <vector>
+#include "ibex_BoolInterval.h"
+#include "codac_IntervalVector.h"
+
+namespace codac
+{
+  /**
+   * \class PolygonEdgeGrid
+   * \brief Uniform grid over the edges of a polygon, for fast spatial queries
+   *
+   * Each cell of the grid lists the edges whose bounding box intersects the cell.
+   * For the cells crossed by no edge, the winding number of the polygon is
+   * constant: the inclusion test of the cell is precomputed (raster).
+   *
+   * The polygon is defined by oriented edges \f$[\mathbf{a}_i,\mathbf{b}_i]\f$,
+   * and is not necessarily convex nor simple. A point is inside the polygon
+   * if its winding number is not null.
+   */
+  class PolygonEdgeGrid
+  {
+    public:
+
+      /**
+       * \brief Creates the grid of a polygon defined by its edges
+       *
+       * \param ax list of x coordinate of the first point of each edge
+       * \param ay list of y coordinate of the first point of each edge
+       * \param bx list of x coordinate of the second point of each edge
+       * \param by list of y coordinate of the second point of each edge
+       */
+      PolygonEdgeGrid(const std::vector<double>& ax, const std::vector<double>& ay,
+                      const std::vector<double>& bx, const std::vector<double>& by);
+
+      /**
+       * \brief Returns the number of edges of the polygon
+       *
+       * \return the number of edges
+       */
+      int nb_edges() const;
+
+      /**
+       * \brief Returns the indices of the edges whose bounding box may intersect a box
+       *
+       * Each edge is listed once, in increasing order of index.
+       * Edges that are not listed do not intersect the box.
+       *
+       * \param x the 2d box
+       * \param v_edges vector in which the indices are set
+       */
+      void edges(const IntervalVector& x, std::vector<int>& v_edges) const;
+
+      /**
+       * \brief Tests if a point is inside the polygon
+       *
+       * \param x x coordinate of the point
+       * \param y y coordinate of the point
+       * \return YES if the winding number of the point is not null, NO if it is null,
+       *         MAYBE if the point is too close to an edge for the test to be reliable
+       */
+      ibex::BoolInterval contains(double x, double y) const;
+
+    protected:
+
+      /**
+       * \brief Winding number of a point, from the edges crossing a horizontal half-line
+       *
+       * The half-line goes from the point towards \f$+\infty\f$ along the x-axis.
+       *
+       * \param x x coordinate of the point
+       * \param y y coordinate of the point
+       * \param i x index of the cell of the point
+       * \param j y index of the cell of the point
+       * \param winding_number computed winding number
+       * \return false if the computation is not reliable (point close to an edge)
+       */
+      bool winding_number(double x, double y, int i, int j, int& winding_number) const;
+
+      int cell_x(double x) const;
+      int cell_y(double y) const;
+
+      std::vector<double> m_ax, m_ay, m_bx, m_by; //!< edges of the polygon
+      IntervalVector m_hull = IntervalVector(2); //!< hull of the edges
+      int m_nx = 1, m_ny = 1; //!< number of cells along each dimension
+      double m_wx = 1., m_wy = 1.; //!< size of the cells
+      std::vector<std::vector<int>> m_cells; //!< edges of each cell, cell (i,j) being at index j*m_nx+i
+      std::vector<ibex::BoolInterval> m_raster; //!< inclusion tests of the cells without edges (MAYBE for other cells)
+  };
+}
+
+#endif
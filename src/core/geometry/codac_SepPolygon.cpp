@@ -60,31 +60,53 @@ Array<Ctc> segment_ctc_list(vector< vector <double> > &vertices) {
 
 namespace codac {
 
+CtcPolygonBoundary::CtcPolygonBoundary(const Array<Ctc>& _list, const PolygonEdgeGrid& _grid) : Ctc(2),
+            list(_list),
+            grid(_grid) {
+    assert(list.size() == grid.nb_edges());
+}
+
+void CtcPolygonBoundary::contract(IntervalVector& box) {
+
+    vector<int> v_edges;
+    grid.edges(box, v_edges);
+
+    IntervalVector result(2, Interval::EMPTY_SET);
+    for(size_t i = 0; i < v_edges.size(); i++) {
+        IntervalVector x(box);
+        list[v_edges[i]].contract(x);
+        result |= x;
+    }
+    box = result;
+}
+
+SepPolygon::SepPolygon(const Array<Ctc>& list, PdcInPolygon *pdc) :
+            SepBoundaryCtc(*new CtcPolygonBoundary(list, pdc->grid()), *pdc) {
+
+}
+
 SepPolygon::SepPolygon(vector< vector<double> > &vertices) :
-            SepBoundaryCtc(*new CtcUnion(segment_ctc_list(vertices)),
-                           *new PdcInPolygon(vertices)) {
+            SepPolygon(segment_ctc_list(vertices), new PdcInPolygon(vertices)) {
 
 }
 
 SepPolygon::SepPolygon(vector< vector< vector<double> > > &points) :
-            SepBoundaryCtc(*new CtcUnion(segment_ctc_list(points)),
-                           *new PdcInPolygon(points)) {
+            SepPolygon(segment_ctc_list(points), new PdcInPolygon(points)) {
 
 }
 
 SepPolygon::SepPolygon(vector<double> &_ax, vector<double> &_ay, vector<double> &_bx, vector<double> &_by) :
-            SepBoundaryCtc(*new CtcUnion(segment_ctc_list(_ax,_ay, _bx, _by)),
-                           *new PdcInPolygon(_ax,_ay,_bx,_by)) {
+            SepPolygon(segment_ctc_list(_ax,_ay, _bx, _by), new PdcInPolygon(_ax,_ay,_bx,_by)) {
 
 }
 
 
 
 SepPolygon::~SepPolygon() {
-	for(int i=0; i<((CtcUnion&) ctc_boundary).list.size(); i++) {
-		delete & (((CtcUnion&) ctc_boundary).list[i]);
+	for(int i=0; i<((CtcPolygonBoundary&) ctc_boundary).list.size(); i++) {
+		delete & (((CtcPolygonBoundary&) ctc_boundary).list[i]);
 	}
-	delete &ctc_boundary;
+	delete &ctc_boundary; // refers to the grid of is_inside
 
 	delete &is_inside;
 }
@@ -14,11 +14,50 @@
 #include "ibex_SepBoundaryCtc.h"
 #include "ibex_CtcUnion.h"
 #include "codac_PdcInPolygon.h"
+#include "codac_PolygonEdgeGrid.h"
 
 
 
 namespace codac {
 
+/**
+ * \ingroup iset
+ *
+ * \brief Contractor on the boundary of a polygon.
+ *
+ * Union of the contractors on the edges (CtcSegment), as a CtcUnion would do,
+ * but only the edges listed by the grid around the box are involved.
+ * Other edges do not intersect the box and would contract it to the empty set.
+ */
+class CtcPolygonBoundary : public ibex::Ctc {
+
+public:
+
+    /**
+     * \brief Create the contractor from the contractors on each edge.
+     *
+     * \param list contractors on the edges, in the order of the edges of the grid
+     * \param grid grid indexing the edges of the polygon
+     */
+    CtcPolygonBoundary(const ibex::Array<ibex::Ctc>& list, const PolygonEdgeGrid& grid);
+
+    /**
+     * \brief Contract the box.
+     *
+     * \param box the box to be contracted
+     */
+    virtual void contract(IntervalVector& box);
+
+    /**
+     * Contractors on the edges
+     */
+    ibex::Array<ibex::Ctc> list;
+
+protected:
+
+    const PolygonEdgeGrid& grid;
+};
+
 /**
  * \ingroup iset
  *
@@ -59,6 +98,10 @@ namespace codac {
  * From an initial box, the minimal contractor on the border of the polygon is called
  * and a test is used to classify each removed part into x_in and x_out.
  *
+ * Both the contractor and the test rely on a grid indexing the edges
+ * (see PolygonEdgeGrid): only the edges around the box are involved,
+ * which makes the separator suitable for polygons with many vertices.
+ *
  *
  */
 class SepPolygon : public ibex::SepBoundaryCtc {
@@ -118,6 +161,16 @@ public:
 	 */
    ~SepPolygon();
 
+protected:
+
+    /**
+     * \brief Create the separator from the predicate and the contractors on the edges.
+     *
+     * \param list contractors on the edges of the polygon
+     * \param pdc predicate of the polygon, indexing its edges
+     */
+    SepPolygon(const ibex::Array<ibex::Ctc>& list, PdcInPolygon *pdc);
+
 };
 
 } // end namespace pyibex
@@ -9,6 +9,7 @@
  */
 
 #include <iomanip>
+#include <algorithm>
 #include "codac_ThickPoint.h"
 
 using namespace std;
@@ -16,6 +17,33 @@ using namespace ibex;
 
 namespace codac
 {
+  namespace
+  {
+    // Removes the redundant points in O(n log(n)), keeping the first
+    // occurrence of each point in the order of the input vector
+    template<typename T, typename Less>
+    vector<T> remove_identical(const vector<T>& v_pts_, Less less)
+    {
+      vector<size_t> v_ids(v_pts_.size());
+      for(size_t i = 0 ; i < v_ids.size() ; i++)
+        v_ids[i] = i;
+
+      stable_sort(v_ids.begin(), v_ids.end(),
+        [&](size_t i, size_t j) { return less(v_pts_[i], v_pts_[j]); });
+
+      vector<bool> v_kept(v_pts_.size(), false);
+      for(size_t k = 0 ; k < v_ids.size() ; k++)
+        if(k == 0 || less(v_pts_[v_ids[k-1]], v_pts_[v_ids[k]]))
+          v_kept[v_ids[k]] = true; // first occurrence of a new point
+
+      vector<T> v_pts;
+      for(size_t i = 0 ; i < v_pts_.size() ; i++)
+        if(v_kept[i])
+          v_pts.push_back(v_pts_[i]);
+      return v_pts;
+    }
+  }
+
   // Definition
 
   ThickPoint::ThickPoint()
@@ -219,21 +247,35 @@ namespace codac
   
   vector<ThickPoint> ThickPoint::remove_identical_pts(const vector<ThickPoint>& v_pts_)
   {
-    // Removing possible redundant points
-    vector<ThickPoint> v_pts;
-    for(const auto& pt : v_pts_)
-      if(find(v_pts.begin(),v_pts.end(),pt) == v_pts.end())
-        v_pts.push_back(pt);
-    return v_pts;
+    // Lexicographic order on the bounds, consistent with operator==
+    // (undefined points are all identical)
+    return remove_identical(v_pts_,
+      [](const ThickPoint& p1, const ThickPoint& p2)
+      {
+        if(p1.does_not_exist() || p2.does_not_exist())
+          return p1.does_not_exist() && !p2.does_not_exist();
+
+        for(int i = 0 ; i < 2 ; i++)
+        {
+          if(p1[i].lb() != p2[i].lb()) return p1[i].lb() < p2[i].lb();
+          if(p1[i].ub() != p2[i].ub()) return p1[i].ub() < p2[i].ub();
+        }
+        return false;
+      });
   }
   
   vector<Vector> ThickPoint::remove_identical_pts(const vector<Vector>& v_pts_)
   {
-    // Removing possible redundant points
-    vector<Vector> v_pts;
-    for(const auto& pt : v_pts_)
-      if(find(v_pts.begin(),v_pts.end(),pt) == v_pts.end())
-        v_pts.push_back(pt);
-    return v_pts;
+    return remove_identical(v_pts_,
+      [](const Vector& p1, const Vector& p2)
+      {
+        if(p1.size() != p2.size())
+          return p1.size() < p2.size();
+
+        for(int i = 0 ; i < p1.size() ; i++)
+          if(p1[i] != p2[i])
+            return p1[i] < p2[i];
+        return false;
+      });
   }
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 
 #include <list>
 #include <iostream>
+#include <unordered_map>
 #include "codac_Paving.h"
 #include "ibex_LargestFirst.h"
 
@@ -239,16 +240,28 @@ namespace codac
 
   vector<ConnectedSubset> Paving::get_connected_subsets(bool sort_by_size, SetValue val) const
   {
-    reset_flags();
+    // Leaves of the paving, listed once in the order of the tree,
+    // and indexed for marking the leaves already in a subset
 
-    const Paving *p;
+    vector<const Paving*> v_leaves;
+    get_pavings_intersecting(val, m_box, v_leaves);
+
+    unordered_map<const Paving*,size_t> m_leaves_ids;
+    for(size_t i = 0 ; i < v_leaves.size() ; i++)
+      m_leaves_ids[v_leaves[i]] = i;
+
+    vector<bool> v_visited(v_leaves.size(), false);
     vector<ConnectedSubset> v_connected_subsets;
 
-    while((p = get_first_leaf(val, true)))
+    for(size_t i = 0 ; i < v_leaves.size() ; i++)
     {
+      if(v_visited[i])
+        continue;
+
       vector<const Paving*> v_subset_items;
       list<const Paving*> l;
-      l.push_back(p);
+      l.push_back(v_leaves[i]);
+      v_visited[i] = true;
 
       while(!l.empty())
       {
@@ -256,15 +269,20 @@ namespace codac
         l.pop_front();
 
         v_subset_items.push_back(e);
-        e->set_flag();
 
+        // Neighbours obtained from the tree: only the branches
+        // intersecting the box of the leaf are explored
         vector<const Paving*> v_neighbours;
-        e->get_neighbours(v_neighbours, val, true);
+        m_root->get_pavings_intersecting(val, e->box(), v_neighbours);
 
         for(const auto& neighb : v_neighbours)
         {
-          neighb->set_flag();
-          l.push_back(neighb);
+          auto it = m_leaves_ids.find(neighb);
+          if(it != m_leaves_ids.end() && !v_visited[it->second])
+          {
+            v_visited[it->second] = true;
+            l.push_back(neighb);
+          }
         }
       }
 
@@ -0,0 +1,243 @@
+/**
+ *  MappedTubeFile class
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include "codac_MappedTubeFile.h"
+#include "codac_serialize_tubes.h"
+#include "codac_Tube.h"
+#include "codac_TubeVector.h"
+#include "codac_Exception.h"
+
+#ifndef _WIN32
+  #include <fcntl.h>
+  #include <unistd.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+#endif
+
+using namespace std;
+using namespace ibex;
+
+namespace codac
+{
+  namespace
+  {
+    Interval column_interval(double lb, double ub)
+    {
+      if(std::isnan(lb) || std::isnan(ub))
+        return Interval::EMPTY_SET;
+      return Interval(lb, ub);
+    }
+  }
+
+  MappedTubeFile::MappedTubeFile(const string& binary_file_name, bool tube_vector)
+  {
+    #ifndef _WIN32
+
+      int fd = open(binary_file_name.c_str(), O_RDONLY);
+      if(fd < 0)
+        throw Exception(__func__, "unable to load tube from file " + binary_file_name);
+
+      struct stat st;
+      if(fstat(fd, &st) < 0 || st.st_size == 0)
+      {
+        close(fd);
+        throw Exception(__func__, "unable to load tube from file " + binary_file_name);
+      }
+
+      m_length = st.st_size;
+      void *data = mmap(nullptr, m_length, PROT_READ, MAP_PRIVATE, fd, 0);
+      close(fd); // the mapping remains valid after closing the file
+
+      if(data == MAP_FAILED)
+        throw Exception(__func__, "unable to map file " + binary_file_name);
+      m_data = (const char*)data;
+
+    #else
+
+      // Without memory mapping, the content is read in a buffer of doubles,
+      // so that the columns remain aligned in memory
+
+      ifstream bin_file(binary_file_name.c_str(), ios::in | ios::binary | ios::ate);
+      if(!bin_file.is_open())
+        throw Exception(__func__, "unable to load tube from file " + binary_file_name);
+
+      m_length = bin_file.tellg();
+      m_buffer.resize((m_length + sizeof(double) - 1) / sizeof(double));
+      bin_file.seekg(0);
+      bin_file.read((char*)m_buffer.data(), m_length);
+      m_data = (const char*)m_buffer.data();
+
+    #endif
+
+    try
+    {
+      size_t offset = 0;
+      short int size = 1;
+
+      if(tube_vector)
+      {
+        if(m_length < sizeof(short int))
+          throw Exception(__func__, "unexpected end of file");
+        memcpy(&size, m_data, sizeof(short int));
+        offset += sizeof(short int);
+      }
+
+      m_v_components.reserve(size);
+      for(int i = 0 ; i < size ; i++)
+        offset = index_tube(offset);
+    }
+
+    catch(...)
+    {
+      #ifndef _WIN32
+        munmap((void*)m_data, m_length);
+      #endif
+      throw;
+    }
+  }
+
+  MappedTubeFile::~MappedTubeFile()
+  {
+    #ifndef _WIN32
+      munmap((void*)m_data, m_length);
+    #endif
+  }
+
+  int MappedTubeFile::size() const
+  {
+    return m_v_components.size();
+  }
+
+  int MappedTubeFile::nb_slices(int i) const
+  {
+    assert(i >= 0 && i < size());
+    return m_v_components[i].nb_slices;
+  }
+
+  const Interval MappedTubeFile::tdomain(int i) const
+  {
+    assert(i >= 0 && i < size());
+    return m_v_components[i].tdomain;
+  }
+
+  const Interval MappedTubeFile::codomain(int i) const
+  {
+    assert(i >= 0 && i < size());
+    return m_v_components[i].codomain;
+  }
+
+  const IntervalVector MappedTubeFile::codomain() const
+  {
+    IntervalVector codomain(size());
+    for(int i = 0 ; i < size() ; i++)
+      codomain[i] = m_v_components[i].codomain;
+    return codomain;
+  }
+
+  const double* MappedTubeFile::time_bounds(int i) const
+  {
+    assert(i >= 0 && i < size());
+    return m_v_components[i].t;
+  }
+
+  const Interval MappedTubeFile::slice_codomain(int i, int k) const
+  {
+    assert(i >= 0 && i < size());
+    assert(k >= 0 && k < nb_slices(i));
+    const Component& c = m_v_components[i];
+    return column_interval(c.y_lb[k], c.y_ub[k]);
+  }
+
+  const Interval MappedTubeFile::gate(int i, int k) const
+  {
+    assert(i >= 0 && i < size());
+    assert(k >= 0 && k <= nb_slices(i));
+    const Component& c = m_v_components[i];
+    return column_interval(c.g_lb[k], c.g_ub[k]);
+  }
+
+  void MappedTubeFile::load(Tube *&tube, int i) const
+  {
+    assert(i >= 0 && i < size());
+    const Component& c = m_v_components[i];
+    deserialize_Tube(c.nb_slices, c.t, c.y_lb, c.y_ub, c.g_lb, c.g_ub, tube);
+  }
+
+  void MappedTubeFile::load(TubeVector *&tube) const
+  {
+    load(tube, 0, size()-1);
+  }
+
+  void MappedTubeFile::load(TubeVector *&tube, int start_index, int end_index) const
+  {
+    assert(start_index >= 0 && end_index < size() && start_index <= end_index);
+
+    tube = new TubeVector();
+    tube->m_n = end_index - start_index + 1;
+    tube->m_v_tubes = new Tube[tube->m_n];
+
+    for(int i = start_index ; i <= end_index ; i++)
+    {
+      Tube *ptr;
+      load(ptr, i);
+      (*tube)[i-start_index] = *ptr;
+      delete ptr;
+    }
+  }
+
+  // Protected methods
+
+  size_t MappedTubeFile::index_tube(size_t offset)
+  {
+    // Fixed-size part of the header: version, padding, slices number, tdomain, codomain
+    size_t header_size = 2*sizeof(short int) + sizeof(int) + 4*sizeof(double);
+    if(offset + header_size > m_length)
+      throw Exception(__func__, "unexpected end of file");
+
+    const char *header = m_data + offset;
+
+    short int version_number, padding;
+    memcpy(&version_number, header, sizeof(short int));
+    memcpy(&padding, header + sizeof(short int), sizeof(short int));
+
+    if(version_number != 3)
+      throw Exception(__func__, "only version 3 can be mapped, the file has to be serialized again");
+
+    Component c;
+    memcpy(&c.nb_slices, header + 2*sizeof(short int), sizeof(int));
+    if(c.nb_slices < 1 || padding < 0 || padding >= 8)
+      throw Exception(__func__, "wrong tube header");
+
+    double bounds[4];
+    memcpy(bounds, header + 2*sizeof(short int) + sizeof(int), 4*sizeof(double));
+    c.tdomain = column_interval(bounds[0], bounds[1]);
+    c.codomain = column_interval(bounds[2], bounds[3]);
+
+    size_t n = c.nb_slices;
+    size_t columns_offset = offset + header_size + padding;
+    size_t end_offset = columns_offset + (5*n + 3)*sizeof(double);
+    if(end_offset > m_length)
+      throw Exception(__func__, "unexpected end of file");
+
+    // Columns, accessed directly in the mapped memory (aligned by the padding)
+    const double *columns = (const double*)(m_data + columns_offset);
+    c.t = columns;
+    c.y_lb = c.t + n + 1;
+    c.y_ub = c.y_lb + n;
+    c.g_lb = c.y_ub + n;
+    c.g_ub = c.g_lb + n + 1;
+
+    m_v_components.push_back(c);
+    return end_offset;
+  }
+}
@@ -0,0 +1,179 @@
+/**
+ *  \file
+ *  MappedTubeFile class
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __CODAC_MAPPEDTUBEFILE_H__
+#define __CODAC_MAPPEDTUBEFILE_H__
+
+#include <string>
+#include <vector>
+#include "codac_Interval.h"
+#include "codac_IntervalVector.h"
+
+namespace codac
+{
+  class Tube;
+  class TubeVector;
+
+  /**
+   * \class MappedTubeFile
+   * \brief Read-only access to tubes serialized in a binary file (version 3),
+   *        mapped in memory
+   *
+   * Only the headers of the tubes are read when opening the file: the tdomain and
+   * codomain of each component are available at once, and the columns of values
+   * are accessed directly in the mapped memory (without copy). A component is
+   * loaded only when requested, so that only the related part of the file is read.
+   *
+   * \note On systems without memory mapping, the file is read at once in memory.
+   */
+  class MappedTubeFile
+  {
+    public:
+
+      /**
+       * \brief Maps a binary file written by Tube::serialize() or TubeVector::serialize()
+       *
+       * \param binary_file_name path to the binary file
+       * \param tube_vector `true` if the file contains a TubeVector, `false` for a Tube
+       */
+      explicit MappedTubeFile(const std::string& binary_file_name, bool tube_vector = true);
+
+      /**
+       * \brief MappedTubeFile destructor, unmaps the file
+       */
+      ~MappedTubeFile();
+
+      MappedTubeFile(const MappedTubeFile&) = delete;
+      MappedTubeFile& operator=(const MappedTubeFile&) = delete;
+
+      /**
+       * \brief Returns the number of tubes in the file
+       *
+       * \return the dimension of the TubeVector, or 1 for a Tube
+       */
+      int size() const;
+
+      /**
+       * \brief Returns the number of slices of a component
+       *
+       * \param i index of the component
+       * \return the number of slices
+       */
+      int nb_slices(int i = 0) const;
+
+      /**
+       * \brief Returns the temporal domain of a component, from the header index
+       *
+       * \param i index of the component
+       * \return the tdomain of the tube
+       */
+      const Interval tdomain(int i = 0) const;
+
+      /**
+       * \brief Returns the codomain of a component, from the header index
+       *
+       * \param i index of the component
+       * \return the codomain of the tube
+       */
+      const Interval codomain(int i) const;
+
+      /**
+       * \brief Returns the codomain of all the components, from the header index
+       *
+       * \return the codomain of the tube vector
+       */
+      const IntervalVector codomain() const;
+
+      /**
+       * \brief Returns the time bounds of the slices of a component, without copy
+       *
+       * \param i index of the component
+       * \return a pointer to the nb_slices(i)+1 values \f$t_0,\dots,t_n\f$
+       */
+      const double* time_bounds(int i = 0) const;
+
+      /**
+       * \brief Returns the codomain of a slice, read in the mapped columns
+       *
+       * \param i index of the component
+       * \param k index of the slice
+       * \return the codomain of the slice
+       */
+      const Interval slice_codomain(int i, int k) const;
+
+      /**
+       * \brief Returns the value of a gate, read in the mapped columns
+       *
+       * \param i index of the component
+       * \param k index of the gate, from 0 (input gate of the tube) to nb_slices(i)
+       * \return the value of the gate
+       */
+      const Interval gate(int i, int k) const;
+
+      /**
+       * \brief Creates a Tube object from one component of the file
+       *
+       * Only the columns of this component are read.
+       *
+       * \param tube Tube object to be created
+       * \param i index of the component
+       */
+      void load(Tube *&tube, int i = 0) const;
+
+      /**
+       * \brief Creates a TubeVector object from the components of the file
+       *
+       * \param tube TubeVector object to be created
+       */
+      void load(TubeVector *&tube) const;
+
+      /**
+       * \brief Creates a TubeVector object from a subset of the components of the file
+       *
+       * Only the columns of these components are read.
+       *
+       * \param tube TubeVector object to be created
+       * \param start_index first component index of the subvector to be loaded
+       * \param end_index last component index of the subvector to be loaded
+       */
+      void load(TubeVector *&tube, int start_index, int end_index) const;
+
+    protected:
+
+      /**
+       * \brief Indexes the header of a tube (version 3) located at some offset in the file
+       *
+       * \param offset position of the tube in the file
+       * \return the position of the end of the tube in the file
+       */
+      size_t index_tube(size_t offset);
+
+      /**
+       * \struct Component
+       * \brief Header and columns of a serialized tube
+       */
+      struct Component
+      {
+        int nb_slices; //!< number of slices
+        Interval tdomain, codomain; //!< header index
+        const double *t; //!< time bounds (nb_slices+1 values)
+        const double *y_lb, *y_ub; //!< bounds of the slices codomains (nb_slices values)
+        const double *g_lb, *g_ub; //!< bounds of the gates (nb_slices+1 values)
+      };
+
+      const char *m_data = nullptr; //!< mapped content of the file
+      size_t m_length = 0; //!< size of the file in bytes
+      std::vector<double> m_buffer; //!< content of the file when memory mapping is not available
+      std::vector<Component> m_v_components; //!< index of the tubes of the file
+  };
+}
+
+#endif
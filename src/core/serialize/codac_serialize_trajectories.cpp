@@ -8,6 +8,9 @@
  *              the GNU Lesser General Public License (LGPL).
  */
 
+#include <cmath>
+#include <limits>
+#include <vector>
 #include "codac_Vector.h"
 #include "codac_Exception.h"
 #include "codac_serialize_trajectories.h"
@@ -50,6 +53,40 @@ namespace codac
         break;
       }
 
+      case 3:
+      {
+        // Padding, so that the columns are aligned on 8 bytes in the file
+        streamoff columns_pos = (streamoff)bin_file.tellp() + sizeof(short int) + sizeof(int) + 4*sizeof(double);
+        short int padding = (8 - columns_pos % 8) % 8;
+        bin_file.write((const char*)&padding, sizeof(short int));
+
+        // Points number
+        int pts_number = traj.sampled_map().size();
+        bin_file.write((const char*)&pts_number, sizeof(int));
+
+        // Header index
+        double nan = numeric_limits<double>::quiet_NaN();
+        double header[4] = {
+          traj.tdomain().is_empty() ? nan : traj.tdomain().lb(), traj.tdomain().is_empty() ? nan : traj.tdomain().ub(),
+          traj.codomain().is_empty() ? nan : traj.codomain().lb(), traj.codomain().is_empty() ? nan : traj.codomain().ub() };
+        bin_file.write((const char*)header, 4*sizeof(double));
+        char zeros[8] = { 0 };
+        bin_file.write(zeros, padding);
+
+        // Columns
+        vector<double> v_t, v_y;
+        v_t.reserve(pts_number); v_y.reserve(pts_number);
+        for(const auto& it_map : traj.sampled_map())
+        {
+          v_t.push_back(it_map.first);
+          v_y.push_back(it_map.second);
+        }
+
+        bin_file.write((const char*)v_t.data(), pts_number*sizeof(double));
+        bin_file.write((const char*)v_y.data(), pts_number*sizeof(double));
+        break;
+      }
+
       default:
         throw Exception(__func__, "unhandled case");
     }
@@ -89,6 +126,41 @@ namespace codac
         break;
       }
 
+      case 3:
+      {
+        short int padding;
+        bin_file.read((char*)&padding, sizeof(short int));
+
+        // Points number
+        int pts_number;
+        bin_file.read((char*)&pts_number, sizeof(int));
+
+        if(!bin_file || pts_number < 0)
+          throw Exception(__func__, "wrong points number");
+
+        // Header index and padding, not needed here
+        bin_file.ignore(4*sizeof(double) + padding);
+
+        // Columns, read at once
+        vector<double> v_t(pts_number), v_y(pts_number);
+        bin_file.read((char*)v_t.data(), pts_number*sizeof(double));
+        bin_file.read((char*)v_y.data(), pts_number*sizeof(double));
+
+        if(!bin_file)
+          throw Exception(__func__, "unexpected end of file");
+
+        // Points are sorted by time: they are inserted at the end of the map
+        traj = new Trajectory();
+        for(int i = 0 ; i < pts_number ; i++)
+        {
+          traj->m_map_values.emplace_hint(traj->m_map_values.end(), v_t[i], v_y[i]);
+          traj->m_tdomain |= v_t[i];
+          traj->m_codomain |= v_y[i];
+        }
+
+        break;
+      }
+
       default:
         throw Exception(__func__, "deserialization version number not supported");
     }
@@ -25,7 +25,19 @@ namespace codac
   /**
    * \brief Writes a Trajectory object into a binary file
    * 
-   * Trajectory binary structure: <br>
+   * Trajectory binary structure (version 3, columnar): <br>
+   *   [short_int_version_number] <br>
+   *   [short_int_padding] // nb of bytes before the columns <br>
+   *   [int_nb_points] <br>
+   *   [double_tdomain_lb] [double_tdomain_ub] // header index <br>
+   *   [double_codomain_lb] [double_codomain_ub] <br>
+   *   [padding] // the columns are aligned on 8 bytes in the file <br>
+   *   [double_t_pt1] ... [double_t_ptn] <br>
+   *   [double_y_pt1] ... [double_y_ptn] <br>
+   *
+   * Empty intervals are stored as NaN bounds.
+   *
+   * Trajectory binary structure (version 2): <br>
    *   [short_int_version_number] <br>
    *   [int_nb_points] <br>
    *   [double_t_pt1] <br>
@@ -8,6 +8,9 @@
  *              the GNU Lesser General Public License (LGPL).
  */
 
+#include <cmath>
+#include <limits>
+#include <vector>
 #include "codac_serialize_tubes.h"
 #include "codac_serialize_intervals.h"
 #include "codac_Exception.h"
@@ -20,6 +23,47 @@ using namespace ibex;
 
 namespace codac
 {
+  namespace
+  {
+    // Bounds of an interval in columns: empty sets are stored as NaN bounds
+
+    double column_lb(const Interval& intv)
+    {
+      return intv.is_empty() ? numeric_limits<double>::quiet_NaN() : intv.lb();
+    }
+
+    double column_ub(const Interval& intv)
+    {
+      return intv.is_empty() ? numeric_limits<double>::quiet_NaN() : intv.ub();
+    }
+
+    void write_bounds(ofstream& bin_file, const Interval& intv)
+    {
+      double bounds[2] = { column_lb(intv), column_ub(intv) };
+      bin_file.write((const char*)bounds, 2*sizeof(double));
+    }
+
+    void write_column(ofstream& bin_file, const vector<double>& v)
+    {
+      bin_file.write((const char*)v.data(), v.size()*sizeof(double));
+    }
+
+    void read_column(ifstream& bin_file, vector<double>& v, size_t n)
+    {
+      v.resize(n);
+      bin_file.read((char*)v.data(), n*sizeof(double));
+      if(!bin_file)
+        throw Exception(__func__, "unexpected end of file");
+    }
+
+    Interval column_interval(double lb, double ub)
+    {
+      if(std::isnan(lb) || std::isnan(ub))
+        return Interval::EMPTY_SET;
+      return Interval(lb, ub);
+    }
+  }
+
   void serialize_Tube(ofstream& bin_file, const Tube& tube, int version_number)
   {
     if(!bin_file.is_open())
@@ -62,6 +106,57 @@ namespace codac
         break;
       }
 
+      case 3:
+      {
+        // Version number for compliance purposes
+        bin_file.write((const char*)&version_number, sizeof(short int));
+
+        // Padding, so that the columns are aligned on 8 bytes in the file
+        streamoff columns_pos = (streamoff)bin_file.tellp() + sizeof(short int) + sizeof(int) + 4*sizeof(double);
+        short int padding = (8 - columns_pos % 8) % 8;
+        bin_file.write((const char*)&padding, sizeof(short int));
+
+        // Slices number
+        int slices_number = tube.nb_slices();
+        bin_file.write((const char*)&slices_number, sizeof(int));
+
+        // Header index
+        write_bounds(bin_file, tube.tdomain());
+        write_bounds(bin_file, tube.codomain());
+        char zeros[8] = { 0 };
+        bin_file.write(zeros, padding);
+
+        // Columns
+        vector<double> v_t, v_lb, v_ub;
+        v_t.reserve(slices_number+1);
+        v_lb.reserve(slices_number+1); v_ub.reserve(slices_number+1);
+
+        for(const Slice *s = tube.first_slice() ; s ; s = s->next_slice())
+        {
+          v_t.push_back(s->tdomain().lb());
+          v_lb.push_back(column_lb(s->codomain()));
+          v_ub.push_back(column_ub(s->codomain()));
+        }
+        v_t.push_back(tube.tdomain().ub());
+
+        write_column(bin_file, v_t);
+        write_column(bin_file, v_lb);
+        write_column(bin_file, v_ub);
+
+        v_lb.clear(); v_ub.clear();
+        v_lb.push_back(column_lb(tube.first_slice()->input_gate()));
+        v_ub.push_back(column_ub(tube.first_slice()->input_gate()));
+        for(const Slice *s = tube.first_slice() ; s ; s = s->next_slice())
+        {
+          v_lb.push_back(column_lb(s->output_gate()));
+          v_ub.push_back(column_ub(s->output_gate()));
+        }
+
+        write_column(bin_file, v_lb);
+        write_column(bin_file, v_ub);
+        break;
+      }
+
       default:
         throw Exception(__func__, "unhandled case");
     }
@@ -99,6 +194,8 @@ namespace codac
         Interval tube_tdomain(lb);
 
         Slice *prev_slice = nullptr, *slice = nullptr;
+        tube->m_v_slices.reserve(slices_number);
+        tube->m_arena.reserve(slices_number);
         for(int k = 0 ; k < slices_number ; k++)
         {
           double ub;
@@ -106,25 +203,22 @@ namespace codac
           tube_tdomain |= Interval(lb, ub);
 
           if(slice == nullptr)
-          {
-            slice = new Slice(Interval(lb, ub));
-            tube->m_first_slice = slice;
-          }
+            slice = tube->m_arena.new_slice(Interval(lb, ub));
 
           else
           {
-            slice->m_next_slice = new Slice(Interval(lb, ub));
+            slice->m_next_slice = tube->m_arena.new_slice(Interval(lb, ub));
             slice = slice->next_slice();
           }
 
           if(prev_slice)
           {
-            delete slice->m_input_gate;
-            slice->m_input_gate = nullptr;
+            slice->delete_gate(slice->m_input_gate);
             Slice::chain_slices(prev_slice, slice);
           }
 
           prev_slice = slice;
+          tube->m_v_slices.push_back(slice);
           lb = ub;
         }
 
@@ -153,11 +247,87 @@ namespace codac
         break;
       }
 
+      case 3:
+      {
+        short int padding;
+        bin_file.read((char*)&padding, sizeof(short int));
+
+        // Slices number
+        int slices_number;
+        bin_file.read((char*)&slices_number, sizeof(int));
+
+        if(!bin_file || slices_number < 1)
+          throw Exception(__func__, "wrong slices number");
+
+        // Header index (tdomain, codomain) and padding, not needed here
+        bin_file.ignore(4*sizeof(double) + padding);
+
+        // Columns, read at once
+        vector<double> v_t, v_y_lb, v_y_ub, v_g_lb, v_g_ub;
+        read_column(bin_file, v_t, slices_number+1);
+        read_column(bin_file, v_y_lb, slices_number);
+        read_column(bin_file, v_y_ub, slices_number);
+        read_column(bin_file, v_g_lb, slices_number+1);
+        read_column(bin_file, v_g_ub, slices_number+1);
+
+        deserialize_Tube(slices_number, v_t.data(),
+          v_y_lb.data(), v_y_ub.data(), v_g_lb.data(), v_g_ub.data(), tube);
+        break;
+      }
+
       default:
         throw Exception(__func__, "deserialization version number not supported");
     }
   }
 
+  void deserialize_Tube(int nb_slices, const double *t,
+    const double *y_lb, const double *y_ub, const double *g_lb, const double *g_ub, Tube *&tube)
+  {
+    if(nb_slices < 1)
+      throw Exception(__func__, "wrong slices number");
+
+    tube = new Tube();
+
+    // Creating slices
+    Slice *prev_slice = nullptr, *slice = nullptr;
+    tube->m_v_slices.reserve(nb_slices);
+    tube->m_arena.reserve(nb_slices);
+    for(int k = 0 ; k < nb_slices ; k++)
+    {
+      if(slice == nullptr)
+        slice = tube->m_arena.new_slice(Interval(t[k], t[k+1]));
+
+      else
+      {
+        slice->m_next_slice = tube->m_arena.new_slice(Interval(t[k], t[k+1]));
+        slice = slice->next_slice();
+      }
+
+      if(prev_slice)
+      {
+        slice->delete_gate(slice->m_input_gate);
+        Slice::chain_slices(prev_slice, slice);
+      }
+
+      prev_slice = slice;
+      tube->m_v_slices.push_back(slice);
+    }
+
+    // Domain
+    tube->m_tdomain = Interval(t[0], t[nb_slices]); // redundant information for fast access
+
+    // Codomains
+    int k = 0;
+    for(Slice *s = tube->first_slice() ; s ; s = s->next_slice(), k++)
+      s->set(column_interval(y_lb[k], y_ub[k]));
+
+    // Gates
+    tube->first_slice()->set_input_gate(column_interval(g_lb[0], g_ub[0]));
+    k = 1;
+    for(Slice *s = tube->first_slice() ; s ; s = s->next_slice(), k++)
+      s->set_output_gate(column_interval(g_lb[k], g_ub[k]));
+  }
+
   void serialize_TubeVector(ofstream& bin_file, const TubeVector& tube, int version_number)
   {
     if(!bin_file.is_open())
@@ -16,7 +16,7 @@
 
 namespace codac
 {
-  #define SERIALIZATION_VERSION 2
+  #define SERIALIZATION_VERSION 3
 
   class Tube;
   class TubeVector;
@@ -25,9 +25,26 @@ namespace codac
   /// @{
 
   /**
-   * \brief Writes a Tube object into a binary file (version 2)
+   * \brief Writes a Tube object into a binary file (version 3 by default)
    * 
-   * Tube binary structure: <br>
+   * Tube binary structure (version 3, columnar): <br>
+   *   [short_int_version_number] <br>
+   *   [short_int_padding] // nb of bytes before the columns <br>
+   *   [int_nb_slices] <br>
+   *   [double_tdomain_lb] [double_tdomain_ub] // header index <br>
+   *   [double_codomain_lb] [double_codomain_ub] <br>
+   *   [padding] // the columns are aligned on 8 bytes in the file <br>
+   *   [double_t0] [double_t1] ... [double_tn] // time bounds of the slices <br>
+   *   [double_y0_lb] ... [double_y(n-1)_lb] // lower bounds of the slices codomains <br>
+   *   [double_y0_ub] ... [double_y(n-1)_ub] // upper bounds of the slices codomains <br>
+   *   [double_gate0_lb] ... [double_gaten_lb] // lower bounds of the gates <br>
+   *   [double_gate0_ub] ... [double_gaten_ub] // upper bounds of the gates <br>
+   *
+   * Empty intervals are stored as NaN bounds. The tdomain and codomain of the tube
+   * can be read from the header without reading the columns, and the columns can be
+   * accessed directly from a memory-mapped file (see MappedTubeFile).
+   *
+   * Tube binary structure (version 2): <br>
    *   [short_int_version_number] <br>
    *   [int_nb_slices] <br>
    *   [double_t0] <br>
@@ -57,6 +74,20 @@ namespace codac
    */
   void deserialize_Tube(std::ifstream& bin_file, Tube *&tube);
 
+  /**
+   * \brief Creates a Tube object from columns of values (version 3).
+   *
+   * \param nb_slices number of slices
+   * \param t time bounds of the slices (nb_slices+1 values)
+   * \param y_lb lower bounds of the slices codomains (nb_slices values)
+   * \param y_ub upper bounds of the slices codomains (nb_slices values)
+   * \param g_lb lower bounds of the gates (nb_slices+1 values)
+   * \param g_ub upper bounds of the gates (nb_slices+1 values)
+   * \param tube Tube object to be deserialized
+   */
+  void deserialize_Tube(int nb_slices, const double *t,
+    const double *y_lb, const double *y_ub, const double *g_lb, const double *g_ub, Tube *&tube);
+
   /// @}
   /// \name TubeVector
   /// @{
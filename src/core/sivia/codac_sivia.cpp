@@ -11,6 +11,13 @@
 #include <list>
 #include <iostream>
 #include <ctime>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <condition_variable>
+#include <chrono>
+#include <algorithm>
 
 #include "codac_sivia.h"
 #include "codac_VIBesFig.h"
@@ -334,4 +341,453 @@ namespace codac
 
     return boxes;
   }
-}
\ No newline at end of file
+
+  // Parallel SIVIA
+
+  /**
+   * \class SIVIABoxQueues
+   * \brief Boxes to be processed, shared among the threads of a parallel SIVIA.
+   *        Each thread has its own queue, and steals boxes from the other ones
+   *        when it is empty. A thread without boxes waits for new ones.
+   */
+  class SIVIABoxQueues
+  {
+    public:
+
+      SIVIABoxQueues(int nb_threads, bool best_first)
+        : m_queues(nb_threads), m_best_first(best_first)
+      {
+
+      }
+
+      ~SIVIABoxQueues()
+      {
+        clear();
+      }
+
+      // Deletes the remaining boxes (computations stopped by an exception),
+      // once the threads have been joined
+      void clear()
+      {
+        for(auto& q : m_queues)
+        {
+          for(auto& b : q.boxes)
+            delete b.second;
+          q.boxes.clear();
+        }
+        m_nb_queued = 0;
+      }
+
+      void push(int thread_id, IntervalVector *x)
+      {
+        m_nb_pending++;
+        Queue& q = m_queues[thread_id];
+        {
+          lock_guard<mutex> lock(q.m);
+          q.boxes.push_back(make_pair(x->max_diam(), x));
+          if(m_best_first)
+            push_heap(q.boxes.begin(), q.boxes.end(), smaller_box);
+        }
+
+        m_nb_queued++;
+        if(m_nb_waiting > 0)
+          notify(false);
+      }
+
+      // Returns the next box to be processed by the thread, waiting for
+      // boxes being bisected by other threads, or nullptr at the end
+      IntervalVector* wait_and_pop(int thread_id)
+      {
+        while(true)
+        {
+          if(m_stop) // remaining boxes are not processed
+            return nullptr;
+
+          IntervalVector *x = pop(thread_id);
+          if(x || finished())
+            return x;
+
+          unique_lock<mutex> lock(m_wait_mutex);
+          m_nb_waiting++;
+          m_cv.wait(lock, [this]() { return m_nb_queued > 0 || finished() || m_stop; });
+          m_nb_waiting--;
+        }
+      }
+
+      void done()
+      {
+        if(--m_nb_pending == 0)
+          notify(true);
+      }
+
+      void stop()
+      {
+        m_stop = true;
+        notify(true);
+      }
+
+    protected:
+
+      IntervalVector* pop(int thread_id)
+      {
+        int nb_queues = m_queues.size();
+
+        for(int k = 0 ; k < nb_queues ; k++)
+        {
+          Queue& q = m_queues[(thread_id + k) % nb_queues];
+          lock_guard<mutex> lock(q.m);
+
+          if(q.boxes.empty())
+            continue;
+
+          IntervalVector *x;
+
+          if(m_best_first) // largest box first
+          {
+            pop_heap(q.boxes.begin(), q.boxes.end(), smaller_box);
+            x = q.boxes.back().second;
+            q.boxes.pop_back();
+          }
+
+          else if(k == 0) // own queue: last bisected box, for a depth-first exploration
+          {
+            x = q.boxes.back().second;
+            q.boxes.pop_back();
+          }
+
+          else // stolen box: the oldest one, that is the largest
+          {
+            x = q.boxes.front().second;
+            q.boxes.pop_front();
+          }
+
+          m_nb_queued--;
+          return x;
+        }
+
+        return nullptr;
+      }
+
+      bool finished() const
+      {
+        return m_nb_pending == 0;
+      }
+
+      void notify(bool all)
+      {
+        // Locking ensures that a thread checking the wait condition is not missed
+        { lock_guard<mutex> lock(m_wait_mutex); }
+        if(all)
+          m_cv.notify_all();
+        else
+          m_cv.notify_one();
+      }
+
+      static bool smaller_box(const pair<double,IntervalVector*>& a, const pair<double,IntervalVector*>& b)
+      {
+        return a.first < b.first;
+      }
+
+      struct Queue
+      {
+        mutex m;
+        deque<pair<double,IntervalVector*> > boxes; // (width, box)
+      };
+
+      vector<Queue> m_queues;
+      const bool m_best_first;
+      atomic<long> m_nb_pending{0}; //!< number of boxes queued or being processed
+      atomic<long> m_nb_queued{0}; //!< number of boxes queued
+      atomic<int> m_nb_waiting{0}; //!< number of threads waiting for boxes
+      atomic<bool> m_stop{false}; //!< computations stopped by an exception
+      mutex m_wait_mutex;
+      condition_variable m_cv;
+  };
+
+  /**
+   * \class SIVIABoxPool
+   * \brief Boxes of a thread that are no longer used, kept for the next bisections
+   *        (boxes of same dimension are assigned without heap allocations)
+   */
+  class SIVIABoxPool
+  {
+    public:
+
+      ~SIVIABoxPool()
+      {
+        for(auto& x : m_v_free)
+          delete x;
+      }
+
+      IntervalVector* get(const IntervalVector& x)
+      {
+        if(m_v_free.empty())
+          return new IntervalVector(x);
+
+        IntervalVector *b = m_v_free.back();
+        m_v_free.pop_back();
+        *b = x;
+        return b;
+      }
+
+      void release(IntervalVector *x)
+      {
+        m_v_free.push_back(x);
+      }
+
+    protected:
+
+      vector<IntervalVector*> m_v_free;
+  };
+
+  // Same rule as ibex::LargestFirst(0.), without temporary vectors:
+  // the first component of largest diameter is bisected
+  void bisect_largest_first(IntervalVector& x1, IntervalVector& x2)
+  {
+    int i_max = 0;
+    for(int i = 1 ; i < x1.size() ; i++)
+      if(x1[i].diam() > x1[i_max].diam())
+        i_max = i;
+
+    pair<Interval,Interval> p = x1[i_max].bisect(ibex::Bsc::default_ratio());
+    x1[i_max] = p.first;
+    x2[i_max] = p.second;
+  }
+
+  // Function separating a box: (thread id, initial box, inner part, outer part)
+  typedef function<void(int,const IntervalVector&,IntervalVector&,IntervalVector&)> SIVIASeparation;
+
+  map<SetValue,list<IntervalVector>> _parallel_SIVIA(
+    const IntervalVector& x0, const SIVIASeparation& separate, bool with_in, float precision, int nb_threads,
+    bool best_first, bool regular_paving, bool display_result, const string& fig_name, bool return_result,
+    const SetColorMap& color_map)
+  {
+    assert(x0.size() >= 2);
+    assert(nb_threads > 0);
+
+    // Boxes are stored in buckets specific to each thread, merged at the end
+    bool keep_boxes = display_result || return_result;
+    vector<map<SetValue,list<IntervalVector>>> v_boxes(nb_threads);
+    vector<int> v_nb_contractions(nb_threads, 0);
+
+    SIVIABoxQueues queues(nb_threads, best_first);
+    queues.push(0, new IntervalVector(x0));
+
+    chrono::steady_clock::time_point t_start = chrono::steady_clock::now();
+
+    // An exception raised by a thread stops the computations, and is rethrown at the end
+    exception_ptr exception = nullptr;
+    mutex exception_mutex;
+
+    auto worker = [&](int thread_id)
+    {
+      SIVIABoxPool pool;
+      IntervalVector *x_before_ctc = nullptr;
+
+      try
+      {
+        map<SetValue,list<IntervalVector>>& boxes = v_boxes[thread_id];
+        IntervalVector x_in(x0.size()), x_out(x0.size());
+
+        while((x_before_ctc = queues.wait_and_pop(thread_id)))
+        {
+          v_nb_contractions[thread_id]++;
+          x_in = *x_before_ctc;
+          x_out = *x_before_ctc;
+
+          separate(thread_id, *x_before_ctc, x_in, x_out);
+
+          // In and Out values
+
+            if(keep_boxes)
+            {
+              if(regular_paving)
+              {
+                if(with_in && x_in.is_empty())
+                  boxes[SetValue::IN].push_front(*x_before_ctc);
+                if(x_out.is_empty())
+                  boxes[SetValue::OUT].push_front(*x_before_ctc);
+              }
+
+              else
+              {
+                if(with_in)
+                  for(const auto& i : box_diff(*x_before_ctc, x_in))
+                    boxes[SetValue::IN].push_front(i);
+                for(const auto& o : box_diff(*x_before_ctc, x_out))
+                  boxes[SetValue::OUT].push_front(o);
+              }
+            }
+
+          // Remaining values
+
+            x_in &= x_out;
+
+            if(!x_in.is_empty())
+            {
+              const IntervalVector& x_remaining = regular_paving ? *x_before_ctc : x_in;
+
+              if(x_remaining.max_diam() < precision)
+              {
+                if(keep_boxes)
+                  boxes[SetValue::UNKNOWN].push_front(x_remaining);
+              }
+
+              else
+              {
+                IntervalVector *x1 = pool.get(x_remaining), *x2 = pool.get(x_remaining);
+                bisect_largest_first(*x1, *x2);
+                queues.push(thread_id, x1);
+                queues.push(thread_id, x2);
+              }
+            }
+
+          pool.release(x_before_ctc);
+          x_before_ctc = nullptr;
+          queues.done();
+        }
+      }
+
+      catch(...)
+      {
+        delete x_before_ctc; // box being processed
+        lock_guard<mutex> lock(exception_mutex);
+        if(!exception)
+          exception = current_exception();
+        queues.stop();
+      }
+    };
+
+    {
+      // The threads are joined even if one of them cannot be created
+      vector<thread> v_threads;
+      struct ThreadsJoin
+      {
+        vector<thread>& v;
+        ~ThreadsJoin() { for(auto& t : v) t.join(); }
+      } threads_join{v_threads};
+
+      for(int i = 1 ; i < nb_threads ; i++)
+        v_threads.push_back(thread(worker, i));
+      worker(0); // the calling thread takes part in the computations
+    }
+
+    queues.clear();
+
+    if(exception)
+      rethrow_exception(exception);
+
+    double duration = chrono::duration<double>(chrono::steady_clock::now() - t_start).count();
+
+    // Merging the buckets of the threads
+
+    map<SetValue,list<IntervalVector>> boxes{
+      {SetValue::OUT, {}},
+      {SetValue::UNKNOWN, {}},
+    };
+    if(with_in) // SetValue::IN is not possible for SIVIA using Ctc
+      boxes[SetValue::IN] = {};
+
+    for(auto& thread_boxes : v_boxes)
+      for(auto& b : thread_boxes)
+        boxes[b.first].splice(boxes[b.first].end(), b.second);
+
+    if(display_result)
+    {
+      // Some values in the desired color map may not have been defined by the user
+      // We select default colors in this case
+
+        SetColorMap cm = DEFAULT_SET_COLOR_MAP;
+        for(const auto& c : color_map)
+          cm[c.first] = c.second;
+
+      if(!_vibes_initialized)
+      {
+        _vibes_initialized = true;
+        vibes::beginDrawing();
+        // will not be ended in case the init has been done outside this SIVIA function
+      }
+
+      if(!fig_name.empty())
+        vibes::newFigure(fig_name);
+
+      vibes::drawBox(x0.subvector(0,1));
+      vibes::newGroup("boxes_out", cm.at(SetValue::OUT));
+      vibes::newGroup("boxes_unknown", cm.at(SetValue::UNKNOWN));
+      if(with_in)
+        vibes::newGroup("boxes_in", cm.at(SetValue::IN));
+      vibes::axisAuto();
+
+      for(const auto& b : boxes)
+      {
+        string group = b.first == SetValue::IN ? "boxes_in" : (b.first == SetValue::OUT ? "boxes_out" : "boxes_unknown");
+        for(const auto& x : b.second)
+          vibes::drawBox(x.subvector(0,1), vibesParams("group", group));
+      }
+
+      int nb_contractions = 0;
+      for(const auto& k : v_nb_contractions)
+        nb_contractions += k;
+
+      printf( "Computation time: %.2fs (%d threads)\n", duration, nb_threads);
+      cout << "  Contractions:   " << nb_contractions << endl;
+      if(with_in)
+        cout << "  IN boxes:       " << boxes[SetValue::IN].size() << endl;
+      cout << "  OUT boxes:      " << boxes[SetValue::OUT].size() << endl;
+      cout << "  UNKNOWN boxes:  " << boxes[SetValue::UNKNOWN].size() << endl;
+    }
+
+    if(!return_result)
+      for(auto& b : boxes)
+        b.second.clear();
+
+    return boxes;
+  }
+
+  int sivia_nb_threads(int nb_threads)
+  {
+    if(nb_threads == 0)
+      nb_threads = thread::hardware_concurrency();
+    return max(1, nb_threads);
+  }
+
+  map<SetValue,list<IntervalVector>> SIVIA(
+    const IntervalVector& x0, const function<unique_ptr<Ctc>()>& ctc_factory, float precision, int nb_threads,
+    bool best_first, bool regular_paving, bool display_result, const string& fig_name, bool return_result,
+    const SetColorMap& color_map)
+  {
+    nb_threads = sivia_nb_threads(nb_threads);
+
+    // One contractor for each thread
+    vector<unique_ptr<Ctc>> v_ctc(nb_threads);
+    for(auto& ctc : v_ctc)
+      ctc = ctc_factory();
+
+    return _parallel_SIVIA(x0,
+      [&v_ctc](int thread_id, const IntervalVector& x, IntervalVector& x_in, IntervalVector& x_out)
+      {
+        v_ctc[thread_id]->contract(x_out);
+      },
+      false, precision, nb_threads, best_first, regular_paving, display_result, fig_name, return_result, color_map);
+  }
+
+  map<SetValue,list<IntervalVector>> SIVIA(
+    const IntervalVector& x0, const function<unique_ptr<ibex::Sep>()>& sep_factory, float precision, int nb_threads,
+    bool best_first, bool regular_paving, bool display_result, const string& fig_name, bool return_result,
+    const SetColorMap& color_map)
+  {
+    nb_threads = sivia_nb_threads(nb_threads);
+
+    // One separator for each thread
+    vector<unique_ptr<ibex::Sep>> v_sep(nb_threads);
+    for(auto& sep : v_sep)
+      sep = sep_factory();
+
+    return _parallel_SIVIA(x0,
+      [&v_sep](int thread_id, const IntervalVector& x, IntervalVector& x_in, IntervalVector& x_out)
+      {
+        v_sep[thread_id]->separate(x_in, x_out);
+      },
+      true, precision, nb_threads, best_first, regular_paving, display_result, fig_name, return_result, color_map);
+  }
+}
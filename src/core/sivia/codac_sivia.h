@@ -14,6 +14,8 @@
 
 #include <map>
 #include <list>
+#include <memory>
+#include <functional>
 #include <ibex_Sep.h>
 #include "codac_Ctc.h"
 #include "codac_VIBesFigPaving.h"
@@ -92,6 +94,63 @@ namespace codac
                                                      const std::string& fig_name = "", bool return_result = false,
                                                      const SetColorMap& color_map = DEFAULT_SET_COLOR_MAP);
 
+  /// @}
+  /// \name Parallel SIVIA
+  /// @{
+
+  /**
+   * \brief Executes a SIVIA algorithm from a contractor on several threads, and displays the result.
+   *        SIVIA: Set Inversion Via Interval Analysis.
+   * 
+   * Contractors are generally not reentrant: one contractor object is created for each thread by
+   * the `ctc_factory` function (called sequentially before the computations). Boxes are shared
+   * among the threads by work stealing. The result is displayed in the current VIBes figure,
+   * once all the boxes have been computed.
+   * 
+   * \param x initial box
+   * \param ctc_factory function creating a new Contractor operator for the set inversion
+   * \param precision accuracy of the paving algorithm
+   * \param nb_threads number of threads (0: number of concurrent threads supported by the hardware)
+   * \param best_first if true, each thread processes the largest of its boxes first, otherwise the last bisected one
+   * \param regular_paving regular bisection rule
+   * \param display_result display information if true
+   * \param fig_name name of the figure on which boxes are drawn. If empty, default figure is used
+   * \param return_result if true, boxes will be stored in the returned map
+   * \param color_map color map used to draw boxes, see SetColorMap
+   * \return return a map of lists of boxes. Keys of the map are IN/OUT/UNKNOWN. The lists are empty if return_result if false.
+   */
+  std::map<SetValue,std::list<IntervalVector>> SIVIA(const IntervalVector& x, const std::function<std::unique_ptr<Ctc>()>& ctc_factory,
+                                                     float precision, int nb_threads, bool best_first = false,
+                                                     bool regular_paving = false, bool display_result = true,
+                                                     const std::string& fig_name = "", bool return_result = false,
+                                                     const SetColorMap& color_map = DEFAULT_SET_COLOR_MAP);
+
+  /**
+   * \brief Executes a SIVIA algorithm from a separator on several threads, and displays the result.
+   *        SIVIA: Set Inversion Via Interval Analysis.
+   * 
+   * Separators are generally not reentrant: one separator object is created for each thread by
+   * the `sep_factory` function (called sequentially before the computations). Boxes are shared
+   * among the threads by work stealing. The result is displayed in the current VIBes figure,
+   * once all the boxes have been computed.
+   * 
+   * \param x initial box
+   * \param sep_factory function creating a new Separator operator for the set inversion
+   * \param precision accuracy of the paving algorithm
+   * \param nb_threads number of threads (0: number of concurrent threads supported by the hardware)
+   * \param best_first if true, each thread processes the largest of its boxes first, otherwise the last bisected one
+   * \param regular_paving regular bisection rule
+   * \param display_result display information if true
+   * \param fig_name name of the figure on which boxes are drawn. If empty, default figure is used
+   * \param return_result if true, boxes will be stored in the returned map
+   * \param color_map color map used to draw boxes, see SetColorMap
+   * \return return a map of lists of boxes. Keys of the map are IN/OUT/UNKNOWN. The lists are empty if return_result if false.
+   */
+  std::map<SetValue,std::list<IntervalVector>> SIVIA(const IntervalVector& x, const std::function<std::unique_ptr<ibex::Sep>()>& sep_factory,
+                                                     float precision, int nb_threads, bool best_first = false,
+                                                     bool regular_paving = false, bool display_result = true,
+                                                     const std::string& fig_name = "", bool return_result = false,
+                                                     const SetColorMap& color_map = DEFAULT_SET_COLOR_MAP);
 
   /// @}
 }
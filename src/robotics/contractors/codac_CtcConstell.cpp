@@ -9,17 +9,21 @@
  */
 
 #include <list>
+#include <numeric>
+#include <algorithm>
 #include "codac_CtcConstell.h"
 
 using namespace std;
 using namespace ibex;
 
+#define CONSTELL_LEAF_SIZE 8
+
 namespace codac
 {
   CtcConstell::CtcConstell(const vector<IntervalVector>& map)
     : Ctc(2), m_map(map)
   {
-    // todo: binary tree for logarithmic complexity
+    build_tree();
   }
 
   CtcConstell::CtcConstell(const list<IntervalVector>& map)
@@ -27,7 +31,7 @@ namespace codac
   {
     for(const auto& b : map)
       m_map.push_back(b);
-    // todo: binary tree for logarithmic complexity
+    build_tree();
   }
 
   CtcConstell::~CtcConstell()
@@ -40,8 +44,114 @@ namespace codac
     assert(a.size() == 2);
     IntervalVector union_result(2, Interval::EMPTY_SET);
 
-    for(const auto& mj : m_map)
-      union_result |= a & mj.subvector(0,1);
+    if(!m_tree.empty())
+      contract(a, 0, union_result);
     a = union_result;
   }
-}
\ No newline at end of file
+
+  void CtcConstell::contract(vector<IntervalVector>& v_a)
+  {
+    vector<IntervalVector> v_union_results(v_a.size(), IntervalVector(2, Interval::EMPTY_SET));
+
+    if(!m_tree.empty())
+    {
+      vector<int> v_ids(v_a.size());
+      iota(v_ids.begin(), v_ids.end(), 0);
+      contract(v_a, v_ids, 0, v_union_results);
+    }
+
+    for(size_t i = 0 ; i < v_a.size() ; i++)
+    {
+      assert(v_a[i].size() == 2);
+      v_a[i] = v_union_results[i];
+    }
+  }
+
+  void CtcConstell::build_tree()
+  {
+    // Empty landmarks have no effect on the union
+    for(const auto& mj : m_map)
+    {
+      IntervalVector b = mj.subvector(0,1);
+      if(!b.is_empty())
+        m_boxes.push_back(b);
+    }
+
+    m_tree.clear();
+    if(!m_boxes.empty())
+      build_node(0, m_boxes.size());
+  }
+
+  int CtcConstell::build_node(size_t begin, size_t end)
+  {
+    int node_id = m_tree.size();
+    m_tree.push_back(Node());
+
+    IntervalVector hull(2, Interval::EMPTY_SET);
+    for(size_t i = begin ; i < end ; i++)
+      hull |= m_boxes[i];
+
+    m_tree[node_id].box = hull;
+    m_tree[node_id].begin = begin;
+    m_tree[node_id].end = end;
+
+    if(end - begin > CONSTELL_LEAF_SIZE)
+    {
+      // Landmarks are split in two halves along the largest dimension of the node
+      int dim = hull[0].diam() >= hull[1].diam() ? 0 : 1;
+      size_t middle = (begin + end) / 2;
+      nth_element(m_boxes.begin() + begin, m_boxes.begin() + middle, m_boxes.begin() + end,
+        [dim](const IntervalVector& b1, const IntervalVector& b2) { return b1[dim].mid() < b2[dim].mid(); });
+
+      int left = build_node(begin, middle); // m_tree may be reallocated
+      int right = build_node(middle, end);
+      m_tree[node_id].left = left;
+      m_tree[node_id].right = right;
+    }
+
+    return node_id;
+  }
+
+  void CtcConstell::contract(const IntervalVector& a, int node_id, IntervalVector& union_result) const
+  {
+    const Node& node = m_tree[node_id];
+    if(!a.intersects(node.box))
+      return;
+
+    if(node.left == -1) // leaf
+      for(size_t i = node.begin ; i < node.end ; i++)
+        union_result |= a & m_boxes[i];
+
+    else
+    {
+      contract(a, node.left, union_result);
+      contract(a, node.right, union_result);
+    }
+  }
+
+  void CtcConstell::contract(const vector<IntervalVector>& v_a, const vector<int>& v_ids, int node_id,
+                             vector<IntervalVector>& v_union_results) const
+  {
+    const Node& node = m_tree[node_id];
+
+    // Boxes possibly intersecting the landmarks of this node
+    vector<int> v_node_ids;
+    for(int id : v_ids)
+      if(v_a[id].intersects(node.box))
+        v_node_ids.push_back(id);
+
+    if(v_node_ids.empty())
+      return;
+
+    if(node.left == -1) // leaf
+      for(size_t i = node.begin ; i < node.end ; i++)
+        for(int id : v_node_ids)
+          v_union_results[id] |= v_a[id] & m_boxes[i];
+
+    else
+    {
+      contract(v_a, v_node_ids, node.left, v_union_results);
+      contract(v_a, v_node_ids, node.right, v_union_results);
+    }
+  }
+}
@@ -21,6 +21,10 @@ namespace codac
   /**
    * \brief CtcConstell class.
    *
+   * Contracts a box on the union of the boxes of a map of landmarks.
+   * The 2d boxes of the map are stored in a static bounding volume hierarchy
+   * built at construction, so that only the landmarks that may intersect
+   * a box are visited during a contraction.
    */
   class CtcConstell : public Ctc
   {
@@ -31,10 +35,47 @@ namespace codac
       ~CtcConstell();
       void contract(IntervalVector &beacon_box);
 
+      /**
+       * \brief Contracts a set of boxes, with one traversal of the hierarchy for all of them
+       *
+       * \param v_beacon_boxes the 2d boxes to be contracted
+       */
+      void contract(std::vector<IntervalVector>& v_beacon_boxes);
+
     protected:
 
+      /**
+       * \brief Node of the bounding volume hierarchy
+       */
+      struct Node
+      {
+        IntervalVector box = IntervalVector(2); //!< hull of the landmarks of the node
+        std::size_t begin, end; //!< range of the landmarks of the node in m_boxes
+        int left = -1, right = -1; //!< children nodes, or -1 for a leaf
+      };
+
+      /**
+       * \brief Builds the hierarchy from the current map
+       */
+      void build_tree();
+
+      /**
+       * \brief Creates the node of the landmarks of m_boxes in [begin,end[, and its children
+       *
+       * \param begin index of the first landmark of the node
+       * \param end index following the last landmark of the node
+       * \return the index of the node in m_tree
+       */
+      int build_node(std::size_t begin, std::size_t end);
+
+      void contract(const IntervalVector& a, int node_id, IntervalVector& union_result) const;
+      void contract(const std::vector<IntervalVector>& v_a, const std::vector<int>& v_ids, int node_id,
+                    std::vector<IntervalVector>& v_union_results) const;
+
       std::vector<IntervalVector> m_map;
+      std::vector<IntervalVector> m_boxes; //!< non-empty 2d boxes of the map, ordered by the hierarchy
+      std::vector<Node> m_tree; //!< bounding volume hierarchy, m_tree[0] being the root
   };
 }
 
-#endif
\ No newline at end of file
+#endif
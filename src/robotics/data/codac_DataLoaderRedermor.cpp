@@ -13,6 +13,8 @@
 #include "codac_TFunction.h"
 #include "codac_Exception.h"
 #include "codac_Tube.h"
+#include "codac_DataStream.h"
+#include "codac_TubeStreamBuilder.h"
 
 using namespace std;
 using namespace ibex;
@@ -39,37 +41,36 @@ namespace codac
       if(!m_datafile->is_open())
         throw Exception(__func__, "data file not already open");
 
-      int i = 0;
-      string line;
-      TrajectoryVector traj_data_x(10), traj_data_dx(10);
+      // The file is parsed as a stream: tubes are built incrementally,
+      // without storing the samples of the sensors
+
+      DataStream data(m_file_path);
+      TubeStreamBuilder data_x(10, timestep);
       truth = new TrajectoryVector(6);
 
-      while(getline(*m_datafile, line))
+      Vector y(10), dy(10), x0(2);
+      vector<double> v_values;
+      data.skip_lines(45); // accessing data
+
+      while(data.line_number() < 59999 && data.read_line(v_values)) // until the end of data
       {
-        i ++;
-        if(i < 46) continue; // accessing data
-        if(i == 60000) break; // end of data
-
-        double t;
-        Vector y(10), dy(10);
-
-        istringstream iss(line);
-        if(!(iss >> t
-                 >> y[0] >> dy[0]   // phi
-                 >> y[1] >> dy[1]   // theta
-                 >> y[2] >> dy[2]   // psi
-                 >> y[3] >> dy[3]   // vx
-                 >> y[4] >> dy[4]   // vy
-                 >> y[5] >> dy[5]   // vz
-                 >> y[6] >> dy[6]   // depth
-                 >> y[7] >> dy[7]   // alt
-                 >> y[8] >> dy[8]   // x
-                 >> y[9] >> dy[9])) // y
+        if(v_values.size() < 21)
           throw Exception(__func__, "fail loading data");
 
-        // Trajectory used for velocities evaluations:
-        traj_data_x.set(y, t);
-        traj_data_dx.set(dy, t);
+        double t = v_values[0];
+        for(int k = 0 ; k < 10 ; k++)
+        {
+          // phi, theta, psi, vx, vy, vz, depth, alt, x, y
+          y[k] = v_values[1+2*k];
+          dy[k] = v_values[2+2*k];
+        }
+
+        // Initial horizontal position
+        if(data_x.nb_samples() == 0)
+          x0 = y.subvector(8,9);
+
+        // Data from sensors with uncertainties:
+        data_x.add(t, y, dy);
 
         // Trajectory used as ground truth:
         Vector truth_vector(6);
@@ -79,9 +80,8 @@ namespace codac
         truth->set(truth_vector, t);
       }
 
-      // Data from sensors with uncertainties:
-      x = new TubeVector(traj_data_x, timestep); // state vector
-      x->inflate(traj_data_dx);
+      x = data_x.build(); // state vector
+      Tube depth = (*x)[6];
       x->resize(6);
 
       // Computing robot's velocities:
@@ -97,13 +97,11 @@ namespace codac
       TubeVector velocities = f.eval_vector(*x);
 
       // Horizontal position
-      (*x)[0] = velocities[0].primitive(traj_data_x[8](traj_data_x.tdomain().lb())); // datafile: robot starts at (0.06,0.)
-      (*x)[1] = velocities[1].primitive(traj_data_x[9](traj_data_x.tdomain().lb()));
+      (*x)[0] = velocities[0].primitive(x0[0]); // datafile: robot starts at (0.06,0.)
+      (*x)[1] = velocities[1].primitive(x0[1]);
 
       // Case of the depth, directly sensed:
-      (*x)[2].set_empty();
-      (*x)[2] |= traj_data_x[6]; // envelope of the trajectory
-      (*x)[2].inflate(traj_data_dx[6]);
+      (*x)[2] = depth; // envelope of the trajectory, inflated by the uncertainties
 
       // 3d velocities
       (*x)[3] = velocities[0];
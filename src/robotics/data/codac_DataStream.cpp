@@ -0,0 +1,223 @@
+/**
+ *  DataStream class
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <cstring>
+#include <cstdlib>
+#include <fstream>
+#include <charconv>
+#include "codac_DataStream.h"
+#include "codac_Exception.h"
+
+#ifndef _WIN32
+  #include <fcntl.h>
+  #include <unistd.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+#endif
+
+using namespace std;
+
+namespace codac
+{
+  namespace
+  {
+    bool is_separator(char c)
+    {
+      return c == ' ' || c == '\t' || c == '\r' || c == ',' || c == ';';
+    }
+
+    // Parses a value in [begin,end), returns a pointer past the parsed characters
+    const char* parse_value(const char *begin, const char *end, double& x)
+    {
+      #if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+
+        const char *first = begin;
+        if(first < end && *first == '+') // explicit sign, not accepted by from_chars
+          first++;
+
+        from_chars_result res = from_chars(first, end, x);
+        if(res.ec != errc())
+          return begin;
+        return res.ptr;
+
+      #else
+
+        // strtod needs a null-terminated string: the token is copied
+        char token[64];
+        size_t n = 0;
+        while(begin + n < end && !is_separator(begin[n]) && n < sizeof(token)-1)
+          n++;
+        memcpy(token, begin, n);
+        token[n] = '\0';
+
+        char *token_end;
+        x = strtod(token, &token_end);
+        return begin + (token_end - token);
+
+      #endif
+    }
+  }
+
+  DataStream::DataStream(const string& file_path, size_t chunk_size)
+    : m_file_path(file_path), m_chunk_size(chunk_size)
+  {
+    assert(chunk_size > 0);
+
+    #ifndef _WIN32
+
+      m_fd = open(file_path.c_str(), O_RDONLY);
+      if(m_fd < 0)
+        throw Exception(__func__, "unable to load data file");
+
+      struct stat st;
+      if(fstat(m_fd, &st) < 0)
+      {
+        close(m_fd);
+        throw Exception(__func__, "unable to load data file");
+      }
+
+      m_file_size = st.st_size;
+
+      // Chunks are mapped from offsets that are multiples of the page size:
+      // a line starting in the last page of a chunk is then entirely in the next one
+      size_t page_size = sysconf(_SC_PAGESIZE);
+      m_chunk_size = max(2*page_size, m_chunk_size - m_chunk_size % page_size);
+
+    #else
+
+      ifstream file(file_path.c_str(), ios::in | ios::binary | ios::ate);
+      if(!file.is_open())
+        throw Exception(__func__, "unable to load data file");
+      m_file_size = file.tellg();
+
+    #endif
+  }
+
+  DataStream::~DataStream()
+  {
+    #ifndef _WIN32
+      if(m_chunk)
+        munmap((void*)m_chunk, m_chunk_length);
+      close(m_fd);
+    #endif
+  }
+
+  bool DataStream::skip_lines(int nb_lines)
+  {
+    const char *begin, *end;
+    for(int i = 0 ; i < nb_lines ; i++)
+      if(!next_line(begin, end))
+        return false;
+    return true;
+  }
+
+  bool DataStream::read_line(vector<double>& v_values)
+  {
+    const char *begin, *end;
+    if(!next_line(begin, end))
+      return false;
+
+    v_values.clear();
+    const char *c = begin;
+
+    while(true)
+    {
+      while(c < end && is_separator(*c))
+        c++;
+
+      if(c == end)
+        break;
+
+      double x;
+      const char *next = parse_value(c, end, x);
+      if(next == c || (next < end && !is_separator(*next)))
+        throw Exception(__func__, "unable to parse line " + to_string(m_line_number) + " of " + m_file_path);
+
+      v_values.push_back(x);
+      c = next;
+    }
+
+    return true;
+  }
+
+  int DataStream::line_number() const
+  {
+    return m_line_number;
+  }
+
+  // Protected methods
+
+  bool DataStream::next_line(const char *&begin, const char *&end)
+  {
+    if(m_pos >= m_file_size)
+      return false;
+
+    if(!m_chunk || m_pos >= m_chunk_offset + m_chunk_length)
+      load_chunk(m_pos);
+
+    const char *chunk_end = m_chunk + m_chunk_length;
+    begin = m_chunk + (m_pos - m_chunk_offset);
+    end = (const char*)memchr(begin, '\n', chunk_end - begin);
+
+    if(!end && m_chunk_offset + m_chunk_length < m_file_size)
+    {
+      // The line continues in the next part of the file:
+      // the chunk is mapped again from the beginning of the line
+      load_chunk(m_pos);
+      chunk_end = m_chunk + m_chunk_length;
+      begin = m_chunk + (m_pos - m_chunk_offset);
+      end = (const char*)memchr(begin, '\n', chunk_end - begin);
+
+      if(!end && m_chunk_offset + m_chunk_length < m_file_size)
+        throw Exception(__func__, "line longer than the chunk size in " + m_file_path);
+    }
+
+    if(!end) // last line, without end-of-line character
+      end = chunk_end;
+
+    m_pos = m_chunk_offset + (end - m_chunk) + 1;
+    m_line_number++;
+    return true;
+  }
+
+  void DataStream::load_chunk(size_t offset)
+  {
+    #ifndef _WIN32
+
+      if(m_chunk)
+        munmap((void*)m_chunk, m_chunk_length);
+      m_chunk = nullptr;
+
+      m_chunk_offset = offset - offset % sysconf(_SC_PAGESIZE);
+      m_chunk_length = min(m_chunk_size, m_file_size - m_chunk_offset);
+
+      void *data = mmap(nullptr, m_chunk_length, PROT_READ, MAP_PRIVATE, m_fd, m_chunk_offset);
+      if(data == MAP_FAILED)
+        throw Exception(__func__, "unable to map data file " + m_file_path);
+
+      madvise(data, m_chunk_length, MADV_SEQUENTIAL);
+      m_chunk = (const char*)data;
+
+    #else
+
+      m_chunk_offset = offset;
+      m_chunk_length = min(m_chunk_size, m_file_size - m_chunk_offset);
+
+      ifstream file(m_file_path.c_str(), ios::in | ios::binary);
+      m_buffer.resize(m_chunk_length);
+      file.seekg(m_chunk_offset);
+      file.read(m_buffer.data(), m_chunk_length);
+      if(!file)
+        throw Exception(__func__, "unable to read data file " + m_file_path);
+      m_chunk = m_buffer.data();
+
+    #endif
+  }
+}
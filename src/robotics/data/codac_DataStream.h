@@ -0,0 +1,108 @@
+/**
+ *  DataStream class
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __CODAC_DATASTREAM_H__
+#define __CODAC_DATASTREAM_H__
+
+#include <string>
+#include <vector>
+
+#define DATA_STREAM_CHUNK_SIZE (64 << 20) // size of the mapped chunks, in bytes
+
+namespace codac
+{
+  /**
+   * \class DataStream
+   * \brief Sequential reading of a text file of numerical values, line by line
+   *
+   * The file is mapped in memory by chunks, so that arbitrarily long logs
+   * can be read with a bounded memory. Values are parsed directly from
+   * the mapped memory, without stream objects.
+   *
+   * \note Values can be separated by spaces, tabulations, commas or semicolons.
+   */
+  class DataStream
+  {
+    public:
+
+      /**
+       * \brief Opens a data file
+       *
+       * \param file_path path to the text file
+       * \param chunk_size size in bytes of the chunks mapped in memory, that must be
+       *        greater than the length of any line of the file plus the size of a memory page
+       */
+      explicit DataStream(const std::string& file_path, std::size_t chunk_size = DATA_STREAM_CHUNK_SIZE);
+
+      /**
+       * \brief DataStream destructor, unmaps the last chunk and closes the file
+       */
+      ~DataStream();
+
+      DataStream(const DataStream&) = delete;
+      DataStream& operator=(const DataStream&) = delete;
+
+      /**
+       * \brief Skips lines, for instance a header
+       *
+       * \param nb_lines number of lines to be skipped
+       * \return `false` if the end of the file has been reached
+       */
+      bool skip_lines(int nb_lines);
+
+      /**
+       * \brief Reads and parses the next line of the file
+       *
+       * An exception is raised if a value cannot be parsed.
+       *
+       * \param v_values vector in which the values of the line are set
+       * \return `false` if the end of the file has been reached
+       */
+      bool read_line(std::vector<double>& v_values);
+
+      /**
+       * \brief Returns the number of lines read or skipped so far
+       *
+       * \return the number of lines
+       */
+      int line_number() const;
+
+    protected:
+
+      /**
+       * \brief Locates the next line of the file, mapping a new chunk if needed
+       *
+       * \param begin pointer to the first character of the line
+       * \param end pointer past the last character of the line
+       * \return `false` if the end of the file has been reached
+       */
+      bool next_line(const char *&begin, const char *&end);
+
+      /**
+       * \brief Maps a chunk of the file from a given position
+       *
+       * \param offset position in the file, that will be included in the chunk
+       */
+      void load_chunk(std::size_t offset);
+
+      std::string m_file_path; //!< path to the file
+      int m_fd = -1; //!< file descriptor
+      std::size_t m_file_size = 0; //!< size of the file in bytes
+      std::size_t m_chunk_size; //!< maximal size of the mapped chunks
+      const char *m_chunk = nullptr; //!< mapped chunk of the file
+      std::size_t m_chunk_offset = 0; //!< position of the chunk in the file
+      std::size_t m_chunk_length = 0; //!< size of the chunk in bytes
+      std::size_t m_pos = 0; //!< position of the next line in the file
+      std::vector<char> m_buffer; //!< chunk of the file when memory mapping is not available
+      int m_line_number = 0; //!< number of lines read or skipped
+  };
+}
+
+#endif
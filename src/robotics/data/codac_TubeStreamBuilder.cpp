@@ -0,0 +1,141 @@
+/**
+ *  TubeStreamBuilder class
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include "codac_TubeStreamBuilder.h"
+#include "codac_Exception.h"
+
+using namespace std;
+using namespace ibex;
+
+namespace codac
+{
+  TubeStreamBuilder::TubeStreamBuilder(int n, double timestep)
+    : m_n(n), m_timestep(timestep == 0. ? POS_INFINITY : timestep), // if 0., equivalent to no sampling
+      m_y_prev(n), m_rad_prev(n), m_ingate_y(n), m_ingate_rad(n), m_hull_y(n), m_hull_rad(n)
+  {
+    assert(n > 0);
+    assert(timestep >= 0.);
+  }
+
+  TubeStreamBuilder::~TubeStreamBuilder()
+  {
+    if(m_x)
+      delete m_x;
+  }
+
+  int TubeStreamBuilder::size() const
+  {
+    return m_n;
+  }
+
+  int TubeStreamBuilder::nb_samples() const
+  {
+    return m_nb_samples;
+  }
+
+  void TubeStreamBuilder::add(double t, const Vector& y)
+  {
+    add(t, y, Vector(m_n, 0.));
+  }
+
+  void TubeStreamBuilder::add(double t, const Vector& y, const Vector& rad)
+  {
+    assert(y.size() == m_n && rad.size() == m_n);
+
+    if(m_nb_samples == 0)
+    {
+      m_t_lb = t;
+      m_t_ub = t + m_timestep;
+      m_ingate_y = y; m_ingate_rad = rad;
+      m_hull_y = IntervalVector(y); m_hull_rad = IntervalVector(rad);
+    }
+
+    else
+    {
+      if(!(t > m_t_prev))
+        throw Exception(__func__, "samples must be added in increasing order of time");
+
+      // Completed slices, with values interpolated at their upper bound
+
+      while(t > m_t_ub)
+      {
+        Vector y_ub(m_y_prev), rad_ub(m_rad_prev);
+
+        if(m_t_ub != m_t_prev) // linear interpolation, as Trajectory evaluations do
+          for(int i = 0 ; i < m_n ; i++)
+          {
+            y_ub[i] = m_y_prev[i] + (m_t_ub - m_t_prev) * (y[i] - m_y_prev[i]) / (t - m_t_prev);
+            rad_ub[i] = m_rad_prev[i] + (m_t_ub - m_t_prev) * (rad[i] - m_rad_prev[i]) / (t - m_t_prev);
+          }
+
+        close_slice(y_ub, rad_ub);
+      }
+
+      for(int i = 0 ; i < m_n ; i++)
+      {
+        m_hull_y[i] |= y[i];
+        m_hull_rad[i] |= rad[i];
+      }
+    }
+
+    m_t_prev = t;
+    m_y_prev = y; m_rad_prev = rad;
+    m_nb_samples++;
+  }
+
+  TubeVector* TubeStreamBuilder::build()
+  {
+    if(m_nb_samples < 2)
+      throw Exception(__func__, "at least two samples are required to build a tube");
+
+    // The last slice may be smaller than the timestep
+    m_t_ub = m_t_prev;
+    close_slice(m_y_prev, m_rad_prev);
+
+    TubeVector *x = m_x;
+    m_x = nullptr;
+    m_nb_samples = 0;
+    return x;
+  }
+
+  // Protected methods
+
+  void TubeStreamBuilder::close_slice(const Vector& y_ub, const Vector& rad_ub)
+  {
+    for(int i = 0 ; i < m_n ; i++)
+    {
+      m_hull_y[i] |= y_ub[i];
+      m_hull_rad[i] |= rad_ub[i];
+    }
+
+    if(!m_x) // first slice
+    {
+      m_x = new TubeVector(Interval(m_t_lb, m_t_ub), m_n);
+      for(int i = 0 ; i < m_n ; i++)
+        (*m_x)[i].first_slice()->set_input_gate(m_ingate_y[i] + Interval(-1.,1.) * m_ingate_rad[i], false);
+    }
+
+    else
+      m_x->extend_tdomain(m_t_ub);
+
+    for(int i = 0 ; i < m_n ; i++)
+    {
+      Slice *s = (*m_x)[i].last_slice();
+      s->set_envelope(m_hull_y[i] + Interval(-1.,1.) * m_hull_rad[i], false);
+      s->set_output_gate(y_ub[i] + Interval(-1.,1.) * rad_ub[i], false);
+    }
+
+    // Next slice, starting from the values at the upper bound of this one
+
+    m_t_lb = m_t_ub;
+    m_t_ub = m_t_lb + m_timestep;
+    m_hull_y = IntervalVector(y_ub); m_hull_rad = IntervalVector(rad_ub);
+  }
+}
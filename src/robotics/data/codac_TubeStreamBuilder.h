@@ -0,0 +1,117 @@
+/**
+ *  TubeStreamBuilder class
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __CODAC_TUBESTREAMBUILDER_H__
+#define __CODAC_TUBESTREAMBUILDER_H__
+
+#include "codac_Vector.h"
+#include "codac_IntervalVector.h"
+#include "codac_TubeVector.h"
+
+namespace codac
+{
+  /**
+   * \class TubeStreamBuilder
+   * \brief Incremental construction of a TubeVector from a stream of timestamped samples
+   *
+   * Samples are aggregated into slices of constant timestep, appended to the tube
+   * as soon as they are complete: the memory does not depend on the number of
+   * samples but only on the number of slices.
+   *
+   * The result is the same as building the tube from the TrajectoryVector \f$\mathbf{y}(\cdot)\f$
+   * of the samples (linear interpolations between samples), then inflating it by the
+   * TrajectoryVector \f$\mathbf{r}(\cdot)\f$ of the uncertainties:
+   * `TubeVector x(y, timestep); x.inflate(r);`
+   */
+  class TubeStreamBuilder
+  {
+    public:
+
+      /**
+       * \brief Creates a builder of n-dimensional tubes
+       *
+       * \param n dimension of the samples
+       * \param timestep sampling value \f$\delta\f$ for the temporal discretization (double, no discretization if 0)
+       */
+      TubeStreamBuilder(int n, double timestep);
+
+      /**
+       * \brief TubeStreamBuilder destructor
+       */
+      ~TubeStreamBuilder();
+
+      TubeStreamBuilder(const TubeStreamBuilder&) = delete;
+      TubeStreamBuilder& operator=(const TubeStreamBuilder&) = delete;
+
+      /**
+       * \brief Returns the dimension of the samples
+       *
+       * \return n
+       */
+      int size() const;
+
+      /**
+       * \brief Returns the number of samples added since the last construction
+       *
+       * \return the number of samples
+       */
+      int nb_samples() const;
+
+      /**
+       * \brief Adds a sample without uncertainty
+       *
+       * \param t time of the sample, greater than the time of the previous sample
+       * \param y value of the sample
+       */
+      void add(double t, const Vector& y);
+
+      /**
+       * \brief Adds a sample with uncertainties
+       *
+       * \param t time of the sample, greater than the time of the previous sample
+       * \param y value of the sample
+       * \param rad radius of the uncertainty of each component of the sample (positive values)
+       */
+      void add(double t, const Vector& y, const Vector& rad);
+
+      /**
+       * \brief Completes the last slice and returns the tube built from the samples
+       *
+       * \note The builder is then ready for a new stream of samples
+       *
+       * \return a pointer to the new TubeVector object, to be deleted by the caller
+       */
+      TubeVector* build();
+
+    protected:
+
+      /**
+       * \brief Appends the current slice to the tube
+       *
+       * \param y_ub value at the upper bound of the slice
+       * \param rad_ub uncertainty at the upper bound of the slice
+       */
+      void close_slice(const Vector& y_ub, const Vector& rad_ub);
+
+      const int m_n; //!< dimension of the samples
+      const double m_timestep; //!< temporal width of the slices
+      TubeVector *m_x = nullptr; //!< completed slices
+
+      int m_nb_samples = 0; //!< number of samples added to the tube
+      double m_t_prev = 0.; //!< time of the last sample
+      Vector m_y_prev, m_rad_prev; //!< value of the last sample
+
+      double m_t_lb = 0., m_t_ub = 0.; //!< tdomain of the current slice
+      Vector m_ingate_y, m_ingate_rad; //!< value at the lower bound of the first slice
+      IntervalVector m_hull_y, m_hull_rad; //!< envelopes of the values on the current slice
+  };
+}
+
+#endif
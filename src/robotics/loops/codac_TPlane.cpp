@@ -9,6 +9,11 @@
  */
 
 #include <ctime>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <exception>
+#include <condition_variable>
 #include "codac_TPlane.h"
 
 using namespace std;
@@ -17,75 +22,35 @@ using namespace ibex;
 namespace codac
 {
   TPlane::TPlane(const Interval& tdomain)
-    : Paving(IntervalVector(2, tdomain), SetValue::UNKNOWN), m_precision(0), m_v_detected_loops(), m_v_proven_loops(), 
-      m_first_subtplane(nullptr), m_second_subtplane(nullptr)
+    : Paving(IntervalVector(2, tdomain), SetValue::UNKNOWN), m_precision(0), m_v_detected_loops(), m_v_proven_loops()
   {
 
   }
   
   TPlane::TPlane(const TPlane& t)
-    : Paving(t), m_precision(t.m_precision), m_v_detected_loops(t.m_v_detected_loops), m_v_proven_loops(t.m_v_proven_loops), 
-      m_first_subtplane(nullptr), m_second_subtplane(nullptr)
+    : Paving(t), m_precision(t.m_precision), m_nb_threads(t.m_nb_threads), m_v_detected_loops(t.m_v_detected_loops), m_v_proven_loops(t.m_v_proven_loops)
   {
-    if(t.m_first_subtplane)
-    {
-      m_first_subtplane = new TPlane(t.m_first_subtplane->m_box[0]);
-      *m_first_subtplane = *t.m_first_subtplane;
-    }
-    if(t.m_second_subtplane)
-    {
-      m_second_subtplane = new TPlane(t.m_second_subtplane->m_box[0]);
-      *m_second_subtplane = *t.m_second_subtplane;
-    }
+
   }
 
   TPlane::TPlane(const TPlane* t, const Paving* p)
-    : Paving(*p), m_precision(t->m_precision), m_v_detected_loops(t->m_v_detected_loops), m_v_proven_loops(t->m_v_proven_loops), 
-      m_first_subtplane(nullptr), m_second_subtplane(nullptr)
+    : Paving(*p), m_precision(t->m_precision), m_nb_threads(t->m_nb_threads), m_v_detected_loops(t->m_v_detected_loops), m_v_proven_loops(t->m_v_proven_loops)
   {
     m_verbose = t->m_verbose;
-    if(t->m_first_subtplane)
-    {
-      m_first_subtplane = new TPlane(t->m_first_subtplane->m_box[0]);
-      *m_first_subtplane = *t->m_first_subtplane;
-    }
-    if(t->m_second_subtplane)
-    {
-      m_second_subtplane = new TPlane(t->m_second_subtplane->m_box[0]);
-      *m_second_subtplane = *t->m_second_subtplane;
-    }
   }
 
   TPlane::~TPlane()
   {
-    if(m_first_subtplane)
-    {
-      delete m_first_subtplane;
-    }
-    if(m_second_subtplane)
-    {
-      delete m_second_subtplane;
-    }
+
   }
   
   TPlane& TPlane::operator=(const TPlane& t)
   {
     Paving::operator = (t);      
     m_precision = t.m_precision;
+    m_nb_threads = t.m_nb_threads;
     m_v_detected_loops = t.m_v_detected_loops;
     m_v_proven_loops = t.m_v_proven_loops;
-    m_first_subtplane = nullptr;
-    m_second_subtplane = nullptr;
-    if(t.m_first_subtplane)
-    {
-      m_first_subtplane = new TPlane(t.m_first_subtplane->m_box[0]);
-      *m_first_subtplane = *t.m_first_subtplane;
-    }
-    if(t.m_second_subtplane)
-    {
-      m_second_subtplane = new TPlane(t.m_second_subtplane->m_box[0]);
-      *m_second_subtplane = *t.m_second_subtplane;
-    }
     return *this;
   }
 
@@ -105,46 +70,19 @@ namespace codac
     compute_detections(precision, p, v, true, true);
   }
 
-  void TPlane::compute_detections(float precision, const TubeVector& p, const TubeVector& v, bool with_derivative, bool extract_subsets)
+  namespace
   {
-    assert(precision > 0.);
-    assert(p.tdomain().is_superset(box()[0]));
-
-    if(with_derivative)
-    {
-      assert(p.tdomain() == v.tdomain());
-      assert(p.size() == 2 && v.size() == 2);
-    }
-
-    if(m_box.is_unbounded())
-      m_box = IntervalVector(2, p.tdomain()); // initializing
-    m_precision = precision;
-    
-    if(value() == SetValue::OUT)
-      return;
-
-    else if(!is_leaf())
-    {
-      //((TPlane*)m_first_subpaving)->compute_detections(precision, p, v, with_derivative, false);
-      //((TPlane*)m_second_subpaving)->compute_detections(precision, p, v, with_derivative, false);
-      m_first_subtplane = new TPlane(this, m_first_subpaving);
-      m_first_subtplane->compute_detections(precision, p, v, with_derivative, false);
-      *m_first_subpaving = *m_first_subtplane;
-      delete m_first_subtplane; m_first_subtplane = nullptr;
-      m_second_subtplane = new TPlane(this, m_second_subpaving);
-      m_second_subtplane->compute_detections(precision, p, v, with_derivative, false);
-      *m_second_subpaving = *m_second_subtplane;
-      delete m_second_subtplane; m_second_subtplane = nullptr;
-    }
+    // Evaluates a leaf of the tplane: its value is set, or the leaf
+    // is bisected when no conclusion can be made (then returns true)
 
-    else
+    bool evaluate_leaf(Paving *x, float precision, const TubeVector& p, const TubeVector& v, bool with_derivative)
     {
-      const Interval t1 = m_box[0], t2 = m_box[1];
+      const Interval t1 = x->box()[0], t2 = x->box()[1];
       const IntervalVector box_neg_reals(2, Interval::NEG_REALS);
       const IntervalVector box_pos_reals(2, Interval::POS_REALS);
 
       // Based on derivative information
-      
+    
       bool derivative_out = false, derivative_in = false;
 
       if(with_derivative)
@@ -160,58 +98,250 @@ namespace codac
                      && box_neg_reals.is_strict_superset(partial_integ.first)
                      && box_pos_reals.is_strict_superset(partial_integ.second);
       }
-      
+    
       // Based on primitive information (<=> kernel)
 
-        pair<IntervalVector,IntervalVector> uy1 = p.eval(t1);
-        pair<IntervalVector,IntervalVector> uy2 = p.eval(t2);
-        pair<IntervalVector,IntervalVector> enc_bounds = make_pair(
-          IntervalVector(uy1.first.lb()  - uy2.second.ub()) | (uy1.first.ub()  - uy2.second.lb()),
-          IntervalVector(uy1.second.lb() - uy2.first.ub())  | (uy1.second.ub() - uy2.first.lb()));
+      pair<IntervalVector,IntervalVector> uy1 = p.eval(t1);
+      pair<IntervalVector,IntervalVector> uy2 = p.eval(t2);
+      pair<IntervalVector,IntervalVector> enc_bounds = make_pair(
+        IntervalVector(uy1.first.lb()  - uy2.second.ub()) | (uy1.first.ub()  - uy2.second.lb()),
+        IntervalVector(uy1.second.lb() - uy2.first.ub())  | (uy1.second.ub() - uy2.first.lb()));
 
-        bool primitive_out = Interval::POS_REALS.is_strict_superset(t1 - t2)
-                             || Interval::POS_REALS.is_strict_superset(enc_bounds.first[0])
-                             || Interval::POS_REALS.is_strict_superset(enc_bounds.first[1])
-                             || Interval::NEG_REALS.is_strict_superset(enc_bounds.second[0])
-                             || Interval::NEG_REALS.is_strict_superset(enc_bounds.second[1]);
+      bool primitive_out = Interval::POS_REALS.is_strict_superset(t1 - t2)
+                           || Interval::POS_REALS.is_strict_superset(enc_bounds.first[0])
+                           || Interval::POS_REALS.is_strict_superset(enc_bounds.first[1])
+                           || Interval::NEG_REALS.is_strict_superset(enc_bounds.second[0])
+                           || Interval::NEG_REALS.is_strict_superset(enc_bounds.second[1]);
 
-        bool primitive_in = Interval::NEG_REALS.is_strict_superset(t1 - t2)
-                             && Interval::NEG_REALS.is_strict_superset(enc_bounds.first[0])
-                             && Interval::NEG_REALS.is_strict_superset(enc_bounds.first[1])
-                             && Interval::POS_REALS.is_strict_superset(enc_bounds.second[0])
-                             && Interval::POS_REALS.is_strict_superset(enc_bounds.second[1]);
+      bool primitive_in = Interval::NEG_REALS.is_strict_superset(t1 - t2)
+                           && Interval::NEG_REALS.is_strict_superset(enc_bounds.first[0])
+                           && Interval::NEG_REALS.is_strict_superset(enc_bounds.first[1])
+                           && Interval::POS_REALS.is_strict_superset(enc_bounds.second[0])
+                           && Interval::POS_REALS.is_strict_superset(enc_bounds.second[1]);
 
       // Conclusion
 
-        if(derivative_out || primitive_out)
-          set_value(SetValue::OUT);
+      if(derivative_out || primitive_out)
+        x->set_value(SetValue::OUT);
+
+      else if(derivative_in && primitive_in)
+        x->set_value(SetValue::IN);
+
+      else if(std::max(t1.diam(), t2.diam()) < precision)
+        x->set_value(SetValue::UNKNOWN);
+
+      else
+      {
+        x->bisect();
+        return true;
+      }
+
+      return false;
+    }
+
+    // Computes a subpaving of the tplane. Subpavings resulting from a bisection
+    // are independent: each thread explores a subtree depth-first, and shares
+    // the second subpaving of a bisection when too few subpavings are pending.
 
-        else if(derivative_in && primitive_in)
-          set_value(SetValue::IN);
+    void compute_subpaving(Paving *x, float precision, const TubeVector& p, const TubeVector& v, bool with_derivative, int nb_threads)
+    {
+      if(nb_threads > 1)
+      {
+        // The syntheses of the tubes (if enabled) are lazily updated by const
+        // evaluations: they are brought up to date before spawning the threads,
+        // so that the workers only read them
+        p.codomain();
+        if(with_derivative)
+        {
+          v.codomain();
+          v.partial_integral(v.tdomain());
+        }
+      }
 
-        else if(std::max(t1.diam(), t2.diam()) < precision)
-          set_value(SetValue::UNKNOWN);
+      vector<Paving*> v_pending(1, x);
+      atomic<int> nb_pending(1);
+      int nb_busy = 0;
+      mutex pending_mutex;
+      condition_variable cv;
+
+      // An exception raised by a thread stops the computations, and is rethrown at the end
+      exception_ptr exception = nullptr;
+      atomic<bool> stop(false);
+
+      function<void(Paving*)> explore = [&](Paving *y)
+      {
+        if(stop || y->value() == SetValue::OUT)
+          return;
+
+        if(y->is_leaf() && !evaluate_leaf(y, precision, p, v, with_derivative))
+          return;
+
+        if(nb_pending < nb_threads - 1)
+        {
+          {
+            lock_guard<mutex> lock(pending_mutex);
+            v_pending.push_back(y->m_second_subpaving);
+            nb_pending++;
+          }
+          cv.notify_one();
+          explore(y->m_first_subpaving);
+        }
 
         else
         {
-          bisect();
-          //((TPlane*)m_first_subpaving)->compute_detections(precision, p, v, with_derivative, false);
-          //((TPlane*)m_second_subpaving)->compute_detections(precision, p, v, with_derivative, false);
-          m_first_subtplane = new TPlane(this, m_first_subpaving);
-          m_first_subtplane->compute_detections(precision, p, v, with_derivative, false);
-          *m_first_subpaving = *m_first_subtplane;
-          delete m_first_subtplane; m_first_subtplane = nullptr;
-          m_second_subtplane = new TPlane(this, m_second_subpaving);
-          m_second_subtplane->compute_detections(precision, p, v, with_derivative, false);
-          *m_second_subpaving = *m_second_subtplane;
-          delete m_second_subtplane; m_second_subtplane = nullptr;
+          explore(y->m_first_subpaving);
+          explore(y->m_second_subpaving);
         }
+      };
+
+      auto worker = [&]()
+      {
+        while(true)
+        {
+          Paving *y;
+
+          {
+            unique_lock<mutex> lock(pending_mutex);
+            cv.wait(lock, [&]() { return stop || !v_pending.empty() || nb_busy == 0; });
+            if(stop || v_pending.empty())
+              break; // no more subpavings to compute
+
+            y = v_pending.back();
+            v_pending.pop_back();
+            nb_pending--;
+            nb_busy++;
+          }
+
+          try
+          {
+            explore(y);
+          }
+
+          catch(...)
+          {
+            lock_guard<mutex> lock(pending_mutex);
+            if(!exception)
+              exception = current_exception();
+            stop = true;
+          }
+
+          {
+            lock_guard<mutex> lock(pending_mutex);
+            nb_busy--;
+          }
+          cv.notify_all();
+        }
+      };
+
+      vector<thread> v_threads;
+      for(int i = 1 ; i < nb_threads ; i++)
+        v_threads.push_back(thread(worker));
+      worker(); // the calling thread takes part in the computations
+      for(auto& t : v_threads)
+        t.join();
+
+      if(exception)
+        rethrow_exception(exception);
+    }
+  }
+
+  void TPlane::extend_detections(float precision, const TubeVector& p)
+  {
+    extend_detections(precision, p, p, false);
+  }
+
+  void TPlane::extend_detections(float precision, const TubeVector& p, const TubeVector& v)
+  {
+    extend_detections(precision, p, v, true);
+  }
+
+  void TPlane::set_nb_threads(int nb_threads)
+  {
+    assert(nb_threads >= 0);
+    if(nb_threads == 0)
+      nb_threads = thread::hardware_concurrency();
+    m_nb_threads = std::max(1, nb_threads);
+  }
+
+  int TPlane::nb_threads() const
+  {
+    return m_nb_threads;
+  }
+
+  void TPlane::compute_detections(float precision, const TubeVector& p, const TubeVector& v, bool with_derivative, bool extract_subsets)
+  {
+    assert(precision > 0.);
+    assert(p.tdomain().is_superset(box()[0]));
+
+    if(with_derivative)
+    {
+      assert(p.tdomain() == v.tdomain());
+      assert(p.size() == 2 && v.size() == 2);
     }
 
+    if(m_box.is_unbounded())
+      m_box = IntervalVector(2, p.tdomain()); // initializing
+    m_precision = precision;
+
+    compute_subpaving(this, precision, p, v, with_derivative, m_nb_threads);
+
     if(extract_subsets)
       m_v_detected_loops = get_connected_subsets();
   }
 
+  void TPlane::extend_detections(float precision, const TubeVector& p, const TubeVector& v, bool with_derivative)
+  {
+    assert(precision > 0.);
+
+    if(m_precision == 0. || m_box.is_unbounded()) // not computed yet
+    {
+      compute_detections(precision, p, v, with_derivative, true);
+      return;
+    }
+
+    const Interval prev_tdomain = m_box[0], tdomain = p.tdomain();
+    assert(tdomain.lb() == prev_tdomain.lb() && tdomain.ub() >= prev_tdomain.ub());
+
+    if(with_derivative)
+    {
+      assert(p.tdomain() == v.tdomain());
+      assert(p.size() == 2 && v.size() == 2);
+    }
+
+    if(tdomain.ub() > prev_tdomain.ub())
+    {
+      // The previous tplane [t0,tf]x[t0,tf] becomes a subpaving of the new one:
+      // [t0,tf']x[t0,tf'] = ([t0,tf]x[t0,tf] | [tf,tf']x[t0,tf]) | [t0,tf']x[tf,tf']
+      // Only the two last subpavings are computed.
+
+      const Interval new_t(prev_tdomain.ub(), tdomain.ub());
+
+      Paving *prev_tplane = new Paving(m_box, m_value);
+      prev_tplane->m_root = m_root;
+      prev_tplane->m_first_subpaving = m_first_subpaving;
+      prev_tplane->m_second_subpaving = m_second_subpaving;
+
+      m_box = IntervalVector(2, tdomain);
+      m_value = SetValue::UNKNOWN;
+
+      m_first_subpaving = new Paving(IntervalVector({tdomain, prev_tdomain}));
+      m_first_subpaving->m_root = m_root;
+      m_first_subpaving->m_first_subpaving = prev_tplane;
+      m_first_subpaving->m_second_subpaving = new Paving(IntervalVector({new_t, prev_tdomain}));
+      m_first_subpaving->m_second_subpaving->m_root = m_root;
+
+      m_second_subpaving = new Paving(IntervalVector({tdomain, new_t}));
+      m_second_subpaving->m_root = m_root;
+
+      m_precision = precision;
+      compute_subpaving(m_first_subpaving->m_second_subpaving, precision, p, v, with_derivative, m_nb_threads);
+      compute_subpaving(m_second_subpaving, precision, p, v, with_derivative, m_nb_threads);
+    }
+
+    // Loops may now cross the previous boundary of the tplane
+    m_v_detected_loops = get_connected_subsets();
+  }
+
     // Inclusion functions
     
     IntervalVector f_pv(const TubeVector& p, const TubeVector& v, const IntervalVector& input)
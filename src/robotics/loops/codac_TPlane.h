@@ -90,6 +90,50 @@ namespace codac
        */
       void compute_detections(float precision, const TubeVector& p, const TubeVector& v);
 
+      /**
+       * \brief Updates the detections after an extension of the tube of positions \f$[\mathbf{p}](\cdot)\f$
+       *
+       * The tube is expected to have been extended in time by new slices (online mission):
+       * its tdomain \f$[t_0,t_f]\f$ starts at the same \f$t_0\f$ as this tplane. Only the new
+       * strip of the tplane, involving times after the previous \f$t_f\f$, is computed.
+       * The previous subpaving remains valid and is kept as it is.
+       *
+       * \note If the tplane has not been computed beforehand, it is entirely computed.
+       *
+       * \param precision precision \f$\epsilon\f$ of the SIVIA approximation
+       * \param p 2d TubeVector \f$[\mathbf{p}](\cdot)\f$ for positions
+       */
+      void extend_detections(float precision, const TubeVector& p);
+
+      /**
+       * \brief Updates the detections after an extension of the tube of positions \f$[\mathbf{p}](\cdot)\f$
+       *        and of the tube of velocities \f$[\mathbf{v}](\cdot)\f$
+       *
+       * See extend_detections(float, const TubeVector&).
+       *
+       * \param precision precision \f$\epsilon\f$ of the SIVIA approximation
+       * \param p 2d TubeVector \f$[\mathbf{p}](\cdot)\f$ for positions
+       * \param v 2d TubeVector \f$[\mathbf{v}](\cdot)\f$ for velocities
+       */
+      void extend_detections(float precision, const TubeVector& p, const TubeVector& v);
+
+      /**
+       * \brief Sets the number of threads used for computing the detections
+       *
+       * The subpavings resulting from bisections are independent: they are
+       * explored concurrently. Results are the same as for the sequential computation.
+       *
+       * \param nb_threads number of threads (0: number of concurrent threads supported by the hardware, 1: sequential computation)
+       */
+      void set_nb_threads(int nb_threads);
+
+      /**
+       * \brief Returns the number of threads used for computing the detections
+       *
+       * \return number of threads
+       */
+      int nb_threads() const;
+
       /**
        * \brief Tries to prove the existence of loops in each detection set
        *
@@ -192,11 +236,9 @@ namespace codac
     protected:
 
       /**
-       * \brief Recursive computation of the tplane, from the tube of positions \f$[\mathbf{p}](\cdot)\f$
+       * \brief Computation of the tplane, from the tube of positions \f$[\mathbf{p}](\cdot)\f$
        *        and the tube of velocities \f$[\mathbf{v}](\cdot)\f$.
        *
-       * \note This method is used as recursive algorithm.
-       *
        * \param precision precision \f$\epsilon\f$ of the SIVIA approximation
        * \param p 2d TubeVector \f$[\mathbf{p}](\cdot)\f$ for positions
        * \param v 2d TubeVector \f$[\mathbf{v}](\cdot)\f$ for velocities
@@ -205,11 +247,20 @@ namespace codac
        */
       void compute_detections(float precision, const TubeVector& p, const TubeVector& v, bool with_derivative, bool extract_subsets);
 
+      /**
+       * \brief Updates the tplane after an extension of the tubes, see extend_detections(float, const TubeVector&)
+       *
+       * \param precision precision \f$\epsilon\f$ of the SIVIA approximation
+       * \param p 2d TubeVector \f$[\mathbf{p}](\cdot)\f$ for positions
+       * \param v 2d TubeVector \f$[\mathbf{v}](\cdot)\f$ for velocities
+       * \param with_derivative if `true`, the loop detection is made with derivative tubes given in arguments
+       */
+      void extend_detections(float precision, const TubeVector& p, const TubeVector& v, bool with_derivative);
+
       float m_precision = 0.; //!< precision of the SIVIA algorithm, used later on in traj_loops_summary()
+      int m_nb_threads = 1; //!< number of threads used for computing the detections
       std::vector<ConnectedSubset> m_v_detected_loops; //!< set of loops detections
       std::vector<ConnectedSubset> m_v_proven_loops; //!< set of loops proofs
-    
-      TPlane *m_first_subtplane, *m_second_subtplane;
 
       static bool m_verbose;
   };
@@ -0,0 +1,83 @@
+/**
+ *  CtcRaster class
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include "codac_CtcRaster.h"
+
+using namespace std;
+using namespace ibex;
+
+namespace codac
+{
+  CtcRaster::CtcRaster(const GeoImage& img, bool complementary)
+    : Ctc(img.nb_layers() == 1 ? 2 : 3), m_img(img), m_complementary(complementary)
+  {
+
+  }
+
+  void CtcRaster::contract(IntervalVector& x)
+  {
+    assert(x.size() == nb_var);
+
+    if(x.is_empty())
+      return;
+
+    IntervalVector world(x.size());
+    if(x.size() == 3)
+      world[0] = m_img.tdomain();
+    world.put(x.size()-2, m_img.bounding_box());
+
+    if(m_complementary && !x.is_subset(world))
+      return; // the world outside the image belongs to the complementary set
+
+    x &= world;
+    if(x.is_empty())
+      return;
+
+    PixelCoords pixel_coords;
+    int k_min, k_max;
+    m_img.world_to_grid(x, pixel_coords, k_min, k_max);
+
+    if(!m_img.narrow(pixel_coords, k_min, k_max, !m_complementary))
+      x.set_empty();
+
+    else
+      x &= m_img.grid_to_world(pixel_coords, k_min, k_max);
+  }
+
+  void CtcRaster::contract(TubeVector& x)
+  {
+    assert(x.size() == 2);
+    assert(nb_var == 3 && "image stacked over time expected");
+
+    Slice *s_x = x[0].first_slice(), *s_y = x[1].first_slice();
+
+    IntervalVector gate(3);
+    gate[0] = s_x->tdomain().lb();
+    gate[1] = s_x->input_gate(); gate[2] = s_y->input_gate();
+    contract(gate);
+    s_x->set_input_gate(gate[1]); s_y->set_input_gate(gate[2]);
+
+    while(s_x)
+    {
+      IntervalVector envelope(3);
+      envelope[0] = s_x->tdomain();
+      envelope[1] = s_x->codomain(); envelope[2] = s_y->codomain();
+      contract(envelope);
+      s_x->set_envelope(envelope[1]); s_y->set_envelope(envelope[2]);
+
+      gate[0] = s_x->tdomain().ub();
+      gate[1] = s_x->output_gate(); gate[2] = s_y->output_gate();
+      contract(gate);
+      s_x->set_output_gate(gate[1]); s_y->set_output_gate(gate[2]);
+
+      s_x = s_x->next_slice(); s_y = s_y->next_slice();
+    }
+  }
+}
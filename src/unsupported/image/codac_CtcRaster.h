@@ -0,0 +1,69 @@
+/**
+ *  \file
+ *  CtcRaster class
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __CODAC_CTCRASTER_H__
+#define __CODAC_CTCRASTER_H__
+
+#include "codac_Ctc.h"
+#include "codac_IntervalVector.h"
+#include "codac_TubeVector.h"
+#include "codac_GeoImage.h"
+
+namespace codac
+{
+  /**
+   * \class CtcRaster
+   * \brief Contractor \f$\mathcal{C}_{raster}\f$ on the set of the pixels of a GeoImage
+   *
+   * The box is contracted to the hull of the set pixels it intersects (or of
+   * the unset pixels, for the complementary set). Each side of the box is
+   * narrowed by a binary search over the integral image of the GeoImage.
+   *
+   * For an image stacked over time, boxes are of the form \f$[t]\times[x]\times[y]\f$
+   * and two-dimensional tubes can be contracted.
+   */
+  class CtcRaster : public Ctc
+  {
+    public:
+
+      /**
+       * \brief Creates a contractor on the set of the pixels of an image
+       *
+       * \param img the georeferenced image, that must live as long as the contractor
+       * \param complementary if `true`, contracts on the complementary set: the unset pixels
+       *        and the world outside the image
+       */
+      CtcRaster(const GeoImage& img, bool complementary = false);
+
+      /**
+       * \brief \f$\mathcal{C}_{raster}\big([\mathbf{x}]\big)\f$
+       *
+       * \param x the 2d box to be contracted, or the 3d box \f$[t]\times[x]\times[y]\f$
+       *        for an image stacked over time
+       */
+      void contract(IntervalVector& x);
+
+      /**
+       * \brief \f$\mathcal{C}_{raster}\big([\mathbf{x}](\cdot)\big)\f$: contracts the slices and
+       *        gates of a two-dimensional tube with the layers of an image stacked over time
+       *
+       * \param x the 2d tube to be contracted
+       */
+      void contract(TubeVector& x);
+
+    protected:
+
+      const GeoImage& m_img; //!< georeferenced image
+      const bool m_complementary; //!< contraction on the unset pixels
+  };
+}
+
+#endif
@@ -0,0 +1,212 @@
+/**
+ *  GeoImage class
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include <cmath>
+#include <limits>
+#include "codac_GeoImage.h"
+#include "codac_Exception.h"
+
+using namespace std;
+using namespace ibex;
+
+namespace codac
+{
+  GeoImage::GeoImage(const vector<uint8_t>& data, int x_size, int y_size,
+    double x0, double y0, double dx, double dy)
+    : m_mapper(x0, y0, x_size, y_size, dx, dy),
+      m_x_size(x_size), m_y_size(y_size), m_t_size(1), m_t0(0.), m_dt(0.)
+  {
+    assert(x_size > 0 && y_size > 0);
+    assert(dx != 0. && dy != 0.);
+
+    m_bounding_box = m_mapper.grid_to_world({{ 0, x_size-1, 0, y_size-1 }});
+    compute_integral_image(data);
+  }
+
+  GeoImage::GeoImage(const vector<uint8_t>& data, int x_size, int y_size, int t_size,
+    double x0, double y0, double dx, double dy, double t0, double dt)
+    : m_mapper(x0, y0, x_size, y_size, dx, dy),
+      m_x_size(x_size), m_y_size(y_size), m_t_size(t_size), m_t0(t0), m_dt(dt)
+  {
+    assert(x_size > 0 && y_size > 0 && t_size > 0);
+    assert(dx != 0. && dy != 0. && dt > 0.);
+
+    m_bounding_box = m_mapper.grid_to_world({{ 0, x_size-1, 0, y_size-1 }});
+    m_tdomain = t0 + Interval(0.,t_size) * dt;
+    compute_integral_image(data);
+  }
+
+  int GeoImage::nb_layers() const
+  {
+    return m_t_size;
+  }
+
+  const IntervalVector& GeoImage::bounding_box() const
+  {
+    return m_bounding_box;
+  }
+
+  const Interval& GeoImage::tdomain() const
+  {
+    return m_tdomain;
+  }
+
+  bool GeoImage::pixel(int i, int j, int k) const
+  {
+    assert(i >= 0 && i < m_x_size && j >= 0 && j < m_y_size && k >= 0 && k < m_t_size);
+    return count({{ k, k, i, i, j, j }}, true) != 0;
+  }
+
+  size_t GeoImage::enclosed_pixels(const PixelCoords& pixel_coords, int k_min, int k_max) const
+  {
+    return count({{ k_min, k_max, pixel_coords[0], pixel_coords[1], pixel_coords[2], pixel_coords[3] }}, true);
+  }
+
+  void GeoImage::world_to_grid(const IntervalVector& x, PixelCoords& pixel_coords, int& k_min, int& k_max) const
+  {
+    assert(x.size() == (m_t_size == 1 ? 2 : 3));
+    const int d = x.size() - 2; // index of the first spatial dimension
+
+    k_min = 0; k_max = 0;
+    if(m_t_size > 1)
+    {
+      // Same conversion as for the pixels: all the layers intersecting [t]
+      Interval itv = (x[0] - m_t0 - Interval(0.,m_dt)) / m_dt;
+      itv &= Interval(0,m_t_size-1);
+      assert(!itv.is_empty());
+      k_min = ceil(itv.lb());
+      k_max = floor(itv.ub());
+    }
+
+    pixel_coords = m_mapper.world_to_grid(x.subvector(d,d+1));
+  }
+
+  const IntervalVector GeoImage::grid_to_world(const PixelCoords& pixel_coords, int k_min, int k_max) const
+  {
+    const IntervalVector box = m_mapper.grid_to_world(pixel_coords);
+    if(m_t_size == 1)
+      return box;
+
+    IntervalVector x(3);
+    x[0] = m_t0 + Interval(k_min,k_max+1) * m_dt;
+    x.put(1, box);
+    return x;
+  }
+
+  bool GeoImage::narrow(PixelCoords& pixel_coords, int& k_min, int& k_max, bool set_pixels) const
+  {
+    array<int,6> r = {{ k_min, k_max, pixel_coords[0], pixel_coords[1], pixel_coords[2], pixel_coords[3] }};
+
+    if(count(r, set_pixels) == 0)
+      return false;
+
+    // The number of pixels in [r_lb,i] increases with i:
+    // each bound of each dimension is found by a binary search
+
+    for(int d = 0 ; d < 3 ; d++)
+    {
+      array<int,6> r_ = r;
+      int lb = r[2*d], ub = r[2*d+1];
+
+      while(lb < ub) // lower bound
+      {
+        r_[2*d+1] = lb + (ub-lb)/2;
+        if(count(r_, set_pixels) != 0) ub = r_[2*d+1];
+        else lb = r_[2*d+1] + 1;
+      }
+
+      r[2*d] = lb;
+      r_ = r;
+      ub = r[2*d+1];
+
+      while(lb < ub) // upper bound
+      {
+        r_[2*d] = ub - (ub-lb)/2;
+        if(count(r_, set_pixels) != 0) lb = r_[2*d];
+        else ub = r_[2*d] - 1;
+      }
+
+      r[2*d+1] = ub;
+    }
+
+    k_min = r[0]; k_max = r[1];
+    pixel_coords = {{ r[2], r[3], r[4], r[5] }};
+    return true;
+  }
+
+  // Protected methods
+
+  void GeoImage::compute_integral_image(const vector<uint8_t>& data)
+  {
+    const size_t n = (size_t)m_t_size * m_x_size * m_y_size;
+    if(data.size() != n)
+      throw Exception(__func__, "the size of the data does not match the dimensions of the image");
+    if(n > numeric_limits<uint32_t>::max())
+      throw Exception(__func__, "image too large");
+
+    m_ii.resize(n);
+
+    // Inclusive prefix sums, computed dimension by dimension
+    for(size_t p = 0 ; p < n ; p++)
+      m_ii[p] = data[p] != 0 ? 1 : 0;
+
+    for(int k = 0 ; k < m_t_size ; k++)
+      for(int i = 0 ; i < m_x_size ; i++)
+      {
+        uint32_t *row = &m_ii[((size_t)k*m_x_size + i) * m_y_size];
+        for(int j = 1 ; j < m_y_size ; j++)
+          row[j] += row[j-1];
+      }
+
+    for(int k = 0 ; k < m_t_size ; k++)
+      for(int i = 1 ; i < m_x_size ; i++)
+      {
+        uint32_t *row = &m_ii[((size_t)k*m_x_size + i) * m_y_size];
+        const uint32_t *prev_row = row - m_y_size;
+        for(int j = 0 ; j < m_y_size ; j++)
+          row[j] += prev_row[j];
+      }
+
+    const size_t layer_size = (size_t)m_x_size * m_y_size;
+    for(size_t p = layer_size ; p < n ; p++)
+      m_ii[p] += m_ii[p - layer_size];
+  }
+
+  size_t GeoImage::count(const array<int,6>& r, bool set_pixels) const
+  {
+    assert(r[0] >= 0 && r[1] < m_t_size && r[2] >= 0 && r[3] < m_x_size && r[4] >= 0 && r[5] < m_y_size);
+    assert(r[0] <= r[1] && r[2] <= r[3] && r[4] <= r[5]);
+
+    // Value of the integral image, 0 before the first pixel or layer
+    auto ii = [this](int k, int i, int j) -> int64_t
+    {
+      if(k < 0 || i < 0 || j < 0)
+        return 0;
+      return m_ii[((size_t)k*m_x_size + i) * m_y_size + j];
+    };
+
+    // Inclusion-exclusion over the corners of the range
+    int64_t nb_set = 0;
+    for(int c = 0 ; c < 8 ; c++)
+    {
+      const int k = (c & 4) ? r[0]-1 : r[1];
+      const int i = (c & 2) ? r[2]-1 : r[3];
+      const int j = (c & 1) ? r[4]-1 : r[5];
+      const int nb_lower_corners = ((c >> 2) & 1) + ((c >> 1) & 1) + (c & 1);
+      nb_set += (nb_lower_corners % 2 == 0) ? ii(k,i,j) : -ii(k,i,j);
+    }
+
+    if(set_pixels)
+      return nb_set;
+
+    const size_t volume = (size_t)(r[1]-r[0]+1) * (r[3]-r[2]+1) * (r[5]-r[4]+1);
+    return volume - nb_set;
+  }
+}
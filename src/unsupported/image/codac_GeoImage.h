@@ -0,0 +1,173 @@
+/**
+ *  \file
+ *  GeoImage class
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __CODAC_GEOIMAGE_H__
+#define __CODAC_GEOIMAGE_H__
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include "codac_Interval.h"
+#include "codac_IntervalVector.h"
+#include "codac_GeoMapper.h"
+
+namespace codac
+{
+  /**
+   * \class GeoImage
+   * \brief Georeferenced binary image (occupancy grid), possibly stacked over time,
+   *        with an integral image (summed-area table) for counting the set pixels
+   *
+   * The number of set pixels of any rectangle of the image is obtained in constant time.
+   * The pixel \f$(i,j)\f$ covers the closed box \f$[x_0+i\,dx,x_0+(i+1)\,dx]\times[y_0+j\,dy,y_0+(j+1)\,dy]\f$
+   * (\f$dx\f$ and \f$dy\f$ may be negative, for instance for images with a downward \f$y\f$ axis).
+   * The layer \f$k\f$ of a time-stacked image covers \f$[t_0+k\,dt,t_0+(k+1)\,dt]\f$.
+   */
+  class GeoImage
+  {
+    public:
+
+      /**
+       * \brief Creates a georeferenced image
+       *
+       * \param data values of the pixels, a pixel \f$(i,j)\f$ is set if `data[i*y_size+j]` is not 0
+       * \param x_size number of pixels along \f$x\f$
+       * \param y_size number of pixels along \f$y\f$
+       * \param x0 \f$x\f$ world coordinate of the origin of the image
+       * \param y0 \f$y\f$ world coordinate of the origin of the image
+       * \param dx width of a pixel
+       * \param dy height of a pixel
+       */
+      GeoImage(const std::vector<std::uint8_t>& data, int x_size, int y_size,
+        double x0, double y0, double dx, double dy);
+
+      /**
+       * \brief Creates a georeferenced image stacked over time
+       *
+       * \param data values of the pixels, a pixel \f$(i,j)\f$ of the layer \f$k\f$
+       *        is set if `data[(k*x_size+i)*y_size+j]` is not 0
+       * \param x_size number of pixels along \f$x\f$
+       * \param y_size number of pixels along \f$y\f$
+       * \param t_size number of layers
+       * \param x0 \f$x\f$ world coordinate of the origin of the image
+       * \param y0 \f$y\f$ world coordinate of the origin of the image
+       * \param dx width of a pixel
+       * \param dy height of a pixel
+       * \param t0 time of the first layer
+       * \param dt time covered by each layer (positive value)
+       */
+      GeoImage(const std::vector<std::uint8_t>& data, int x_size, int y_size, int t_size,
+        double x0, double y0, double dx, double dy, double t0, double dt);
+
+      /**
+       * \brief Returns the number of layers of the image
+       *
+       * \return 1 for an image that is not stacked over time
+       */
+      int nb_layers() const;
+
+      /**
+       * \brief Returns the world box covered by the pixels of the image
+       *
+       * \return the 2d bounding box
+       */
+      const IntervalVector& bounding_box() const;
+
+      /**
+       * \brief Returns the temporal domain covered by the layers of the image
+       *
+       * \return the tdomain, or \f$[-\infty,\infty]\f$ if the image is not stacked over time
+       */
+      const Interval& tdomain() const;
+
+      /**
+       * \brief Returns the value of the pixel \f$(i,j)\f$ of a layer
+       *
+       * \param i pixel coordinate along \f$x\f$
+       * \param j pixel coordinate along \f$y\f$
+       * \param k layer
+       * \return `true` if the pixel is set
+       */
+      bool pixel(int i, int j, int k = 0) const;
+
+      /**
+       * \brief Counts the set pixels of a rectangle of pixels, over a range of layers
+       *
+       * \param pixel_coords ranges of the rectangle \f$[i_0,i_1]\times[j_0,j_1]\f$, bounds included
+       * \param k_min first layer
+       * \param k_max last layer
+       * \return the number of set pixels
+       */
+      std::size_t enclosed_pixels(const PixelCoords& pixel_coords, int k_min = 0, int k_max = 0) const;
+
+      /**
+       * \brief Computes the pixels and layers of the image intersecting a box
+       *
+       * \param x the 2d box, or the 3d box \f$[t]\times[x]\times[y]\f$ for an image stacked over time,
+       *        that is supposed to intersect the bounding box and tdomain of the image
+       * \param pixel_coords ranges of the pixels intersecting \f$[\mathbf{x}]\f$
+       * \param k_min first layer intersecting \f$[t]\f$
+       * \param k_max last layer intersecting \f$[t]\f$
+       */
+      void world_to_grid(const IntervalVector& x, PixelCoords& pixel_coords, int& k_min, int& k_max) const;
+
+      /**
+       * \brief Computes the world box covered by a range of pixels and layers
+       *
+       * \param pixel_coords ranges of the pixels
+       * \param k_min first layer
+       * \param k_max last layer
+       * \return the 2d box, or the 3d box \f$[t]\times[x]\times[y]\f$ for an image stacked over time
+       */
+      const IntervalVector grid_to_world(const PixelCoords& pixel_coords, int k_min = 0, int k_max = 0) const;
+
+      /**
+       * \brief Narrows a range of pixels and layers to the hull of its set (or unset) pixels
+       *
+       * Each bound is obtained by a binary search over the integral image:
+       * \f$\mathcal{O}(\log(n))\f$ queries for a side of \f$n\f$ pixels.
+       *
+       * \param pixel_coords ranges of the pixels, to be narrowed
+       * \param k_min first layer, to be narrowed
+       * \param k_max last layer, to be narrowed
+       * \param set_pixels if `true`, narrows around the set pixels, otherwise around the unset ones
+       * \return `false` if the range does not contain such pixels
+       */
+      bool narrow(PixelCoords& pixel_coords, int& k_min, int& k_max, bool set_pixels = true) const;
+
+    protected:
+
+      /**
+       * \brief Computes the integral image of the pixel values
+       *
+       * \param data values of the pixels
+       */
+      void compute_integral_image(const std::vector<std::uint8_t>& data);
+
+      /**
+       * \brief Counts the set (or unset) pixels of a range of pixels and layers
+       *
+       * \param r ranges \f$[k_0,k_1]\times[i_0,i_1]\times[j_0,j_1]\f$, bounds included
+       * \param set_pixels if `false`, the unset pixels are counted
+       * \return the number of pixels
+       */
+      std::size_t count(const std::array<int,6>& r, bool set_pixels) const;
+
+      mutable GeoMapper m_mapper; //!< conversions between world and pixel coordinates
+      const int m_x_size, m_y_size, m_t_size; //!< dimensions of the image
+      const double m_t0, m_dt; //!< time of the first layer, time covered by a layer
+      IntervalVector m_bounding_box = IntervalVector(2); //!< world box covered by the pixels
+      Interval m_tdomain = Interval::ALL_REALS; //!< temporal domain covered by the layers
+      std::vector<std::uint32_t> m_ii; //!< integral image, inclusive prefix sums over the layers and pixels
+  };
+}
+
+#endif
@@ -0,0 +1,31 @@
+/**
+ *  SepRaster class
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#include "codac_SepRaster.h"
+
+using namespace std;
+using namespace ibex;
+
+namespace codac
+{
+  SepRaster::SepRaster(const GeoImage& img)
+    : Sep(img.nb_layers() == 1 ? 2 : 3), m_ctc_out(img, false), m_ctc_in(img, true)
+  {
+
+  }
+
+  void SepRaster::separate(IntervalVector& x_in, IntervalVector& x_out)
+  {
+    assert(x_in.size() == nb_var && x_out.size() == nb_var);
+
+    m_ctc_out.contract(x_out);
+    m_ctc_in.contract(x_in);
+  }
+}
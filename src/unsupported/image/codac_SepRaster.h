@@ -0,0 +1,51 @@
+/**
+ *  \file
+ *  SepRaster class
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __CODAC_SEPRASTER_H__
+#define __CODAC_SEPRASTER_H__
+
+#include "ibex_Sep.h"
+#include "codac_IntervalVector.h"
+#include "codac_CtcRaster.h"
+
+namespace codac
+{
+  /**
+   * \class SepRaster
+   * \brief Separator \f$\mathcal{S}_{raster}\f$ for the set of the pixels of a GeoImage
+   */
+  class SepRaster : public ibex::Sep
+  {
+    public:
+
+      /**
+       * \brief Creates a separator for the set of the pixels of an image
+       *
+       * \param img the georeferenced image, that must live as long as the separator
+       */
+      SepRaster(const GeoImage& img);
+
+      /**
+       * \brief \f$\mathcal{S}\big([\mathbf{x}_{\textrm{in}}],[\mathbf{x}_{\textrm{out}}]\big)\f$
+       *
+       * \param x_in the box \f$[\mathbf{x}_{\textrm{in}}]\f$ to be inner-contracted
+       * \param x_out the box \f$[\mathbf{x}_{\textrm{out}}]\f$ to be outer-contracted
+       */
+      void separate(IntervalVector& x_in, IntervalVector& x_out);
+
+    protected:
+
+      CtcRaster m_ctc_out; //!< contractor on the set pixels
+      CtcRaster m_ctc_in; //!< contractor on the unset pixels and the outside of the image
+  };
+}
+
+#endif
@@ -19,8 +19,18 @@
 #include <fstream>
 #include <ibex_IntervalVector.h>
 #include <ibex_LargestFirst.h>
+#include <codac_IntervalVector.h>
 #include <codac_PavingVisitor.h>
+#include <codac_PNodePool.h>
 
+/**
+ * \brief Node of a paving.
+ *
+ * Only the root of the tree stores its box. Bisected nodes store the
+ * bisected dimension and the split point, from which the boxes of
+ * the subpavings are recomputed during the traversals of the tree.
+ * Nodes are allocated from per-thread pools (see PNodePool).
+ */
 template <typename V>
 class PNode
 {
@@ -60,10 +70,29 @@ class PNode
     /**
      * \brief Return paving's domain.
      *
+     * Only available for the root of the tree: the boxes of the
+     * subpavings are obtained with leftBox() and rightBox().
+     *
      * \return an IntervalVector representing paving's domain
      */
     const ibex::IntervalVector& getBox() const;
 
+    /**
+     * \brief Return the domain of the first subpaving.
+     *
+     * \param box the domain of this
+     * \return the first half of the bisected domain
+     */
+    ibex::IntervalVector leftBox(const ibex::IntervalVector& box) const;
+
+    /**
+     * \brief Return the domain of the second subpaving.
+     *
+     * \param box the domain of this
+     * \return the second half of the bisected domain
+     */
+    ibex::IntervalVector rightBox(const ibex::IntervalVector& box) const;
+
     /**
      * \brief Return paving's value.
      *
@@ -120,19 +149,31 @@ class PNode
     /**
      * \brief Perform a simplification on the tree structure.
      *
+     * \param max_depth if not negative, the subpavings deeper than max_depth
+     *        are supposed to be already simplified and are not explored
      * \return true if a simplification has been done, false otherwise
      */
-    bool reunite();
+    bool reunite(int max_depth = -1);
 
     /**
-     * \brief Perform a bisection on the current leaf.
+     * \brief Perform a bisection on the root leaf.
      *
      * Bisection is done only if this is a leaf.
      *
-     * \param ratio the ratio between the diameters of the left and the right parts of the bisected box ; 0.45 by default
+     * \param bisector the bisector used to split paving's domain
      */
     void bisect(ibex::Bsc& bisector);
 
+    /**
+     * \brief Perform a bisection on the current leaf.
+     *
+     * Bisection is done only if this is a leaf.
+     *
+     * \param bisector the bisector used to split the box
+     * \param box the domain of this
+     */
+    void bisect(ibex::Bsc& bisector, const ibex::IntervalVector& box);
+
 		/**
 		 * \brief Visit the current Node
 		 *
@@ -142,6 +183,15 @@ class PNode
      template<typename T>
 		 void visit( T& visitor);
 
+		/**
+		 * \brief Visit the current Node
+		 *
+		 * \param visitor which will perform action with node
+		 * \param box the domain of this
+		 */
+     template<typename T>
+		 void visit( T& visitor, const ibex::IntervalVector& box);
+
 		/**
 		 * \brief Number of leaves below the Pnode
 		 */
@@ -168,11 +218,24 @@ class PNode
      */
     static PNode<V>*  load(std::ifstream& inf);
 
+    static void* operator new(std::size_t size);
+    static void operator delete(void* ptr, std::size_t size);
+
   protected:
 
+    /**
+     * \brief Create a subpaving, whose domain is given by its parent.
+     */
+    explicit PNode(V value);
+
+    void save(std::ofstream& of, const ibex::IntervalVector& box);
+    static PNode<V>* load(std::ifstream& inf, ibex::IntervalVector& box);
+
     V m_value;
+    int m_dim; // bisected dimension
+    double m_split; // split point of the bisected dimension
     PNode *m_left, *m_right;
-    ibex::IntervalVector m_box;
+    ibex::IntervalVector *m_box; // paving's domain, only stored at the root
 };
 
 #include "codac_PNode_impl.hpp" // this is needed with C++ templates
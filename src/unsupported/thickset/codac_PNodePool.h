@@ -0,0 +1,137 @@
+/**
+ *  \file
+ *  PNodePool class
+ * ----------------------------------------------------------------------------
+ *  \date       2023
+ *  \author     Simon Rohou
+ *  \copyright  Copyright 2023 Codac Team
+ *  \license    This program is distributed under the terms of
+ *              the GNU Lesser General Public License (LGPL).
+ */
+
+#ifndef __CODAC_PNODEPOOL_H__
+#define __CODAC_PNODEPOOL_H__
+
+#include <new>
+#include <mutex>
+#include <cstddef>
+
+/**
+ * \class PNodePool
+ * \brief Per-thread pools of memory locations for the nodes of pavings
+ *
+ * Each thread allocates its nodes from its own blocks, without locking
+ * and without the bookkeeping overhead of the general allocator.
+ * A released location is reused by the thread that releases it. When
+ * a thread terminates, its available locations are shared with the other ones.
+ *
+ * \note The blocks are never given back to the system: nodes may be
+ *       released by any thread, at any time of the program.
+ */
+template<typename T>
+class PNodePool
+{
+  public:
+
+    static void* allocate()
+    {
+      LocalPool& pool = local_pool();
+
+      if(!pool.m_released)
+      {
+        if(pool.m_available == 0)
+          refill(pool);
+
+        if(!pool.m_released)
+        {
+          pool.m_available--;
+          return pool.m_next++;
+        }
+      }
+
+      Location *ptr = pool.m_released;
+      pool.m_released = ptr->next;
+      return ptr;
+    }
+
+    static void deallocate(void *ptr)
+    {
+      LocalPool& pool = local_pool();
+      Location *loc = static_cast<Location*>(ptr);
+      loc->next = pool.m_released;
+      pool.m_released = loc;
+    }
+
+  protected:
+
+    union Location
+    {
+      Location *next; //!< next released location
+      alignas(T) unsigned char data[sizeof(T)];
+    };
+
+    struct LocalPool
+    {
+      Location *m_released = nullptr; //!< released locations, available for reuse
+      Location *m_next = nullptr; //!< next location of the current block
+      std::size_t m_available = 0; //!< number of locations left in the current block
+
+      ~LocalPool() // the remaining locations are given to the other threads
+      {
+        for( ; m_available > 0 ; m_available--)
+        {
+          m_next->next = m_released;
+          m_released = m_next++;
+        }
+
+        if(m_released)
+        {
+          Location *last = m_released;
+          while(last->next)
+            last = last->next;
+
+          std::lock_guard<std::mutex> lock(shared_mutex());
+          last->next = shared_released();
+          shared_released() = m_released;
+        }
+      }
+    };
+
+    static void refill(LocalPool& pool)
+    {
+      {
+        std::lock_guard<std::mutex> lock(shared_mutex());
+        if(shared_released())
+        {
+          pool.m_released = shared_released();
+          shared_released() = nullptr;
+          return;
+        }
+      }
+
+      pool.m_next = static_cast<Location*>(::operator new(block_size * sizeof(Location)));
+      pool.m_available = block_size;
+    }
+
+    static LocalPool& local_pool()
+    {
+      static thread_local LocalPool pool;
+      return pool;
+    }
+
+    static std::mutex& shared_mutex()
+    {
+      static std::mutex m;
+      return m;
+    }
+
+    static Location*& shared_released()
+    {
+      static Location *released = nullptr;
+      return released;
+    }
+
+    static const std::size_t block_size = 4096; //!< number of locations of a block
+};
+
+#endif
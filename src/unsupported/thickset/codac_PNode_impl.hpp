@@ -12,13 +12,20 @@
 
 #include <utility>
 #include <array>
+#include <cassert>
 
 template <typename V>
 PNode<V>::PNode(const codac::IntervalVector& box, V value):
-	m_value(value), m_box(box), m_left(nullptr), m_right(nullptr) {}
+	m_value(value), m_dim(-1), m_split(0.), m_left(nullptr), m_right(nullptr), m_box(new codac::IntervalVector(box)) {}
 
 template <typename V>
-PNode<V>::PNode(const PNode& n) :  m_value(n.m_value), m_box(n.m_box), m_left(nullptr), m_right(nullptr) {
+PNode<V>::PNode(V value):
+	m_value(value), m_dim(-1), m_split(0.), m_left(nullptr), m_right(nullptr), m_box(nullptr) {}
+
+template <typename V>
+PNode<V>::PNode(const PNode& n) :  m_value(n.m_value), m_dim(n.m_dim), m_split(n.m_split), m_left(nullptr), m_right(nullptr), m_box(nullptr) {
+  if (n.m_box)
+    m_box = new codac::IntervalVector(*n.m_box);
   if (n.m_left)
     m_left = new PNode(*n.m_left);  // recursively call copy constructor
   if (n.m_right)
@@ -26,9 +33,10 @@ PNode<V>::PNode(const PNode& n) :  m_value(n.m_value), m_box(n.m_box), m_left(nu
 }
 
 template<typename V>
-PNode<V>::PNode(PNode&& other): m_value(other.m_value), m_box(other.m_box){
+PNode<V>::PNode(PNode&& other): m_value(other.m_value), m_dim(other.m_dim), m_split(other.m_split){
 	m_left =  other.m_left; other.m_left = nullptr;
 	m_right = other.m_right; other.m_right = nullptr;
+	m_box = other.m_box; other.m_box = nullptr;
 }
 
 template <typename V>
@@ -39,6 +47,8 @@ PNode<V>::~PNode()
 
   if(m_right != nullptr)
     delete m_right;
+
+  delete m_box;
 }
 
 template <typename V>
@@ -49,14 +59,57 @@ PNode<V> &PNode<V>::operator=(const PNode<V> &&other){
 	m_left = other.m_left;
 	m_right = other.m_right;
 	m_value = other.m_value;
-	m_box = other.m_box;
+	m_dim = other.m_dim;
+	m_split = other.m_split;
+	if (other.m_box){
+		delete m_box;
+		m_box = new codac::IntervalVector(*other.m_box);
+	}
 	return *this;
 }
 
+template <typename V>
+void* PNode<V>::operator new(std::size_t size)
+{
+  if(size != sizeof(PNode)) // derived class
+    return ::operator new(size);
+  return PNodePool<PNode>::allocate();
+}
+
+template <typename V>
+void PNode<V>::operator delete(void* ptr, std::size_t size)
+{
+  if(ptr == nullptr)
+    return;
+  if(size != sizeof(PNode))
+    ::operator delete(ptr);
+  else
+    PNodePool<PNode>::deallocate(ptr);
+}
+
 template <typename V>
 const codac::IntervalVector& PNode<V>::getBox() const
 {
-  return m_box;
+  assert(m_box != nullptr && "the box is only stored at the root of the paving");
+  return *m_box;
+}
+
+template <typename V>
+codac::IntervalVector PNode<V>::leftBox(const codac::IntervalVector& box) const
+{
+  assert(!isLeaf());
+  codac::IntervalVector left_box(box);
+  left_box[m_dim] = codac::Interval(box[m_dim].lb(), m_split);
+  return left_box;
+}
+
+template <typename V>
+codac::IntervalVector PNode<V>::rightBox(const codac::IntervalVector& box) const
+{
+  assert(!isLeaf());
+  codac::IntervalVector right_box(box);
+  right_box[m_dim] = codac::Interval(m_split, box[m_dim].ub());
+  return right_box;
 }
 
 template <typename V>
@@ -114,14 +167,17 @@ int PNode<V>::getSubpavingsNumber(V value) const
 }
 
 template <typename V>
-bool PNode<V>::reunite()
+bool PNode<V>::reunite(int max_depth)
 {
   bool has_been_simplified = false;
 
   if(!isLeaf())
   {
-    has_been_simplified |= m_left->reunite();
-    has_been_simplified |= m_right->reunite();
+    if(max_depth != 0)
+    {
+      has_been_simplified |= m_left->reunite(max_depth - 1);
+      has_been_simplified |= m_right->reunite(max_depth - 1);
+    }
 
     if(m_left->isLeaf() && m_right->isLeaf() &&
        m_left->value() == m_right->value())
@@ -142,24 +198,43 @@ bool PNode<V>::reunite()
 
 template <typename V>
 void PNode<V>::bisect(ibex::Bsc &bisector)
+{
+  bisect(bisector, getBox());
+}
+
+template <typename V>
+void PNode<V>::bisect(ibex::Bsc &bisector, const codac::IntervalVector& box)
 {
   if(isLeaf())
   {
-    std::pair<codac::IntervalVector,codac::IntervalVector> boxes = bisector.bisect(m_box);
-    m_left = new PNode(boxes.first, m_value);
-    m_right = new PNode(boxes.second, m_value);
+    std::pair<codac::IntervalVector,codac::IntervalVector> boxes = bisector.bisect(box);
+
+    // Only the bisected dimension and the split point are stored
+    m_dim = 0;
+    while(m_dim < box.size() - 1 && boxes.first[m_dim] == box[m_dim])
+      m_dim++;
+    m_split = boxes.first[m_dim].ub();
+
+    m_left = new PNode(m_value);
+    m_right = new PNode(m_value);
   }
 }
 
 template <typename V>
 template<typename T>
 void PNode<V>::visit(T & visitor){
+	visit(visitor, getBox());
+}
+
+template <typename V>
+template<typename T>
+void PNode<V>::visit(T & visitor, const codac::IntervalVector& box){
 	if(isLeaf())
-		visitor.visit_leaf(getBox(), value());
+		visitor.visit_leaf(box, value());
 	else{
-		visitor.visit_node(getBox());
-		left()->visit(visitor);
-		right()->visit(visitor);
+		visitor.visit_node(box);
+		left()->visit(visitor, leftBox(box));
+		right()->visit(visitor, rightBox(box));
 	}
 }
 
@@ -192,25 +267,40 @@ void PNode<V>::clear(){
 template< typename V>
 void PNode<V>::save(std::ofstream& of)
 {
-	int size = m_box.size();
+	save(of, getBox());
+}
+
+template< typename V>
+void PNode<V>::save(std::ofstream& of, const codac::IntervalVector& box)
+{
+	int size = box.size();
 	of.write((char*)(&m_value), sizeof(m_value));
 	of.write((char*)(&size), sizeof(size));
 	for (int i = 0; i < size; i++){
-		double lb = m_box[i].lb();
-		double ub = m_box[i].ub();
+		double lb = box[i].lb();
+		double ub = box[i].ub();
 		of.write((char*)(&lb), sizeof(double));
 		of.write((char*)(&ub), sizeof(double));
 	}
   bool has_children = !isLeaf();
 	of.write((char*)(&has_children), sizeof(bool));
 	if (has_children){
-		m_left->save(of);
-		m_right->save(of);
+		m_left->save(of, leftBox(box));
+		m_right->save(of, rightBox(box));
 	}
 }
 
 template< typename V>
 PNode<V>* PNode<V>::load(std::ifstream& infile)
+{
+	codac::IntervalVector box(1);
+	PNode<V>* node = PNode<V>::load(infile, box);
+	node->m_box = new codac::IntervalVector(box);
+	return node;
+}
+
+template< typename V>
+PNode<V>* PNode<V>::load(std::ifstream& infile, codac::IntervalVector& box)
 {
 	int size;
 	V value;
@@ -220,10 +310,19 @@ PNode<V>* PNode<V>::load(std::ifstream& infile)
 	std::vector< std::array<double, 2> > bounds = std::vector< std::array<double, 2> >(size);
   	infile.read((char*)(&bounds[0][0]), 2*size*sizeof(double));
 	infile.read((char*)(&has_children), sizeof(has_children));
-	PNode<V>* node = new PNode<V>(IntervalVector(size, bounds[0][0]), value );
+	box.resize(size);
+	for (int i = 0; i < size; i++)
+		box[i] = codac::Interval(bounds[i][0], bounds[i][1]);
+	PNode<V>* node = new PNode<V>(value);
 	if (has_children) {
-		node->m_left = PNode<V>::load(infile);
-		node->m_right = PNode<V>::load(infile);
+		codac::IntervalVector left_box(size), right_box(size);
+		node->m_left = PNode<V>::load(infile, left_box);
+		node->m_right = PNode<V>::load(infile, right_box);
+		// The bisection is retrieved from the box of the first subpaving
+		node->m_dim = 0;
+		while(node->m_dim < size - 1 && left_box[node->m_dim] == box[node->m_dim])
+			node->m_dim++;
+		node->m_split = left_box[node->m_dim].ub();
 	}
 	return node;
 }
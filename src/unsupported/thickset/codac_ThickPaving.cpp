@@ -16,6 +16,11 @@
 #include <iostream>
 #include <fstream>
 #include <stdexcept>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <exception>
 
 using std::list;
 using std::cerr;
@@ -87,19 +92,19 @@ void ThickPaving::ctcOutside(IntervalVector& box){
   if ( !box.is_subset(root.getBox()) )
     return;
   IntervalVector res(IntervalVector::empty(box.size()));
-  std::list<Node*> L;
-  L.push_back(&root);
+  std::list<NodeBox> L;
+  L.push_back(NodeBox(&root, root.getBox()));
   while (!L.empty()){
-    Node* n=L.front();    L.pop_front();
-    IntervalVector tmp = (n->getBox() & box);
+    Node* n=L.front().first;    IntervalVector B(L.front().second);    L.pop_front();
+    IntervalVector tmp = (B & box);
     if ( !tmp.is_empty() && !tmp.is_flat() ){
       if (n->isLeaf()){
         if (n->value() != OUT){
-          res = res | n->getBox();
+          res = res | B;
         }
       } else {
-        L.push_back(n->left());
-        L.push_back(n->right());
+        L.push_back(NodeBox(n->left(), n->leftBox(B)));
+        L.push_back(NodeBox(n->right(), n->rightBox(B)));
       }
     }
   }
@@ -110,19 +115,19 @@ void ThickPaving::ctcInside(IntervalVector& box){
   if ( !box.is_subset(root.getBox()) )
     return;
   IntervalVector res(IntervalVector::empty(box.size()));
-  std::list<Node*> L;
-  L.push_back(&root);
+  std::list<NodeBox> L;
+  L.push_back(NodeBox(&root, root.getBox()));
   while (!L.empty()){
-    Node* n=L.front();    L.pop_front();
-    IntervalVector tmp = (n->getBox() & box);
+    Node* n=L.front().first;    IntervalVector B(L.front().second);    L.pop_front();
+    IntervalVector tmp = (B & box);
     if ( !tmp.is_empty() && !tmp.is_flat() ){
       if (n->isLeaf()){
         if (n->value() != IN){
-          res = res | n->getBox();
+          res = res | B;
         }
       } else {
-        L.push_back(n->left());
-        L.push_back(n->right());
+        L.push_back(NodeBox(n->left(), n->leftBox(B)));
+        L.push_back(NodeBox(n->right(), n->rightBox(B)));
       }
     }
   }
@@ -131,23 +136,23 @@ void ThickPaving::ctcInside(IntervalVector& box){
 
 
 void ThickPaving::ctcTransform(ThickPaving& B, IntervalVector& T){
-  std::list<Node*> L;
-  L.push_back(&root);
+  std::list<NodeBox> L;
+  L.push_back(NodeBox(&root, root.getBox()));
   while (!L.empty()){
-    Node* n=L.front();    L.pop_front();
+    Node* n=L.front().first;    IntervalVector box(L.front().second);    L.pop_front();
     if (n->isLeaf()){
       /*if (n->value() == IN){
-        IntervalVector Y = T + n->getBox();
+        IntervalVector Y = T + box;
         B.ctcOutside(Y);
-        T &= Y - n->getBox();
+        T &= Y - box;
       } else */if (n->value() == IN){
-          IntervalVector Y = T + n->getBox();
+          IntervalVector Y = T + box;
           B.ctcOutside(Y);
-          T &= Y - n->getBox();
+          T &= Y - box;
       }
     } else {
-      L.push_back(n->left());
-      L.push_back(n->right());
+      L.push_back(NodeBox(n->left(), n->leftBox(box)));
+      L.push_back(NodeBox(n->right(), n->rightBox(box)));
     }
   }
 }
@@ -307,22 +312,22 @@ bool isThickNotInclude(const IntervalVector& am, const IntervalVector& ap, const
 
 ThickBoolean ThickPaving::contains(const IntervalVector& X){
   ThickBoolean res =  EMPTY;
-  std::list<Node*> L;
-  L.push_back(&root);
+  std::list<NodeBox> L;
+  L.push_back(NodeBox(&root, root.getBox()));
   while (!L.empty()){
-    Node* n=L.front();    L.pop_front();
-    IntervalVector tmp = (n->getBox() & X);
+    Node* n=L.front().first;    IntervalVector B(L.front().second);    L.pop_front();
+    IntervalVector tmp = (B & X);
     if ( !tmp.is_empty() && !tmp.is_flat() ){
       if (n->isLeaf()){
-        // std::cerr << "\t" << n->value() << " " << n->getBox() << " " << n->getBox().diam() << "\n";
+        // std::cerr << "\t" << n->value() << " " << B << " " << B.diam() << "\n";
         // if ( n->value() == UNK )
         //   res = res | MAYBE;
         // else
           res = res | n->value();
  			// 	if(res == UNK) break;
       } else {
-        L.push_back(n->left());
-        L.push_back(n->right());
+        L.push_back(NodeBox(n->left(), n->leftBox(B)));
+        L.push_back(NodeBox(n->right(), n->rightBox(B)));
       }
     }
   }
@@ -331,24 +336,24 @@ ThickBoolean ThickPaving::contains(const IntervalVector& X){
   return res;
 }
 
-ThickBoolean ThickPaving::Inside2(const IntervalVector& X, std::vector<Node*>& lst){
+ThickBoolean ThickPaving::Inside2(const IntervalVector& X, std::vector<NodeBox>& lst){
   ThickBoolean res =  EMPTY;
 
   // if ( (root.getBox() & X).is_empty() ) return MAYBE;
   // if ( !X.is_subset(root.getBox() ) ) return UNK;
 
-  std::list<Node*> L;
-  L.push_back(&root);
+  std::list<NodeBox> L;
+  L.push_back(NodeBox(&root, root.getBox()));
   while (!L.empty()){
-    Node* n=L.front();    L.pop_front();
-    IntervalVector tmp = (n->getBox() & X);
+    Node* n=L.front().first;    IntervalVector B(L.front().second);    L.pop_front();
+    IntervalVector tmp = (B & X);
     if ( !tmp.is_empty() && !tmp.is_flat() ){
       if (n->isLeaf()){
         res = res | n->value();
-        lst.push_back(n);
+        lst.push_back(NodeBox(n, B));
       } else {
-        L.push_back(n->left());
-        L.push_back(n->right());
+        L.push_back(NodeBox(n->left(), n->leftBox(B)));
+        L.push_back(NodeBox(n->right(), n->rightBox(B)));
       }
     }
   }
@@ -361,12 +366,13 @@ ThickBoolean ThickPaving::Inside2(const IntervalVector& X, std::vector<Node*>& l
 }
 
 
-ThickBoolean ThickPaving::fastIntersection2(const IntervalVector& Xm, const IntervalVector& Xp, std::vector<Node*> &lst){
+ThickBoolean ThickPaving::fastIntersection2(const IntervalVector& Xm, const IntervalVector& Xp, std::vector<NodeBox> &lst){
   bool intersect_in  = false;
   bool intersect_out = false;
   IntervalVector X = Xm | Xp;
-  for( auto&& n : lst){
-    IntervalVector tmp = (n->getBox() & X);
+  for( auto&& nb : lst){
+    Node* n = nb.first;
+    IntervalVector tmp = (nb.second & X);
     if ( ( n->value() == IN || n->value() == MAYBE_IN || n->value() == MAYBE ) && intersect_in == false){
         intersect_in = isThickIntersect(Xm, Xp, tmp);
     } else if ( (n->value() == OUT || n->value() == MAYBE || n->value() == MAYBE_OUT) && intersect_out == false){
@@ -406,11 +412,11 @@ bool projection_is_include(IntervalVector X, std::vector<IntervalVector> &lst, i
     return false;
 }
 
-ThickBoolean ThickPaving::Xm_inter_Xp_inside_P(IntervalVector X, std::vector<Node*> &lst){
+ThickBoolean ThickPaving::Xm_inter_Xp_inside_P(IntervalVector X, std::vector<NodeBox> &lst){
   ThickBoolean res = EMPTY;
   // if (lst.empty()) return UNK;
-  for (const auto& n : lst){
-    res = res | n->value();
+  for (const auto& nb : lst){
+    res = res | nb.first->value();
   }
   assert(res != EMPTY);
   if (res == IN )
@@ -493,7 +499,7 @@ ThickBoolean  ThickPaving::Intersect_fct(const IntervalVector& Xm, const Interva
 
   // firstly check if X is inside the paving
   // Keep track of boxes which intersect X
-  std::vector<Node*> lst;
+  std::vector<NodeBox> lst;
   ThickBoolean res0 = Inside2(X, lst);
   // if ( !X.is_subset(root.getBox()) ){
   //   // std::cout << "Here" << res0 << "\n";
@@ -531,14 +537,15 @@ ThickBoolean  ThickPaving::Intersect_fct(const IntervalVector& Xm, const Interva
       // l_out containing bixes which are outside P subset
       std::vector<IntervalVector> l_in;
       std::vector<IntervalVector> l_out;
-      for (const auto& n : lst){
-        IntervalVector tmp = X & n->getBox();
+      for (const auto& nb : lst){
+        const Node* n = nb.first;
+        IntervalVector tmp = X & nb.second;
         if (tmp.is_empty()) continue;
         if ( n->value() == IN || n->value() == MAYBE_IN || n->value() == MAYBE){
-          l_in.push_back(X & n->getBox());
+          l_in.push_back(tmp);
         }
         if (n->value() == OUT || n->value() == MAYBE_OUT || n->value() == MAYBE){
-          l_out.push_back(X & n->getBox());
+          l_out.push_back(tmp);
         }
       }
 
@@ -574,8 +581,8 @@ ThickPaving& ThickPaving::Sivia_visu(ThickTest &pdc, double eps, BINARY_OP op ){
 
 ThickPaving& ThickPaving::Sivia_visu(FuncTest &test, double eps, BINARY_OP op )
 {
-    list<Node*> L;
-    L.push_back(&root);
+    list<NodeBox> L;
+    L.push_back(NodeBox(&root, root.getBox()));
     int k = 0, j = 0;
     vibes::beginDrawing();
     vibes::newFigure("ThickPaving");
@@ -584,15 +591,15 @@ ThickPaving& ThickPaving::Sivia_visu(FuncTest &test, double eps, BINARY_OP op )
     vibes::axisAuto();
     while (!L.empty()){
         k++;
-        Node* n=L.front();    L.pop_front();
+        Node* n=L.front().first;    IntervalVector box(L.front().second);    L.pop_front();
       //  vibes::drawBox(B[i][0].lb(), B[i][0].ub(), B[i][1].lb(), B[i][1].ub(), "k[g]");
 
-        ThickBoolean testBi=test(n->getBox());
+        ThickBoolean testBi=test(box);
         ThickBoolean vali = op(n->value(),testBi);
 
         bool b1 = !is_singleton(vali);
         if (vali == EMPTY){
-          if (n->getBox().max_diam()>eps){
+          if (box.max_diam()>eps){
             vali = UNK;
           } else {
             // std::cout << n->isLeaf() << " " << n->value() << " " << testBi << " " << vali << "\n";
@@ -602,16 +609,16 @@ ThickPaving& ThickPaving::Sivia_visu(FuncTest &test, double eps, BINARY_OP op )
 				// On bisect quand :
 				// 	- max_diazm > eps
 				//  - vali n'est pas un singleton
-        if( !is_singleton(vali) && (n->getBox().max_diam()>eps)){
+        if( !is_singleton(vali) && (box.max_diam()>eps)){
             j++;
 						if(n->isLeaf()){
 							// cerr << "bisect " << n->value() << endl;
-							n->bisect(bisector);
+							n->bisect(bisector, box);
 						}
-            L.push_back(n->left());
-            L.push_back(n->right());
+            L.push_back(NodeBox(n->left(), n->leftBox(box)));
+            L.push_back(NodeBox(n->right(), n->rightBox(box)));
         } else {
-            const IntervalVector& B = n->getBox();
+            const IntervalVector& B = box;
             if (vali == IN)
                 vibes::drawBox(B[0].lb(), B[0].ub(), B[1].lb(), B[1].ub(), "[r]");
             else if (vali == OUT)
@@ -800,11 +807,11 @@ ThickPaving& ThickPaving::Sivia_visu(FuncTest &test, double eps, BINARY_OP op )
 //----------------------------------------------------------------------
 void ThickPaving::Contract_distance_gt_ThickPaving(double z, IntervalVector& X){
 //Contract X with respect to distance to a subThickPaving lower than z.
-  this->Contract_distance_gt_ThickPaving(root, z, X);
+  this->Contract_distance_gt_ThickPaving(root, root.getBox(), z, X);
 }
 
 
-void ThickPaving::Contract_distance_gt_ThickPaving(Node& n, double z, IntervalVector& X) //Contract X with respect to distance to a subThickPaving lower than z.
+void ThickPaving::Contract_distance_gt_ThickPaving(Node& n, const IntervalVector& box, double z, IntervalVector& X) //Contract X with respect to distance to a subThickPaving lower than z.
 {
 
    if (X.is_empty())  return;
@@ -816,8 +823,8 @@ void ThickPaving::Contract_distance_gt_ThickPaving(Node& n, double z, IntervalVe
    if ( n.isLeaf() || n.value() == OUT){
       Interval X1=X[0];
       Interval X2=X[1];
-      Interval A1=(n.getBox())[0];
-      Interval A2=(n.getBox())[1];
+      Interval A1=box[0];
+      Interval A2=box[1];
       Interval Z(0,z*z);    //X1^2+X2^2=Z
       Interval D1=X1-A1;
       Interval D2=X2-A2;
@@ -836,8 +843,8 @@ void ThickPaving::Contract_distance_gt_ThickPaving(Node& n, double z, IntervalVe
    }
      IntervalVector X1(X);
      IntervalVector X2(X);
-     Contract_distance_gt_ThickPaving(*n.left(),z,X1);
-     Contract_distance_gt_ThickPaving(*n.right(),z,X2);
+     Contract_distance_gt_ThickPaving(*n.left(),n.leftBox(box),z,X1);
+     Contract_distance_gt_ThickPaving(*n.right(),n.rightBox(box),z,X2);
      X = X1 | X2;
      return;
 }
@@ -1152,6 +1159,35 @@ ThickPaving& ThickPaving::USivia(ThickTest &pdc, double eps)
 // }
 
 //----------------------------------------------------------------------
+namespace {
+
+// Evaluation of a node of Sivia, of domain box: returns true if its subpavings have to be explored
+bool sivia_step(PNode<ThickBoolean>* n, const IntervalVector& box, FuncTest &test, double eps, const BINARY_OP& op, ibex::Bsc& bisector)
+{
+    ThickBoolean testBi=test(box);
+    ThickBoolean vali = op(n->value(),testBi);
+
+    if  ( (vali == EMPTY) && (box.max_diam()>eps)){
+        vali = UNK;
+    }
+
+    // On bisect quand :
+    // 	- max_diazm > eps
+    //  - vali n'est pas un singleton
+    bool explore = !is_singleton(vali)  && (box.max_diam()>eps);
+    if( explore ){
+        if(n->isLeaf()){
+            n->bisect(bisector, box);
+        }
+    } else {
+        n->remove_children();
+    }
+    n->setValue(vali);
+    return explore;
+}
+
+}
+
 ThickPaving& ThickPaving::Sivia(ThickTest &pdc, double eps, BINARY_OP op ){
 	FuncTest f = [&pdc](const IntervalVector& X)->ThickBoolean {
     return pdc.test(X);
@@ -1161,43 +1197,114 @@ ThickPaving& ThickPaving::Sivia(ThickTest &pdc, double eps, BINARY_OP op ){
 
 ThickPaving& ThickPaving::Sivia(FuncTest &test, double eps, BINARY_OP op )
 {
-    list<Node*> L= {&root};
-    // L.push_back(&root);
-    int k = 0, j = 0;
+    list<NodeBox> L= {NodeBox(&root, root.getBox())};
     while (!L.empty()){
-        k++;
-        Node* n=L.front();    L.pop_front();
+        Node* n=L.front().first;    IntervalVector box(L.front().second);    L.pop_front();
+        if(sivia_step(n, box, test, eps, op, bisector)){
+            L.push_back(NodeBox(n->left(), n->leftBox(box)));
+            L.push_back(NodeBox(n->right(), n->rightBox(box)));
+        }
+    }
+    return (*this);
+}
 
-        ThickBoolean testBi=test(n->getBox());
-        ThickBoolean vali = op(n->value(),testBi);
-        // Uggly trick
-        // if (n->isLeaf()&& testBi == MAYBE &&  ( n->value() == MAYBE_IN || n->value() == MAYBE_OUT)){
-        //   vali = MAYBE; // cerr << testBi << " "  << vali << "\n";
-        // }
+namespace {
 
-        if  ( (vali == EMPTY) && (n->getBox().max_diam()>eps)){
-            vali = UNK;
-        } else {
-            // std::cout << n->isLeaf() << " " << n->value() << " " << testBi << " " << vali << "\n";
-        }
+int sivia_nb_threads(int nb_threads)
+{
+    if(nb_threads <= 0)
+      nb_threads = std::thread::hardware_concurrency();
+    return std::max(1, nb_threads);
+}
 
-				// On bisect quand :
-				// 	- max_diazm > eps
-				//  - vali n'est pas un singleton
-        if( !is_singleton(vali)  && (n->getBox().max_diam()>eps)){
-            j++;
-						if(n->isLeaf()){
-							n->bisect(bisector);
-						}
-            L.push_back(n->left());
-            L.push_back(n->right());
-        } else {
-            // vali = (vali == UNK) ? MAYBE : vali;
-						n->remove_children();
+}
+
+ThickPaving& ThickPaving::Sivia(const std::function<std::unique_ptr<ThickTest>()> &pdc_factory, double eps, BINARY_OP op, int nb_threads){
+    // One test for each thread
+    vector<std::unique_ptr<ThickTest>> v_pdc(sivia_nb_threads(nb_threads));
+    vector<FuncTest> tests;
+    for (auto& pdc : v_pdc){
+        pdc = pdc_factory();
+        ThickTest* p = pdc.get();
+        tests.push_back([p](const IntervalVector& X)->ThickBoolean {
+          return p->test(X);
+        });
+    }
+    return Sivia(tests, eps, op);
+}
+
+ThickPaving& ThickPaving::Sivia(FuncTest &test, double eps, BINARY_OP op, int nb_threads)
+{
+    vector<FuncTest> tests(sivia_nb_threads(nb_threads), test);
+    return Sivia(tests, eps, op);
+}
+
+ThickPaving& ThickPaving::Sivia(vector<FuncTest> &tests, double eps, BINARY_OP op)
+{
+    const int nb_threads = tests.size();
+    assert(nb_threads > 0);
+
+    // The top of the tree is explored level by level, until there are
+    // enough independent subtrees to balance the load between the threads
+    vector<NodeBox> level = {NodeBox(&root, root.getBox())};
+    int depth = 0;
+    while (!level.empty() && level.size() < 8*(size_t)nb_threads){
+        vector<NodeBox> next_level;
+        for (const auto& nb : level){
+            Node* n = nb.first;
+            if(sivia_step(n, nb.second, tests[0], eps, op, bisector)){
+                next_level.push_back(NodeBox(n->left(), n->leftBox(nb.second)));
+                next_level.push_back(NodeBox(n->right(), n->rightBox(nb.second)));
+            }
         }
-        n->setValue(vali);
+        level.swap(next_level);
+        depth++;
     }
-    //std::cerr << "k = " << k  << "|| j = " << j << std::endl;
+
+    // Each subtree is explored depth first and reunited by one thread,
+    // its nodes being allocated from the pool of this thread
+    std::atomic<size_t> next_subtree(0);
+    std::atomic<bool> stop(false);
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    auto explore_subtrees = [&](int thread_id)
+    {
+      try {
+        FuncTest& test = tests[thread_id];
+        ibex::LargestFirst thread_bisector(bisector);
+        vector<NodeBox> stack;
+        for (size_t i = next_subtree++; i < level.size() && !stop; i = next_subtree++){
+            stack.push_back(level[i]);
+            while (!stack.empty() && !stop){
+                Node* n=stack.back().first;    IntervalVector box(stack.back().second);    stack.pop_back();
+                if(sivia_step(n, box, test, eps, op, thread_bisector)){
+                    stack.push_back(NodeBox(n->right(), n->rightBox(box)));
+                    stack.push_back(NodeBox(n->left(), n->leftBox(box)));
+                }
+            }
+            level[i].first->reunite();
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if(!error)
+          error = std::current_exception();
+        stop = true;
+      }
+    };
+
+    vector<std::thread> threads;
+    for (int i = 1; i < nb_threads; i++)
+      threads.push_back(std::thread(explore_subtrees, i));
+    explore_subtrees(0); // the calling thread takes part
+    for (auto& t : threads)
+      t.join();
+
+    if(error)
+      std::rethrow_exception(error);
+
+    // The subtrees being reunited, only the top of the tree remains to be simplified
+    root.reunite(depth);
     return (*this);
 }
 // ThickPaving& ThickPaving::Sivia(FuncTest &test, double eps, BINARY_OP op )
@@ -1311,20 +1418,20 @@ ThickPaving& ThickPaving::FastSivia(ThickTest &pdc, double eps, BINARY_OP op ){
 
 ThickPaving& ThickPaving::FastSivia(FuncTest &test, double eps, BINARY_OP op )
 {
-    list<Node*> L;
-    L.push_back(&root);
+    list<NodeBox> L;
+    L.push_back(NodeBox(&root, root.getBox()));
     int k = 0, j = 0;
     while (!L.empty()){
         k++;
-        Node* n=L.front();    L.pop_front();
+        Node* n=L.front().first;    IntervalVector box(L.front().second);    L.pop_front();
 
 
-        ThickBoolean testBi=test(n->getBox());
+        ThickBoolean testBi=test(box);
         ThickBoolean vali = op(n->value(),testBi);
 
         bool b1 = !is_singleton(vali);
 
-        if (vali == IN || ( test(n->getBox().mid()) == IN) ){
+        if (vali == IN || ( test(box.mid()) == IN) ){
         // if (vali == IN ) {
           // root.clear();
           // root.setValue(IN);
@@ -1336,14 +1443,14 @@ ThickPaving& ThickPaving::FastSivia(FuncTest &test, double eps, BINARY_OP op )
 				// On bisect quand :
 				// 	- max_diazm > eps
 				//  - vali n'est pas un singleton
-        if( (b1) && (n->getBox().max_diam()>eps)){
+        if( (b1) && (box.max_diam()>eps)){
             j++;
 						if(n->isLeaf()){
 							// cerr << "bisect " << n->value() << endl;
-							n->bisect(bisector);
+							n->bisect(bisector, box);
 						}
-            L.push_back(n->left());
-            L.push_back(n->right());
+            L.push_back(NodeBox(n->left(), n->leftBox(box)));
+            L.push_back(NodeBox(n->right(), n->rightBox(box)));
         } else {
             // vali = (vali == UNK) ? MAYBE : vali;
 						n->remove_children();
@@ -1373,29 +1480,29 @@ ThickBoolean ThickPaving::erode(ThickTest &pdc, double eps, BINARY_OP op ){
 
 ThickBoolean ThickPaving::erode(FuncTest &test, double eps, BINARY_OP op){
   // TWO PASS VERSION
-  list<Node*> L;
-  L.push_back(&root);
+  list<NodeBox> L;
+  L.push_back(NodeBox(&root, root.getBox()));
   int k = 0, j = 0;
   bool find_in = false;
   // Pass1 on test
   while (!L.empty()){
     k++;
-    Node* n=L.front();    L.pop_front();
-    ThickBoolean vali = test(n->getBox());
-    ThickBoolean vali_mid = (!is_singleton(vali)) ? test(n->getBox().mid()) : vali;
+    Node* n=L.front().first;    IntervalVector box(L.front().second);    L.pop_front();
+    ThickBoolean vali = test(box);
+    ThickBoolean vali_mid = (!is_singleton(vali)) ? test(box.mid()) : vali;
     if (opUpper(vali_mid) == IN){
       find_in = true;
       break;
     }
     bool b1 = !is_singleton(opUpper(vali));
 
-    if( (b1) && (n->getBox().max_diam()>eps)){
+    if( (b1) && (box.max_diam()>eps)){
         j++;
         if(n->isLeaf()){
-          n->bisect(bisector);
+          n->bisect(bisector, box);
         }
-        L.push_back(n->left());
-        L.push_back(n->right());
+        L.push_back(NodeBox(n->left(), n->leftBox(box)));
+        L.push_back(NodeBox(n->right(), n->rightBox(box)));
     } else {
         n->remove_children();
     }
@@ -1408,21 +1515,21 @@ ThickBoolean ThickPaving::erode(FuncTest &test, double eps, BINARY_OP op){
     return IN;
   }
 
-  L.clear(); L.push_back(&root);
+  L.clear(); L.push_back(NodeBox(&root, root.getBox()));
   root.clear();
   // Second pass
   while (!L.empty()){
     k++;
-    Node* n=L.front();    L.pop_front();
+    Node* n=L.front().first;    IntervalVector box(L.front().second);    L.pop_front();
     // ThickBoolean vali;
     // if(!n->isLeaf()){
     //    vali = n->value();
     // } else {
-    //    vali = ( is_singleton(n->value()) ) ? n->value() : test(n->getBox());
+    //    vali = ( is_singleton(n->value()) ) ? n->value() : test(box);
     // }
 
-    ThickBoolean vali = test(n->getBox());
-    ThickBoolean vali_mid = (is_singleton(vali)) ? vali : test(n->getBox().mid());
+    ThickBoolean vali = test(box);
+    ThickBoolean vali_mid = (is_singleton(vali)) ? vali : test(box.mid());
     if (vali == IN || opLower(vali_mid) == IN){
       n->setValue(IN);
       return OUT;
@@ -1430,13 +1537,13 @@ ThickBoolean ThickPaving::erode(FuncTest &test, double eps, BINARY_OP op){
     }
     bool b1 = !is_singleton(opLower(vali));
 
-    if( (b1) && (n->getBox().max_diam()>eps)){
+    if( (b1) && (box.max_diam()>eps)){
         j++;
         if(n->isLeaf()){
-          n->bisect(bisector);
+          n->bisect(bisector, box);
         }
-        L.push_back(n->left());
-        L.push_back(n->right());
+        L.push_back(NodeBox(n->left(), n->leftBox(box)));
+        L.push_back(NodeBox(n->right(), n->rightBox(box)));
     } else {
         n->remove_children();
     }
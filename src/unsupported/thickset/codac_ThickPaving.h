@@ -13,6 +13,8 @@
 #include <iostream>
 #include <functional>
 #include <string>
+#include <memory>
+#include <utility>
 #include <ibex_Interval.h>
 #include <ibex_IntervalVector.h>
 #include <ibex_LargestFirst.h>
@@ -44,6 +46,7 @@ namespace codac
 	class ThickPaving
 	{
 		using Node = PNode<ThickBoolean>;
+		using NodeBox = std::pair<Node *, IntervalVector>; // node and its domain
 
 	public:
 		Node root;
@@ -72,6 +75,11 @@ namespace codac
 		// Paving algorithms
 		ThickPaving &Sivia(ThickTest &pdc, double eps, BINARY_OP op = ibex::opInter);
 		ThickPaving &Sivia(FuncTest &test, double eps, BINARY_OP op = ibex::opInter);
+		// Multithreaded Sivia, the resulting paving is reunited. Tests are generally not reentrant:
+		// one test is created for each thread by pdc_factory (called sequentially beforehand)
+		ThickPaving &Sivia(const std::function<std::unique_ptr<ThickTest>()> &pdc_factory, double eps, BINARY_OP op, int nb_threads);
+		// Multithreaded Sivia with a test shared by the threads: the test (and op) must be reentrant
+		ThickPaving &Sivia(FuncTest &test, double eps, BINARY_OP op, int nb_threads);
 		// ThickPaving Sivia(ThickTest& pdc,BINARY_OP op,double eps);
 		ThickPaving &USivia(ThickTest &pdc, double eps);
 
@@ -85,7 +93,7 @@ namespace codac
 		ThickBoolean erode(ThickTest &pdc, double eps, BINARY_OP op);
 
 		void Contract_distance_gt_ThickPaving(double z, IntervalVector &X);
-		void Contract_distance_gt_ThickPaving(Node &n, double z, IntervalVector &X);
+		void Contract_distance_gt_ThickPaving(Node &n, const IntervalVector &box, double z, IntervalVector &X);
 		// Paving tests
 		ThickBoolean contains(const IntervalVector &box);
 		// ThickBoolean Inside2(const IntervalVector& box, std::vector<Node*>& lst);
@@ -106,10 +114,11 @@ namespace codac
 		// ThickPaving& Sivia(IntervalVector(*F)(const IntervalVector&),ThickPaving& X,ThickBoolean(*op)(const ThickBoolean&, const ThickBoolean&),double eps);
 
 	private:
-		ThickBoolean Inside2(const IntervalVector &X, std::vector<Node *> &lst);
-		ThickBoolean fastIntersection2(const IntervalVector &Xm, const IntervalVector &Xp, std::vector<Node *> &lst);
+		ThickBoolean Inside2(const IntervalVector &X, std::vector<NodeBox> &lst);
+		ThickBoolean fastIntersection2(const IntervalVector &Xm, const IntervalVector &Xp, std::vector<NodeBox> &lst);
 		std::pair<bool, std::vector<IntervalVector>> fastIntersection(const IntervalVector &Xm, const IntervalVector &Xp);
-		ThickBoolean Xm_inter_Xp_inside_P(IntervalVector X, std::vector<Node *> &lst);
+		ThickBoolean Xm_inter_Xp_inside_P(IntervalVector X, std::vector<NodeBox> &lst);
+		ThickPaving &Sivia(std::vector<FuncTest> &tests, double eps, BINARY_OP op); // one test per thread
 		/* nothing */
 	};
 
@@ -1,5 +1,6 @@
 #include "catch_interval.hpp"
 #include "codac_tube_arithmetic.h"
+#include "codac_tube_arithmetic_lazy.h"
 #include "codac_traj_arithmetic.h"
 
 using namespace Catch;
@@ -533,6 +534,66 @@ TEST_CASE("Arithmetic on tubes")
 }
 
 
+TEST_CASE("Lazy arithmetic on tubes")
+{
+  SECTION("Tests scalar tube")
+  {
+    Tube x(Interval(0.,10.), 0.1, TFunction("cos(t)+[-0.1,0.1]"));
+    Tube y(Interval(0.,10.), 0.1, TFunction("sin(t)+[-0.2,0.2]"));
+    Tube w(Interval(0.,10.), 0.1, TFunction("exp(-t)+[0.5,0.6]"));
+    Trajectory traj(Interval(0.,10.), TFunction("t^2"));
+    Interval dt(0.1);
+
+    CHECK((sqrt(sqr(lazy(x)) + sqr(lazy(y))) * dt).eval() == sqrt(sqr(x) + sqr(y)) * dt);
+    CHECK((atan2(cos(lazy(x)), w) - min(lazy(x), 2.) / (lazy(y) | w)).eval() == atan2(cos(x), w) - min(x, 2.) / (y | w));
+    CHECK(((lazy(x) + traj) * exp(lazy(w)) - traj * lazy(y)).eval() == (x + traj) * exp(w) - traj * y);
+    CHECK((-pow(lazy(x), 2) + root(lazy(w), 3) + 1.).eval() == -pow(x, 2) + root(w, 3) + 1.);
+
+    // Evaluation in a tube involved in the expression
+    Tube z(x);
+    sqr(lazy(z) + 1.).eval(z);
+    CHECK(z == sqr(x + 1.));
+  }
+
+  SECTION("Tests scalar tubes of different slicing")
+  {
+    Tube x(Interval(0.,10.), 0.1, Interval(1.,2.));
+    Tube y(Interval(0.,10.), 0.3, Interval(-1.,3.));
+    x.sample(3.05);
+    x.set(Interval(5.,6.), 10.);
+    Trajectory traj(Interval(0.,10.), TFunction("sin(t)"));
+
+    Tube z = sqrt(sqr(lazy(x)) + sqr(lazy(y)));
+    CHECK(Tube::same_slicing(z, sqrt(sqr(x) + sqr(y))));
+    CHECK(z == sqrt(sqr(x) + sqr(y)));
+
+    z = (lazy(x) + traj) - lazy(y);
+    CHECK(z == (x + traj) - y);
+    z = traj / (lazy(y) + 1.) + lazy(x);
+    CHECK(z == traj / (y + 1.) + x);
+  }
+
+  SECTION("Tests vector tube")
+  {
+    Tube x(Interval(0.,10.), 0.1, TFunction("cos(t)+[-0.1,0.1]"));
+    Tube y(Interval(0.,10.), 0.2, TFunction("sin(t)+[-0.2,0.2]"));
+    Tube w(Interval(0.,10.), 0.1, Interval(0.5,0.7));
+    TubeVector v(3, x), u(3, y);
+
+    TubeVector z = lazy(v) + 2. * lazy(u);
+    TubeVector z2 = lazy(x) * (lazy(v) - u) / w;
+    CHECK(z.size() == 3);
+    for(int i = 0 ; i < 3 ; i++)
+    {
+      CHECK(z[i] == x + 2. * y);
+      CHECK(z2[i] == x * (x - y) / w);
+    }
+
+    z = abs(-lazy(v)) | IntervalVector(3, Interval(0.,1.));
+    CHECK(z == (abs(-v) | IntervalVector(3, Interval(0.,1.))));
+  }
+}
+
 TEST_CASE("Arithmetic on trajs")
 {
   SECTION("Tests scalar traj")
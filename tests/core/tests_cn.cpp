@@ -1,3 +1,6 @@
+#include <set>
+#include <cstdio>
+#include <fstream>
 #include "catch_interval.hpp"
 #include "codac_Variable.h"
 #include "codac_ContractorNetwork.h"
@@ -142,6 +145,250 @@ TEST_CASE("CN simple")
     CHECK(cn.nb_dom() == 12);
   }
 
+  SECTION("Multithreaded propagation")
+  {
+    double dt = 0.1;
+    Interval domain(0.,10.);
+    Tube x_seq(domain, dt, Interval(-10.,10.)), v(domain, dt, Interval(-1.,1.));
+    x_seq.set(Interval(0.), 0.);
+    Tube x_par(x_seq);
+
+    CtcDeriv ctc_deriv;
+
+    ContractorNetwork cn_seq;
+    cn_seq.set_fixedpoint_ratio(0.);
+    cn_seq.add(ctc_deriv, {x_seq, v});
+    cn_seq.contract();
+
+    ContractorNetwork cn_par;
+    cn_par.set_fixedpoint_ratio(0.);
+    cn_par.set_nb_threads(4);
+    CHECK(cn_par.nb_threads() == 4);
+    cn_par.add(ctc_deriv, {x_par, v});
+    cn_par.contract();
+
+    CHECK(cn_par.nb_ctc_in_stack() == 0);
+    CHECK(x_par == x_seq);
+    CHECK(x_par(10.) == Interval(-10.,10.));
+    CHECK(ApproxIntv(x_par(5.)) == Interval(-5.,5.));
+  }
+
+  SECTION("Multithreaded propagation of independent contractors")
+  {
+    const int n = 6; // number of independent systems
+    double dt = 0.5;
+    Interval domain(0.,10.);
+
+    CtcDeriv ctc_deriv;
+    CtcEval ctc_eval;
+    ctc_eval.enable_time_propag(false);
+    CtcFunction ctc_add(Function("b", "c", "a", "b+c-a"));
+
+    // Same systems, contracted sequentially (k=0) or with several threads (k=1)
+    vector<Tube> v_x[2], v_v[2];
+    vector<Interval> v_t[2], v_z[2], v_a[2], v_b[2], v_c[2];
+    ContractorNetwork cn[2];
+    cn[1].set_nb_threads(4);
+
+    for(int k = 0 ; k < 2 ; k++)
+    {
+      for(int i = 0 ; i < n ; i++)
+      {
+        v_x[k].push_back(Tube(domain, dt, Interval(-10.,10.)));
+        v_x[k][i].set(Interval(i), 0.);
+        v_v[k].push_back(Tube(domain, dt, Interval(-1.,1.)));
+        v_t[k].push_back(Interval(5.));
+        v_z[k].push_back(Interval(i+1.,i+2.));
+        v_a[k].push_back(Interval(0.,1.+i));
+        v_b[k].push_back(Interval(-2.,3.));
+        v_c[k].push_back(Interval(1.,20.));
+      }
+
+      cn[k].set_fixedpoint_ratio(0.);
+      for(int i = 0 ; i < n ; i++)
+      {
+        cn[k].add(ctc_deriv, {v_x[k][i], v_v[k][i]});
+        cn[k].add(ctc_eval, {v_t[k][i], v_z[k][i], v_x[k][i], v_v[k][i]});
+        cn[k].add(ctc_add, {v_a[k][i], v_b[k][i], v_c[k][i]});
+      }
+      cn[k].contract();
+      CHECK(cn[k].nb_ctc_in_stack() == 0);
+    }
+
+    CHECK(cn[1].nb_threads() == 4);
+    CHECK(cn[1].nb_ctc() == cn[0].nb_ctc());
+
+    for(int i = 0 ; i < n ; i++)
+    {
+      for(const Slice *s0 = v_x[0][i].first_slice(), *s1 = v_x[1][i].first_slice() ; s0 ;
+        s0 = s0->next_slice(), s1 = s1->next_slice())
+      {
+        CHECK(ApproxIntv(s1->input_gate()) == s0->input_gate());
+        CHECK(ApproxIntv(s1->codomain()) == s0->codomain());
+      }
+      CHECK(ApproxIntv(v_x[1][i](10.)) == v_x[0][i](10.));
+      CHECK(ApproxIntv(v_x[1][i](5.)) == Interval(i+1.,i+2.));
+      CHECK(v_a[1][i] == v_a[0][i]);
+      CHECK(v_b[1][i] == v_b[0][i]);
+      CHECK(v_c[1][i] == v_c[0][i]);
+    }
+  }
+
+  SECTION("Fixed point with tube and slice contractors")
+  {
+    double dt = 0.5;
+    Interval domain(0.,10.);
+    Tube x(domain, dt, Interval(-10.,10.)), v(domain, dt, Interval(-1.,1.));
+    x.set(Interval(0.), 0.);
+    Interval t1(5.), z(1.,2.);
+
+    CtcDeriv ctc_deriv; // defined on the slices
+    CtcEval ctc_eval; // defined on the tube
+    ctc_eval.enable_time_propag(false);
+
+    ContractorNetwork cn;
+    cn.set_fixedpoint_ratio(0.);
+    cn.add(ctc_deriv, {x, v});
+    cn.add(ctc_eval, {t1, z, x, v});
+    cn.contract();
+
+    CHECK(cn.nb_ctc_in_stack() == 0);
+    CHECK(ApproxIntv(x(5.)) == Interval(1.,2.));
+    CHECK(ApproxIntv(x(2.5)) == Interval(-1.5,2.5));
+    CHECK(ApproxIntv(x(10.)) == Interval(-4.,7.));
+  }
+
+  SECTION("Volume of a tube domain")
+  {
+    Tube x(Interval(0.,3.), 1., Interval(-1.,1.));
+    x.set(Interval(0.), 0.);
+    x.set(Interval(0.,1.), 1.);
+
+    // Codomain and gates, each gate being counted once
+    double vol = x.volume() + x.first_slice()->input_gate().diam();
+    for(const Slice *s = x.first_slice() ; s ; s = s->next_slice())
+      vol += s->output_gate().diam();
+    CHECK(Approx(Domain(x).compute_volume()) == vol);
+
+    double slices_vol = 0.;
+    for(Slice *s = x.first_slice() ; s ; s = s->next_slice())
+      slices_vol += Domain(*s).compute_volume();
+    CHECK(Approx(slices_vol) == vol);
+  }
+
+  SECTION("Scheduling policies")
+  {
+    double dt = 0.5;
+    Interval domain(0.,10.);
+    Tube v(domain, dt, Interval(-1.,1.));
+
+    for(auto scheduling : { ContractorNetwork::Scheduling::DEFAULT,
+                            ContractorNetwork::Scheduling::FIFO,
+                            ContractorNetwork::Scheduling::LIFO,
+                            ContractorNetwork::Scheduling::PRIORITY,
+                            ContractorNetwork::Scheduling::ROUND_ROBIN })
+    {
+      Tube x(domain, dt, Interval(-10.,10.));
+      x.set(Interval(0.), 0.);
+      Interval t1(5.), z(1.,2.);
+
+      CtcDeriv ctc_deriv;
+      CtcEval ctc_eval;
+      ctc_eval.enable_time_propag(false);
+
+      ContractorNetwork cn;
+      cn.set_fixedpoint_ratio(0.);
+      cn.set_scheduling(scheduling);
+      CHECK(cn.scheduling() == scheduling);
+      cn.add(ctc_deriv, {x, v});
+      cn.add(ctc_eval, {t1, z, x, v});
+      cn.contract();
+
+      CHECK(cn.nb_ctc_in_stack() == 0);
+      CHECK(ApproxIntv(x(5.)) == Interval(1.,2.));
+      CHECK(ApproxIntv(x(2.5)) == Interval(-1.5,2.5));
+      CHECK(ApproxIntv(x(10.)) == Interval(-4.,7.));
+    }
+  }
+
+  SECTION("Profiling")
+  {
+    double dt = 0.5;
+    Interval domain(0.,10.);
+    Tube x(domain, dt, Interval(-10.,10.)), v(domain, dt, Interval(-1.,1.));
+    x.set(Interval(0.), 0.);
+
+    CtcDeriv ctc_deriv;
+
+    ContractorNetwork cn;
+    cn.add(ctc_deriv, {x, v});
+    cn.enable_profiling();
+    cn.contract();
+
+    const vector<ProfiledCall>& v_calls = cn.profiled_calls();
+    CHECK(!v_calls.empty());
+
+    set<const Contractor*> s_ctc;
+    for(const auto& call : v_calls)
+    {
+      CHECK(call.thread_id == 0);
+      CHECK(call.t_start >= 0.);
+      CHECK(call.duration >= 0.);
+      CHECK(call.gain >= 0.);
+      CHECK(call.gain <= 1.);
+      s_ctc.insert(call.ctc);
+    }
+
+    int nb_calls = 0;
+    for(const auto& ctc : s_ctc)
+      nb_calls += ctc->nb_calls();
+    CHECK(nb_calls == (int)v_calls.size());
+    CHECK(v_calls.back().queue_length == 0);
+
+    for(const string& filename : { "cn_profiling.json", "cn_profiling.csv", "cn_trace.json" })
+    {
+      if(filename == "cn_profiling.csv")
+        cn.export_profiling_csv(filename);
+      else if(filename == "cn_trace.json")
+        cn.export_chrome_trace(filename);
+      else
+        cn.export_profiling_json(filename);
+
+      ifstream file(filename);
+      CHECK(file.good());
+      file.close();
+      remove(filename.c_str());
+    }
+
+    cn.reset_profiling();
+    CHECK(cn.profiled_calls().empty());
+    for(const auto& ctc : s_ctc)
+      CHECK(ctc->nb_calls() == 0);
+  }
+
+  SECTION("Profiling in ordered mode")
+  {
+    CtcFunction ctc_add(Function("b", "c", "a", "b+c-a"));
+    Interval x(0,1), y(-2,3), a(1,20);
+
+    ContractorNetwork cn;
+    cn.add(ctc_add, {x,y,a});
+    cn.contract(); // volumes of the domains are saved
+    CHECK(y == Interval(0,3));
+    CHECK(a == Interval(1,4));
+
+    a &= Interval(1,2);
+    cn.trigger_all_contractors();
+    cn.enable_profiling();
+    cn.contract_ordered_mode();
+    CHECK(y == Interval(0,2));
+
+    // Gain recorded after the update of the volumes: 1-|[1,2]|/|[1,4]|
+    const vector<ProfiledCall>& v_calls = cn.profiled_calls();
+    REQUIRE(v_calls.size() == 1);
+    CHECK(v_calls[0].gain == Approx(2./3.));
+  }
+
   SECTION("With f")
   {
     double dt = 5.;
@@ -9,6 +9,7 @@
 #include "codac_predef_values.h"
 #include "codac2_Tube.h"
 #include "codac2_CtcDiffInclusion.h"
+#include "codac_CtcDeriv.h"
 
 using namespace Catch;
 using namespace Detail;
@@ -371,8 +372,8 @@ TEST_CASE("Test codac2::tubes")
     CHECK(x.nb_slices() == 10);
     CHECK(tdomain->iterator_tslice(-oo) == tdomain->_tslices.end());
     CHECK(tdomain->iterator_tslice(oo) == tdomain->_tslices.end());
-    CHECK(x.first_slice_ptr() == tdomain->iterator_tslice(0.)->_slices.at(&x));
-    CHECK(x.last_slice_ptr() == tdomain->iterator_tslice(1.)->_slices.at(&x));
+    CHECK(x.first_slice_ptr() == tdomain->iterator_tslice(0.)->slice_ptr(x));
+    CHECK(x.last_slice_ptr() == tdomain->iterator_tslice(1.)->slice_ptr(x));
 
     for(auto& s : x)
       s.set(IntervalVector(2,s.t0_tf()));
@@ -582,6 +583,43 @@ TEST_CASE("Test codac2::tubes")
     CHECK(y.codomain() == Interval(2));
   }
 
+  SECTION("Codomains stored in the columns of the tubes")
+  {
+    auto tdomain = create_tdomain(Interval(0,2), 1., false);
+    Tube<Interval> x(tdomain, Interval(-1,1));
+    Tube<IntervalVector> y(tdomain, IntervalVector(2,Interval(-2,2)));
+    x(tdomain->tslices().begin()).set(Interval(0,1));
+
+    tdomain->sample(0.5, true); // a slice and a gate are inserted in the first tslice
+    CHECK(tdomain->nb_tslices() == 4);
+    CHECK(x._codomains.nb_rows() == 4);
+    CHECK(y._codomains.nb_rows() == 4);
+
+    size_t row = 0;
+    for(auto it = tdomain->tslices().begin() ; it != tdomain->tslices().end() ; ++it, ++row)
+      CHECK(it->row() == row);
+
+    auto it = tdomain->tslices().begin();
+    CHECK(x(it).codomain() == Interval(0,1));
+    CHECK(x(std::next(it)).codomain() == Interval(0,1));
+    CHECK(x(std::next(it,2)).codomain() == Interval(0,1));
+    CHECK(x(std::next(it,3)).codomain() == Interval(-1,1));
+    CHECK(y(std::next(it,3)).codomain() == IntervalVector(2,Interval(-2,2)));
+
+    x(std::next(it,3)).set(Interval(0.5));
+    tdomain->delete_gates();
+    CHECK(tdomain->nb_tslices() == 3);
+    CHECK(x._codomains.nb_rows() == 3);
+    CHECK(y._codomains.nb_rows() == 3);
+    CHECK(x(std::next(tdomain->tslices().begin(),2)).codomain() == Interval(0.5));
+    CHECK(x.codomain() == Interval(0,1));
+
+    Tube<Interval> cx(x); // the copy owns its column
+    cx.set(Interval(0.5));
+    CHECK(cx.codomain() == Interval(0.5));
+    CHECK(x.codomain() == Interval(0,1));
+  }
+
   SECTION("Tube not empty if built from a Function")
   {
     auto tdomain = create_tdomain(Interval(0,5), 0.01, true);
@@ -606,4 +644,29 @@ TEST_CASE("Test codac2::tubes")
     CHECK(ApproxIntv(tdomain->iterator_tslice(2.)->t0_tf()) == Interval(1.900000000000001, 2.000000000000002));
     CHECK(ApproxIntv(a.eval(Interval(1,2))) == Interval(-2.26146836547144, 7.216099682706644));
   }
-}
\ No newline at end of file
+
+  SECTION("Testing CtcDeriv on codac2 tubes")
+  {
+    auto tdomain = create_tdomain(Interval(0,1), 1., true);
+    CHECK(tdomain->nb_tslices() == 3);
+
+    Tube<Interval> x(tdomain), v(tdomain, Interval(-1,1));
+    x.set(Interval(0.), 0.);
+    x.set(Interval(0.), 1.);
+
+    codac::CtcDeriv ctc_deriv;
+    ctc_deriv.contract(x, v);
+    CHECK(x(tdomain->tslices().begin()).codomain() == Interval(0.));
+    CHECK(ApproxIntv(x(std::next(tdomain->tslices().begin())).codomain()) == Interval(-0.5,0.5));
+    CHECK(x(std::prev(tdomain->tslices().end())).codomain() == Interval(0.));
+
+    IntervalVector x0(2, Interval(-1,1));
+    x0[0] = Interval(0.);
+    Tube<IntervalVector> xv(tdomain, IntervalVector(2, Interval(-1,1)));
+    xv[0].set(Interval());
+    xv.set(x0, 0.);
+    ctc_deriv.contract(xv, codac::TimePropag::FORWARD);
+    CHECK(ApproxIntv(xv(std::next(tdomain->tslices().begin())).codomain()[0]) == Interval(-1,1));
+    CHECK(ApproxIntv(xv(std::prev(tdomain->tslices().end())).codomain()[0]) == Interval(-1,1));
+  }
+}
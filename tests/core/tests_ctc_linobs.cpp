@@ -0,0 +1,52 @@
+#include "catch_interval.hpp"
+
+// Using #define so that we can access protected methods
+// of the class for tests purposes
+#define protected public
+#include "codac_CtcLinobs.h"
+
+using namespace Catch;
+using namespace Detail;
+using namespace std;
+using namespace ibex;
+using namespace codac;
+
+TEST_CASE("CtcLinobs")
+{
+  SECTION("Matrix exponentials on a uniformly sliced tube")
+  {
+    Matrix A(2,2);
+    A[0][0] = 0.;  A[0][1] = 1.;
+    A[1][0] = -1.; A[1][1] = -1.;
+
+    Vector b(2);
+    b[0] = 0.; b[1] = 1.;
+
+    Interval tdomain(0.,10.);
+    double dt = 0.125; // exactly representable: all the slices have the same width
+    Tube u(tdomain, dt, Interval(-0.1,0.1));
+    TubeVector x(tdomain, dt, 2);
+    x.set(IntervalVector(2, Interval(-0.1,0.1)), 0.);
+    TubeVector x_ref(x);
+
+    CtcLinobs ctc_linobs(A, b);
+    ctc_linobs.contract(x, u);
+
+    // Only e^{A dt}, e^{A [0,dt]}, e^{-A dt} and e^{-A [0,dt]} have been computed
+    CHECK(ctc_linobs.m_exp_At_cache.size() == 4);
+
+    // The memoized values are the ones of the uncached evaluation
+    for(const auto& e : ctc_linobs.m_exp_At_cache)
+    {
+      Matrix A_e(2,2);
+      A_e[0][0] = e.first[0]; A_e[0][1] = e.first[1];
+      A_e[1][0] = e.first[2]; A_e[1][1] = e.first[3];
+      CHECK(e.second == CtcLinobs::exp_At(A_e, Interval(e.first[4], e.first[5])));
+    }
+
+    // A new contractor, with an empty cache, gives the same result
+    CtcLinobs ctc_linobs_ref(A, b);
+    ctc_linobs_ref.contract(x_ref, u);
+    CHECK(x == x_ref);
+  }
+}
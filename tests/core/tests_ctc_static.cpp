@@ -43,6 +43,29 @@ TEST_CASE("CtcStatic")
     CHECK(x[0] == expected);
     CHECK(x[1] == expected);
   }
+
+  SECTION("Test parallel CtcStatic")
+  {
+    Interval tdomain(0., 10.);
+    TubeVector x(tdomain, 0.01, TFunction("(cos(t)+[-0.5,0.5] ; sin(t)+[-0.5,0.5])"));
+    x.sample(3.005);
+    TubeVector x0(x);
+
+    Function f("t", "x[2]", "(x[0]-cos(2*t) ; x[1]+[-0.2,0.2]-sin(t))");
+    CtcFunction ctc_f(f);
+    CtcStatic ctc_static(ctc_f, true);
+    ctc_static.restrict_tdomain(Interval(1.,8.));
+
+    TubeVector x_seq(x);
+    ctc_static.contract(x_seq);
+
+    ctc_static.set_nb_threads(4, [&]() { return unique_ptr<Ctc>(new CtcFunction(f)); });
+    CHECK(ctc_static.nb_threads() == 4);
+    ctc_static.contract(x);
+
+    CHECK(x == x_seq);
+    CHECK(x != x0);
+  }
 }
 
 TEST_CASE("CtcFunction")
@@ -57,4 +80,22 @@ TEST_CASE("CtcFunction")
     ctc_max.contract(tube);
     CHECK(tube[2].codomain() == Interval(4,5));
   }
+
+  SECTION("Test parallel CtcFunction")
+  {
+    TubeVector x(Interval(0.,10.), 0.01, TFunction("(cos(t)+[-0.5,0.5] ; sin(t)+[-0.5,0.5] ; [-1,1])"));
+    x[2].set(Interval(-0.1,0.1), 5.);
+
+    CtcFunction ctc_f(Function("x[3]", "(x[0]^2+x[1]^2-1+x[2] ; x[0]-x[1]*x[2])"));
+    TubeVector x_seq(x);
+    ctc_f.contract(x_seq);
+
+    ctc_f.set_nb_threads(3);
+    CHECK(ctc_f.nb_threads() == 3);
+    ctc_f.contract(x);
+    CHECK(x == x_seq);
+
+    ctc_f.set_nb_threads(1);
+    CHECK(ctc_f.nb_threads() == 1);
+  }
 }
\ No newline at end of file
@@ -813,4 +813,40 @@ TEST_CASE("Computing partial integration, two interval bounds", "[core]")
 
     if(TEST_COMPUTATION_TIMES) CHECK(COEFF_COMPUTATION_TIME*t[0] < t[1]);
   }
-}
\ No newline at end of file
+}
+TEST_CASE("Synthesis tree and sampling", "[core]")
+{
+  SECTION("Samplings of a tube with synthesis tree")
+  {
+    Tube x(Interval(0.,10.), 0.5, TFunction("cos(t)+[-0.1,0.1]"));
+    x.enable_synthesis(SynthesisMode::BINARY_TREE);
+
+    for(int k = 1 ; k <= 200 ; k++)
+    {
+      x.sample(10. * fmod(k * 0.618034, 1.)); // spread samplings
+      x.sample(0.001 * k); // samplings in the same area, unbalancing the tree
+    }
+
+    CHECK(x.nb_slices() == 420);
+
+    Tube y(x); // the copy has no synthesis
+    y.enable_synthesis(SynthesisMode::BINARY_TREE); // tree built from scratch
+
+    for(const Interval& t : { Interval(0.,10.), Interval(0.,0.1), Interval(0.0501,0.1502),
+                              Interval(2.5,7.3), Interval(4.2), Interval(9.9,10.) })
+    {
+      CHECK(x(t) == y(t));
+      CHECK(x.eval(t) == y.eval(t));
+      CHECK(ApproxIntv(x.integral(t)) == y.integral(t));
+    }
+
+    CHECK(x.invert(Interval(0.5,0.6)) == y.invert(Interval(0.5,0.6)));
+    CHECK(x.invert(Interval(-0.2,0.), Interval(2.,8.)) == y.invert(Interval(-0.2,0.), Interval(2.,8.)));
+
+    // Contractions of sampled slices are reported to the tree
+    x.set(Interval(0.,0.1), Interval(0.0501,0.1502));
+    y.set(Interval(0.,0.1), Interval(0.0501,0.1502));
+    CHECK(x.codomain() == y.codomain());
+    CHECK(x(Interval(0.,0.2)) == y(Interval(0.,0.2)));
+  }
+}
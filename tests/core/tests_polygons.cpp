@@ -901,6 +901,46 @@ TEST_CASE("Polygons (intersections, again)")
     ConvexPolygon p_truth(v_points);
     CHECK(p_truth.is_subset(p_inter) != NO);
   }
+
+  SECTION("Polygons intersections, test 11 (linear method, regular polygons)")
+  {
+    for(int k = 0 ; k < 20 ; k++)
+    {
+      vector<Vector> v_pts1, v_pts2;
+      for(int i = 0 ; i < 10+k ; i++)
+      {
+        double a1 = 2.*M_PI*i/(10+k), a2 = 2.*M_PI*i/(25-k) + 0.1*k;
+        v_pts1.push_back(Vector({ 3.*cos(a1), 3.*sin(a1) }));
+        if(i < 25-k)
+          v_pts2.push_back(Vector({ 0.4*k + 2.*cos(a2), 0.1*k + 2.5*sin(a2) }));
+      }
+
+      ConvexPolygon p1(v_pts1), p2(v_pts2);
+      ConvexPolygon p_inter = p1 & p2;
+      ConvexPolygon p_truth(inter_thickpoints(p1,p2)); // quadratic method
+
+      CHECK(ApproxConvexPolygon(p_truth) == p_inter);
+      CHECK(ApproxConvexPolygon(p_truth) == (p2 & p1));
+    }
+  }
+
+  SECTION("Polygons intersections, test 12 (linear method, inclusions)")
+  {
+    vector<ThickPoint> v_points;
+    v_points.push_back(ThickPoint(1.,1.));
+    v_points.push_back(ThickPoint(2.,4.));
+    v_points.push_back(ThickPoint(7.,5.));
+    v_points.push_back(ThickPoint(6.,2.));
+    ConvexPolygon p(v_points);
+
+    ConvexPolygon p_big(IntervalVector(2,Interval(-10.,10.)));
+    CHECK((p & p_big) == p);
+    CHECK((p_big & p) == p);
+
+    ConvexPolygon p_out(IntervalVector(2,Interval(20.,25.)));
+    CHECK((p & p_out).is_empty());
+    CHECK((p_out & p).is_empty());
+  }
 }
 
 TEST_CASE("Polygons (Graham scan)")
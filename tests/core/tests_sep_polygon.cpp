@@ -211,3 +211,116 @@ TEST_CASE("SepPolygon")
     }
   }
 }
+
+TEST_CASE("PolygonEdgeGrid")
+{
+  // Star-shaped polygon with many vertices
+  int n = 2000;
+  std::vector<std::vector<double>> vertices;
+  for(int k = 0; k < n; k++)
+  {
+    double t = 2.*M_PI*k/n, r = 5. + 2.*sin(7.*t);
+    vertices.push_back({r*cos(t), r*sin(t)});
+  }
+
+  std::vector<double> ax, ay, bx, by;
+  for(int k = 0; k < n; k++)
+  {
+    ax.push_back(vertices[k][0]); ay.push_back(vertices[k][1]);
+    bx.push_back(vertices[(k+1)%n][0]); by.push_back(vertices[(k+1)%n][1]);
+  }
+
+  SECTION("Edges around a box")
+  {
+    PolygonEdgeGrid grid(ax, ay, bx, by);
+    CHECK(grid.nb_edges() == n);
+
+    std::vector<int> v_edges;
+    grid.edges(IntervalVector(2, Interval(20., 30.)), v_edges);
+    CHECK(v_edges.empty());
+
+    grid.edges(IntervalVector(2), v_edges);
+    CHECK((int)v_edges.size() == n);
+
+    IntervalVector box({Interval(6.,6.5), Interval(-0.5,0.5)});
+    grid.edges(box, v_edges);
+    CHECK(!v_edges.empty());
+    CHECK((int)v_edges.size() < n);
+    CHECK(std::is_sorted(v_edges.begin(), v_edges.end()));
+
+    for(int k = 0; k < n; k++) // edges not listed do not intersect the box
+      if(!std::binary_search(v_edges.begin(), v_edges.end(), k))
+      {
+        CtcSegment c(ax[k], ay[k], bx[k], by[k]);
+        IntervalVector x(box);
+        c.contract(x);
+        CHECK(x.is_empty());
+      }
+  }
+
+  SECTION("Inclusion tests")
+  {
+    PdcInPolygon pdc(vertices);
+
+    for(double x = -8.; x <= 8.; x += 0.37)
+      for(double y = -8.; y <= 8.; y += 0.41)
+      {
+        // Reference: number of edges crossed by a horizontal half-line
+        int nb_crossings = 0;
+        for(int k = 0; k < n; k++)
+          if((ay[k] <= y) != (by[k] <= y) && x < ax[k] + (y-ay[k])*(bx[k]-ax[k])/(by[k]-ay[k]))
+            nb_crossings++;
+
+        BoolInterval res = pdc.test(IntervalVector({x, y}));
+        CHECK(res != ibex::MAYBE);
+        CHECK(res == (nb_crossings % 2 == 1 ? ibex::YES : ibex::NO));
+      }
+
+    CHECK(pdc.test(IntervalVector({0., 0.})) == ibex::YES);
+    CHECK(pdc.test(IntervalVector({7.5, 7.5})) == ibex::NO);
+    CHECK(pdc.test(IntervalVector({100., 0.})) == ibex::NO);
+  }
+
+  SECTION("Boundary contractor")
+  {
+    PdcInPolygon pdc(vertices);
+    Array<Ctc> l(n);
+    for(int k = 0; k < n; k++)
+      l.set_ref(k, *new CtcSegment(ax[k], ay[k], bx[k], by[k]));
+
+    CtcUnion ctc_union(l);
+    CtcPolygonBoundary ctc_boundary(l, pdc.grid());
+
+    for(double x = -8.; x <= 8.; x += 0.93)
+      for(double y = -8.; y <= 8.; y += 1.07)
+      {
+        IntervalVector x1({Interval(x,x+0.6), Interval(y,y+0.4)}), x2(x1);
+        ctc_union.contract(x1);
+        ctc_boundary.contract(x2);
+        CHECK(x1 == x2);
+      }
+
+    for(int k = 0; k < n; k++)
+      delete &l[k];
+  }
+
+  SECTION("Separator")
+  {
+    SepPolygon sep(vertices);
+
+    for(double x = -8.; x <= 8.; x += 0.93)
+      for(double y = -8.; y <= 8.; y += 1.07)
+      {
+        IntervalVector X0({Interval(x,x+0.6), Interval(y,y+0.4)});
+        IntervalVector xin(X0), xout(X0);
+        sep.separate(xin, xout);
+        CHECK((xin | xout) == X0);
+      }
+
+    IntervalVector X0 = IntervalVector({Interval(0), Interval(0)}).inflate(0.5);
+    IntervalVector xin(X0), xout(X0);
+    sep.separate(xin, xout);
+    CHECK(xin.is_empty());
+    CHECK(xout == X0);
+  }
+}
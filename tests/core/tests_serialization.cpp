@@ -8,6 +8,7 @@
 // of the class for tests purposes
 #define protected public
 #include "codac_TrajectoryVector.h"
+#include "codac_MappedTubeFile.h"
 
 using namespace Catch;
 using namespace Detail;
@@ -185,7 +186,7 @@ TEST_CASE("serialization/deserialization of Tube")
   }
 }
 
-bool test_serialization(const Tube& tube1)
+bool test_serialization(const Tube& tube1, int version_number = SERIALIZATION_VERSION)
 {
   string filename = "test_serialization.tube";
 
@@ -195,7 +196,7 @@ bool test_serialization(const Tube& tube1)
     traj_test1.set(tube1(i).is_unbounded() | tube1(i).is_empty() ? 1. : tube1(i).mid(),
                    tube1.slice(i)->tdomain().mid());
 
-  tube1.serialize(filename, traj_test1); // serialization
+  tube1.serialize(filename, traj_test1, version_number); // serialization
 
   Tube tube2(filename, traj_test2); // deserialization
   remove(filename.c_str());
@@ -295,4 +296,108 @@ TEST_CASE("(de)serializations on unbounded tubes", "[core]")
     tube.set(Interval::EMPTY_SET);
     CHECK(test_serialization(tube));
   }
-}
\ No newline at end of file
+}
+TEST_CASE("(de)serializations with previous version", "[core]")
+{
+  SECTION("Test bounded tubes, version 2")
+  {
+    CHECK(test_serialization(tube_test_1(), 2));
+    CHECK(test_serialization(tube_test2(), 2));
+    CHECK(test_serialization(tube_test4_05(), 2));
+  }
+
+  SECTION("Test unbounded tubes, version 2")
+  {
+    Tube tube = tube_test4();
+    tube.set(Interval::EMPTY_SET, 0);
+    tube.set(Interval::POS_REALS, 3);
+    tube.set(Interval::ALL_REALS, 8);
+    CHECK(test_serialization(tube, 2));
+    CHECK(test_serialization(tube, 3));
+  }
+
+  SECTION("Vector case, version 2")
+  {
+    TubeVector tube1(Interval(0.,46.), 1., 3);
+    tube1.set(IntervalVector(3, Interval(2.,3.)), 0.);
+    tube1.set(IntervalVector(3, Interval::EMPTY_SET), 46.);
+
+    string filename = "test_serialization_v2.tube";
+    tube1.serialize(filename, 2);
+    TubeVector tube2(filename);
+    remove(filename.c_str());
+    CHECK(tube1 == tube2);
+  }
+}
+
+TEST_CASE("MappedTubeFile", "[core]")
+{
+  SECTION("Tube")
+  {
+    Tube tube1 = tube_test_1();
+    tube1.set(Interval::EMPTY_SET, 46.);
+
+    string filename = "test_mapped.tube";
+    tube1.serialize(filename);
+
+    MappedTubeFile file(filename, false);
+    CHECK(file.size() == 1);
+    CHECK(file.nb_slices() == tube1.nb_slices());
+    CHECK(file.tdomain() == tube1.tdomain());
+    CHECK(file.codomain(0) == tube1.codomain());
+    CHECK(file.time_bounds()[0] == tube1.tdomain().lb());
+    CHECK(file.time_bounds()[tube1.nb_slices()] == tube1.tdomain().ub());
+    CHECK(file.slice_codomain(0, 3) == tube1(3));
+    CHECK(file.gate(0, 0) == tube1(0.));
+    CHECK(file.gate(0, tube1.nb_slices()) == Interval::EMPTY_SET);
+
+    Tube *tube2;
+    file.load(tube2);
+    CHECK(tube1 == *tube2);
+    delete tube2;
+    remove(filename.c_str());
+  }
+
+  SECTION("TubeVector")
+  {
+    TubeVector tube1(Interval(0.,10.), 0.5, 4);
+    for(int i = 0 ; i < 4 ; i++)
+      tube1[i].set(Interval(-i,i+1.));
+    tube1[2].set(Interval(1.), 3.);
+
+    string filename = "test_mapped_vector.tube";
+    tube1.serialize(filename);
+
+    MappedTubeFile file(filename);
+    CHECK(file.size() == 4);
+    CHECK(file.codomain() == tube1.codomain());
+    CHECK(file.gate(2, 6) == Interval(1.));
+
+    Tube *tube2;
+    file.load(tube2, 2);
+    CHECK(tube1[2] == *tube2);
+    delete tube2;
+
+    TubeVector *tube3;
+    file.load(tube3, 1, 2);
+    CHECK(tube3->size() == 2);
+    CHECK((*tube3)[0] == tube1[1]);
+    CHECK((*tube3)[1] == tube1[2]);
+    delete tube3;
+
+    TubeVector *tube4;
+    file.load(tube4);
+    CHECK(tube1 == *tube4);
+    delete tube4;
+    remove(filename.c_str());
+  }
+
+  SECTION("Previous version")
+  {
+    Tube tube1 = tube_test_1();
+    string filename = "test_mapped_v2.tube";
+    tube1.serialize(filename, 2);
+    CHECK_THROWS(MappedTubeFile(filename, false););
+    remove(filename.c_str());
+  }
+}
@@ -0,0 +1,121 @@
+#include <algorithm>
+#include "catch_interval.hpp"
+#include "codac_sivia.h"
+#include "codac_CtcFunction.h"
+#include "codac_SepPolygon.h"
+#include "codac_SIVIAPaving.h"
+
+using namespace Catch;
+using namespace Detail;
+using namespace std;
+using namespace codac;
+
+vector<IntervalVector> sorted_boxes(const list<IntervalVector>& l)
+{
+  vector<IntervalVector> v(l.begin(), l.end());
+  sort(v.begin(), v.end(), [](const IntervalVector& a, const IntervalVector& b) {
+    return a[0].lb() < b[0].lb() || (a[0].lb() == b[0].lb() && a[1].lb() < b[1].lb());
+  });
+  return v;
+}
+
+double total_volume(const list<IntervalVector>& l)
+{
+  double vol = 0.;
+  for(const auto& x : l)
+    vol += x.volume();
+  return vol;
+}
+
+TEST_CASE("Parallel SIVIA")
+{
+  SECTION("Contractor")
+  {
+    IntervalVector x0(2, Interval(-3.,3.));
+    auto ctc_factory = []() {
+      return unique_ptr<Ctc>(new CtcFunction(Function("x[2]", "x[0]^2+x[1]^2"), Interval(0.,4.)));
+    };
+
+    auto res_ref = SIVIA(x0, ctc_factory, 0.1, 1, false, false, false, "", true);
+    CHECK(res_ref.find(SetValue::IN) == res_ref.end());
+    CHECK(!res_ref[SetValue::UNKNOWN].empty());
+    CHECK(Approx(total_volume(res_ref[SetValue::OUT]) + total_volume(res_ref[SetValue::UNKNOWN])) == x0.volume());
+
+    for(const auto& x : res_ref[SetValue::UNKNOWN])
+      CHECK(x.max_diam() < 0.1);
+
+    for(bool best_first : { false, true })
+    {
+      // The boxes do not depend on the order of the computations
+      auto res = SIVIA(x0, ctc_factory, 0.1, 4, best_first, false, false, "", true);
+      CHECK(sorted_boxes(res[SetValue::OUT]) == sorted_boxes(res_ref[SetValue::OUT]));
+      CHECK(sorted_boxes(res[SetValue::UNKNOWN]) == sorted_boxes(res_ref[SetValue::UNKNOWN]));
+    }
+  }
+
+  SECTION("Separator")
+  {
+    IntervalVector x0(2, Interval(-1.,6.));
+    auto sep_factory = []() {
+      vector<vector<vector<double> > > edges = {
+        {{0,0}, {5,0}}, {{5,0}, {5,5}}, {{5,5}, {0,5}}, {{0,5}, {0,0}}
+      };
+      return unique_ptr<ibex::Sep>(new SepPolygon(edges));
+    };
+
+    auto res_ref = SIVIA(x0, sep_factory, 0.1, 1, false, true, false, "", true);
+    CHECK(!res_ref[SetValue::IN].empty());
+    CHECK(Approx(total_volume(res_ref[SetValue::IN])
+      + total_volume(res_ref[SetValue::OUT])
+      + total_volume(res_ref[SetValue::UNKNOWN])) == x0.volume());
+
+    for(bool best_first : { false, true })
+    {
+      auto res = SIVIA(x0, sep_factory, 0.1, 4, best_first, true, false, "", true);
+      CHECK(sorted_boxes(res[SetValue::IN]) == sorted_boxes(res_ref[SetValue::IN]));
+      CHECK(sorted_boxes(res[SetValue::OUT]) == sorted_boxes(res_ref[SetValue::OUT]));
+      CHECK(sorted_boxes(res[SetValue::UNKNOWN]) == sorted_boxes(res_ref[SetValue::UNKNOWN]));
+    }
+  }
+}
+
+TEST_CASE("Connected subsets")
+{
+  SECTION("Two disjoint subsets")
+  {
+    SIVIAPaving p(IntervalVector(2, Interval(-4.,4.)));
+    p.compute(Function("x[2]", "(x[0]^2-4)^2+x[1]^2"), IntervalVector(1, Interval(0.,1.)), 0.05);
+
+    list<IntervalVector> l_boxes;
+    p.get_boxes(l_boxes, SetValue::IN | SetValue::UNKNOWN);
+
+    vector<ConnectedSubset> v_subsets = p.get_connected_subsets();
+    REQUIRE(v_subsets.size() == 2);
+
+    size_t nb_items = 0;
+    for(const auto& subset : v_subsets)
+    {
+      nb_items += subset.get_items().size();
+      CHECK(subset.is_strictly_included_in_paving());
+    }
+    CHECK(nb_items == l_boxes.size());
+
+    CHECK(v_subsets[0].contains(Vector({-2.,0.})));
+    CHECK(!v_subsets[0].contains(Vector({2.,0.})));
+    CHECK(v_subsets[1].contains(Vector({2.,0.})));
+    CHECK(!v_subsets[0].box().intersects(v_subsets[1].box()));
+  }
+
+  SECTION("Subsets touching at a corner")
+  {
+    Paving p(IntervalVector(2, Interval(0.,4.)), SetValue::OUT);
+    p.bisect(0.5); p.get_first_subpaving()->bisect(0.5); p.get_second_subpaving()->bisect(0.5);
+    // Four quadrants, two of them being IN: they share a corner
+    p.get_first_subpaving()->get_first_subpaving()->set_value(SetValue::IN);
+    p.get_second_subpaving()->get_second_subpaving()->set_value(SetValue::IN);
+
+    CHECK(p.get_connected_subsets(false, SetValue::IN).size() == 1);
+    CHECK(p.get_connected_subsets(false, SetValue::OUT).size() == 1);
+    CHECK(p.get_connected_subsets(false, SetValue::UNKNOWN).empty());
+  }
+}
@@ -354,6 +354,31 @@ TEST_CASE("Tube slices structure")
     CHECK(x == xold);
   }
 
+  SECTION("Slices index after structural changes")
+  {
+    Tube x(Interval(0.,10.), 1., Interval(-1.,1.));
+    x.sample(2.5);
+    x.sample(7.2);
+    x.remove_gate(4.);
+    x.merge_similar_slices(0.);
+    CHECK(x.nb_slices() == 11);
+
+    int i = 0;
+    for(const Slice *s = x.first_slice() ; s ; s = s->next_slice())
+    {
+      CHECK(x.slice(i) == s);
+      CHECK(x.index(s) == i);
+      CHECK(x.time_to_index(s->tdomain().lb()) == i);
+      CHECK(x.slice(s->tdomain().mid()) == s);
+      i++;
+    }
+
+    CHECK(i == x.nb_slices());
+    CHECK(x.last_slice() == x.slice(x.nb_slices()-1));
+    CHECK(x.slice(-1) == nullptr);
+    CHECK(x.slice(x.nb_slices()) == nullptr);
+  }
+
   SECTION("truncate_tdomain, test 1")
   {
     TubeVector tube(Interval(0.,10.), 1., 2);
@@ -415,3 +440,72 @@ TEST_CASE("Tube slices structure")
     CHECK(tube[0].slice(2)->tdomain() == Interval(5.,6.));
   }
 }
+
+TEST_CASE("Slices memory")
+{
+  SECTION("Contiguous slices")
+  {
+    Tube x(Interval(0.,10.), 0.01, Interval(-1.,1.));
+    CHECK(x.nb_slices() == 1000);
+
+    for(int i = 1 ; i < x.nb_slices() ; i++)
+      CHECK(x.slice(i) == x.slice(i-1) + 1);
+
+    Tube y(x);
+    CHECK(y == x);
+    for(int i = 1 ; i < y.nb_slices() ; i++)
+      CHECK(y.slice(i) == y.slice(i-1) + 1);
+  }
+
+  SECTION("Slices created and deleted after the construction")
+  {
+    Tube x(Interval(0.,10.), 1., Interval(-1.,1.));
+    x.sample(4.5, Interval(0.5));
+    x.sample(8.2);
+    CHECK(x.nb_slices() == 12);
+    CHECK(x(4.5) == Interval(0.5));
+
+    x.remove_gate(4.5);
+    CHECK(x.nb_slices() == 11);
+    x.sample(4.5, Interval(0.5));
+    CHECK(x.nb_slices() == 12);
+
+    x.truncate_tdomain(Interval(2.,9.));
+    CHECK(x.nb_slices() == 9);
+    CHECK(x(4.5) == Interval(0.5));
+
+    Tube y(x);
+    CHECK(y == x);
+    y.sample(2.5);
+    y.remove_gate(3.);
+    CHECK(y.nb_slices() == 9);
+
+    x = y;
+    CHECK(x == y);
+    CHECK(x.slice(1) == x.slice(0) + 1);
+  }
+
+  SECTION("Slices appended at the end")
+  {
+    Tube x(Interval(0.,1.), Interval(-1.,1.));
+    for(int i = 2 ; i <= 10 ; i++)
+      x.extend_tdomain(i, Interval(i));
+
+    CHECK(x.nb_slices() == 10);
+    CHECK(x.tdomain() == Interval(0.,10.));
+    CHECK(x.slice(9)->tdomain() == Interval(9.,10.));
+    CHECK(x(9) == Interval(10.));
+    CHECK(x(10.) == Interval(10.));
+    CHECK(x(1.) == Interval(-1.,1.)); // previous output gate, shared
+    CHECK(x.slice(2)->input_gate() == x.slice(1)->output_gate());
+    CHECK(x(5.5) == Interval(6.));
+    CHECK(x.index(x.last_slice()) == 9);
+    CHECK(x.slice(7.5) == x.slice(7));
+
+    TubeVector y(Interval(0.,1.), 2);
+    y.extend_tdomain(1.5, IntervalVector(2, Interval(3.)));
+    CHECK(y.nb_slices() == 2);
+    CHECK(y.tdomain() == Interval(0.,1.5));
+    CHECK(y(1) == IntervalVector(2, Interval(3.)));
+  }
+}
@@ -425,6 +425,90 @@ TEST_CASE("Testing set inversion")
     Tube x(domain, dt, TFunction("[-1,1]*(t^2+1)"));
     CHECK(x.invert(0., x.tdomain()) == domain);
   }
+
+  SECTION("Inversions with synthesis tree")
+  {
+    Tube x = tube_test_1();
+    x.set(Interval(-4,2), 14);
+    Tube y(x);
+    y.enable_synthesis(SynthesisMode::BINARY_TREE);
+
+    vector<Interval> v_x, v_y;
+    for(const Interval& z : { Interval(0.), Interval(-1.,1.), Interval(-6.9999), Interval(3.5),
+                              Interval(-4.,-3.), Interval(-30.,-29.), Interval::ALL_REALS })
+      for(const Interval& t : { x.tdomain(), Interval(3.8,42.5), Interval(14.), Interval(4.5,20.) })
+      {
+        x.invert(z, v_x, t);
+        y.invert(z, v_y, t);
+        CHECK(v_x == v_y);
+      }
+
+    // Slices sampled after the creation of the tree
+    y.sample(20.5);
+    y.sample(35.2);
+    x = y;
+    x.enable_synthesis(SynthesisMode::NONE);
+    x.invert(Interval(0.), v_x, Interval(3.8,42.5));
+    y.invert(Interval(0.), v_y, Interval(3.8,42.5));
+    CHECK(v_x == v_y);
+
+    // Slices appended after the creation of the tree
+    double tf = y.tdomain().ub();
+    y.extend_tdomain(tf+1., Interval(-1.,0.5));
+    y.extend_tdomain(tf+2., Interval(3.,4.));
+    x = y;
+    x.enable_synthesis(SynthesisMode::NONE);
+    for(const Interval& z : { Interval(0.), Interval(3.5), Interval::ALL_REALS })
+    {
+      x.invert(z, v_x, Interval(3.8,tf+2.));
+      y.invert(z, v_y, Interval(3.8,tf+2.));
+      CHECK(v_x == v_y);
+    }
+    CHECK(y(Interval(tf-1.,tf+2.)) == x(Interval(tf-1.,tf+2.)));
+    CHECK(y.codomain() == x.codomain());
+  }
+
+  SECTION("Inversions with synthesis tree and empty slices")
+  {
+    Tube x = tube_test_1();
+    x.slice(5)->set_envelope(Interval::EMPTY_SET, false); // gates are kept
+    x.slice(20)->set_empty();
+    Tube y(x);
+    y.enable_synthesis(SynthesisMode::BINARY_TREE);
+
+    // The inversion of an empty slice is its tdomain
+    vector<Interval> v_x, v_y;
+    for(const Interval& z : { Interval(0.), Interval(-30.,-29.), Interval(100.) })
+      for(const Interval& t : { x.tdomain(), Interval(3.,25.), Interval(4.5,20.5) })
+      {
+        x.invert(z, v_x, t);
+        y.invert(z, v_y, t);
+        CHECK(v_x == v_y);
+      }
+  }
+
+  SECTION("Inversions with derivative and synthesis tree")
+  {
+    Tube x(Interval(0.,10.), 0.1, TFunction("sin(t)+[-0.1,0.1]"));
+    Tube v(Interval(0.,10.), 0.1, TFunction("cos(t)+[-0.1,0.1]"));
+    Tube y(x);
+    y.enable_synthesis(SynthesisMode::BINARY_TREE);
+
+    vector<Interval> v_x, v_y;
+    for(const Interval& z : { Interval(0.), Interval(0.5,0.6), Interval(0.95,1.), Interval(2.) })
+    {
+      x.invert(z, v_x, v, x.tdomain());
+      y.invert(z, v_y, v, y.tdomain());
+      CHECK(v_x == v_y);
+      CHECK(x.invert(z, v, Interval(1.,9.)) == y.invert(z, v, Interval(1.,9.)));
+    }
+
+    x.invert(Interval(0.), v_x, v, x.tdomain());
+    CHECK(v_x.size() == 4); // 0, pi, 2pi, 3pi
+    CHECK(v_x[1].contains(M_PI));
+    x.invert(Interval(2.), v_x, v, x.tdomain());
+    CHECK(v_x.empty());
+  }
 }
 
 TEST_CASE("Testing set inversion in vector case")
@@ -0,0 +1,80 @@
+#include "catch_interval.hpp"
+#include "codac_CtcConstell.h"
+
+using namespace Catch;
+using namespace Detail;
+using namespace std;
+using namespace ibex;
+using namespace codac;
+
+// Union of the intersections with all the landmarks (linear complexity)
+IntervalVector constell_hull(const IntervalVector& a, const vector<IntervalVector>& map)
+{
+  IntervalVector union_result(2, Interval::EMPTY_SET);
+  for(const auto& mj : map)
+    union_result |= a & mj.subvector(0,1);
+  return union_result;
+}
+
+TEST_CASE("CtcConstell")
+{
+  SECTION("Test CtcConstell")
+  {
+    vector<IntervalVector> map;
+    map.push_back({{1.,2.},{1.,2.}});
+    map.push_back({{4.,5.},{0.,1.}});
+    map.push_back({{4.,5.},{4.,5.},{0.,0.}}); // additional dimensions are not considered
+
+    CtcConstell ctc_constell(map);
+
+    IntervalVector x1{{0.,3.},{0.,3.}};
+    ctc_constell.contract(x1);
+    CHECK(x1 == IntervalVector({{1.,2.},{1.,2.}}));
+
+    IntervalVector x2{{1.5,4.5},{0.5,1.5}};
+    ctc_constell.contract(x2);
+    CHECK(x2 == IntervalVector({{1.5,4.5},{0.5,1.5}}));
+
+    IntervalVector x3{{2.5,3.5},{0.,10.}};
+    ctc_constell.contract(x3);
+    CHECK(x3.is_empty());
+
+    IntervalVector x4{{2.,4.},{1.,4.}}; // intersections on bounds
+    ctc_constell.contract(x4);
+    CHECK(x4 == IntervalVector({{2.,4.},{1.,4.}}));
+  }
+
+  SECTION("Test CtcConstell with a large map")
+  {
+    vector<IntervalVector> map;
+    for(int i = 0 ; i < 2000 ; i++)
+    {
+      double x = 100. * cos(0.37*i), y = 100. * sin(1.13*i);
+      map.push_back(IntervalVector({{x,x+0.5*(i%3)},{y,y+0.1*(i%5)}}));
+    }
+    map.push_back(IntervalVector(2, Interval::EMPTY_SET));
+
+    CtcConstell ctc_constell(map);
+
+    vector<IntervalVector> v_x;
+    for(int i = 0 ; i < 500 ; i++)
+    {
+      double x = 110. * cos(0.71*i), y = 110. * sin(0.29*i);
+      v_x.push_back(IntervalVector({{x-i%7,x+i%4},{y-i%3,y+i%6}}));
+    }
+    v_x.push_back(IntervalVector(2));
+    v_x.push_back(IntervalVector(2, Interval::EMPTY_SET));
+
+    vector<IntervalVector> v_x_batch(v_x);
+    ctc_constell.contract(v_x_batch);
+
+    for(size_t i = 0 ; i < v_x.size() ; i++)
+    {
+      IntervalVector expected = constell_hull(v_x[i], map);
+      IntervalVector x(v_x[i]);
+      ctc_constell.contract(x);
+      CHECK(x == expected);
+      CHECK(v_x_batch[i] == expected);
+    }
+  }
+}
@@ -0,0 +1,117 @@
+#include <cstdio>
+#include <fstream>
+#include "catch_interval.hpp"
+#include "codac_DataStream.h"
+#include "codac_TubeStreamBuilder.h"
+#include "codac_TrajectoryVector.h"
+
+using namespace Catch;
+using namespace Detail;
+using namespace std;
+using namespace ibex;
+using namespace codac;
+
+TEST_CASE("DataStream")
+{
+  SECTION("Parsing lines")
+  {
+    string filename = "test_data_stream.txt";
+    ofstream file(filename.c_str());
+    file << "# header line\n";
+    file << "0.5 1.25\t-3e2,+4\r\n";
+    file << "\n";
+    file << "  7 ; 8.125  \n";
+    file << "9"; // last line, without end-of-line character
+    file.close();
+
+    DataStream data(filename);
+    vector<double> v;
+
+    CHECK(data.skip_lines(1));
+    CHECK(data.read_line(v));
+    CHECK(v == vector<double>({ 0.5, 1.25, -300., 4. }));
+    CHECK(data.read_line(v));
+    CHECK(v.empty());
+    CHECK(data.read_line(v));
+    CHECK(v == vector<double>({ 7., 8.125 }));
+    CHECK(data.read_line(v));
+    CHECK(v == vector<double>({ 9. }));
+    CHECK(data.line_number() == 5);
+    CHECK_FALSE(data.read_line(v));
+
+    DataStream data_header(filename);
+    CHECK_THROWS(data_header.read_line(v););
+    remove(filename.c_str());
+  }
+
+  SECTION("Lines over several chunks")
+  {
+    string filename = "test_data_stream_chunks.txt";
+    ofstream file(filename.c_str());
+    for(int i = 0 ; i < 5000 ; i++)
+      file << i << " " << i*0.5 << " " << -i << "\n";
+    file.close();
+
+    DataStream data(filename, 4096); // small chunks
+    vector<double> v;
+    int i = 0;
+    bool same_values = true;
+    while(data.read_line(v))
+    {
+      same_values &= v == vector<double>({ (double)i, i*0.5, (double)-i });
+      i++;
+    }
+
+    CHECK(same_values);
+    CHECK(i == 5000);
+    remove(filename.c_str());
+  }
+}
+
+TEST_CASE("TubeStreamBuilder")
+{
+  SECTION("Same tube as from trajectories")
+  {
+    TrajectoryVector traj_y(2), traj_rad(2);
+    TubeStreamBuilder builder(2, 0.7);
+
+    for(int k = 0 ; k <= 100 ; k++)
+    {
+      double t = 0.3 + 0.13*k;
+      Vector y({ std::cos(t), std::sin(2.*t) }), rad({ 0.1 + 0.01*k, 0.2 });
+      traj_y.set(y, t);
+      traj_rad.set(rad, t);
+      builder.add(t, y, rad);
+    }
+
+    CHECK(builder.nb_samples() == 101);
+
+    TubeVector x1(traj_y, 0.7);
+    x1.inflate(traj_rad);
+
+    TubeVector *x2 = builder.build();
+    CHECK(builder.nb_samples() == 0);
+    CHECK(x2->nb_slices() == x1.nb_slices());
+    CHECK(x2->tdomain() == x1.tdomain());
+    CHECK(*x2 == x1);
+    delete x2;
+  }
+
+  SECTION("Samples on the bounds of the slices")
+  {
+    TubeStreamBuilder builder(1, 1.);
+    for(int k = 0 ; k <= 4 ; k++)
+      builder.add(k, Vector(1, k*k));
+
+    TubeVector *x = builder.build();
+    CHECK(x->nb_slices() == 4);
+    CHECK((*x)[0](1) == Interval(1.,4.));
+    CHECK((*x)[0](2.) == Interval(4.));
+    CHECK((*x)[0](4.) == Interval(16.));
+    delete x;
+
+    builder.add(0., Vector(1, 0.));
+    CHECK_THROWS(builder.add(0., Vector(1, 1.)););
+    CHECK_THROWS(builder.build(););
+  }
+}
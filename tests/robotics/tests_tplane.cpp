@@ -0,0 +1,84 @@
+#include <vector>
+#include <algorithm>
+#include "catch_interval.hpp"
+#include "codac_TPlane.h"
+
+using namespace Catch;
+using namespace Detail;
+using namespace std;
+using namespace ibex;
+using namespace codac;
+
+// The order of the loops depends on the structure of the tplane
+bool same_loops(const vector<IntervalVector>& v_a, const vector<IntervalVector>& v_b)
+{
+  if(v_a.size() != v_b.size())
+    return false;
+
+  for(const auto& a : v_a)
+    if(find(v_b.begin(), v_b.end(), a) == v_b.end())
+      return false;
+
+  return true;
+}
+
+TEST_CASE("TPlane")
+{
+  Tube::enable_syntheses(); // lazily updated structures, shared by the threads
+
+  double dt = 0.05;
+  Interval tdomain(0.,10.);
+  TubeVector x(tdomain, dt, TFunction("(10*cos(t)+t+[-0.1,0.1];5*sin(2*t)+t+[-0.1,0.1])"));
+  TubeVector v(tdomain, dt, TFunction("(-10*sin(t)+1+[-0.2,0.2];10*cos(2*t)+1+[-0.2,0.2])"));
+
+  SECTION("Multithreaded detections and proofs")
+  {
+    TPlane tplane(tdomain);
+    tplane.compute_detections(dt*2., x, v);
+    tplane.compute_proofs(x, v);
+    CHECK(tplane.nb_loops_detections() > 0);
+
+    for(int nb_threads : { 1, 3, 0 })
+    {
+      TPlane tplane_mt(tdomain);
+      tplane_mt.set_nb_threads(nb_threads);
+      CHECK(tplane_mt.nb_threads() >= 1);
+      tplane_mt.compute_detections(dt*2., x, v);
+      tplane_mt.compute_proofs(x, v);
+
+      CHECK(tplane_mt.detected_loops() == tplane.detected_loops());
+      CHECK(tplane_mt.proven_loops() == tplane.proven_loops());
+    }
+  }
+
+  SECTION("Extended detections")
+  {
+    // The previous tplane is the first quadrant of the full one,
+    // so that both tplanes are made of the same leaves
+    Paving bisected(IntervalVector(2, tdomain));
+    bisected.bisect();
+    const Interval prev_tdomain = bisected.get_first_subpaving()->box()[0];
+
+    TPlane tplane(tdomain);
+    tplane.compute_detections(dt*2., x, v);
+
+    for(int nb_threads : { 1, 3 })
+    {
+      TPlane tplane_ext(prev_tdomain);
+      tplane_ext.set_nb_threads(nb_threads);
+      tplane_ext.compute_detections(dt*2., x, v);
+      tplane_ext.extend_detections(dt*2., x, v);
+
+      CHECK(tplane_ext.box() == tplane.box());
+      CHECK(same_loops(tplane_ext.detected_loops(), tplane.detected_loops()));
+    }
+
+    TPlane tplane_p(tdomain), tplane_p_ext(prev_tdomain);
+    tplane_p.compute_detections(dt*2., x);
+    tplane_p_ext.compute_detections(dt*2., x);
+    tplane_p_ext.extend_detections(dt*2., x);
+    CHECK(same_loops(tplane_p_ext.detected_loops(), tplane_p.detected_loops()));
+  }
+
+  Tube::enable_syntheses(false);
+}
@@ -0,0 +1,117 @@
+#include "catch_interval.hpp"
+#include "codac_GeoImage.h"
+#include "codac_CtcRaster.h"
+#include "codac_SepRaster.h"
+
+using namespace Catch;
+using namespace Detail;
+using namespace std;
+using namespace ibex;
+using namespace codac;
+
+TEST_CASE("CtcRaster")
+{
+  // 10x10 image of 1x1 pixels over [0,10]x[0,10], with a set block [2,5]x[3,4]
+  vector<uint8_t> data(100, 0);
+  for(int i = 2 ; i < 5 ; i++)
+    data[i*10+3] = 1;
+
+  GeoImage img(data, 10, 10, 0., 0., 1., 1.);
+
+  SECTION("Integral image")
+  {
+    CHECK(img.bounding_box() == IntervalVector(2, Interval(0.,10.)));
+    CHECK(img.pixel(2,3));
+    CHECK_FALSE(img.pixel(3,2));
+    CHECK(img.enclosed_pixels({{ 0, 9, 0, 9 }}) == 3);
+    CHECK(img.enclosed_pixels({{ 3, 9, 0, 9 }}) == 2);
+    CHECK(img.enclosed_pixels({{ 0, 9, 4, 9 }}) == 0);
+  }
+
+  SECTION("Contractions")
+  {
+    CtcRaster ctc(img);
+
+    IntervalVector x(2, Interval(0.,10.));
+    ctc.contract(x);
+    CHECK(x[0] == Interval(2.,5.));
+    CHECK(x[1] == Interval(3.,4.));
+
+    x[0] = Interval(3.5,20.); x[1] = Interval(-5.,3.5);
+    ctc.contract(x);
+    CHECK(x[0] == Interval(3.5,5.));
+    CHECK(x[1] == Interval(3.,3.5));
+
+    x[0] = Interval(6.,8.); x[1] = Interval(0.,10.);
+    ctc.contract(x);
+    CHECK(x.is_empty());
+
+    x = IntervalVector(2, Interval(20.,30.));
+    ctc.contract(x);
+    CHECK(x.is_empty());
+  }
+
+  SECTION("Contractions on the complementary set")
+  {
+    CtcRaster ctc(img, true);
+
+    IntervalVector x(2);
+    x[0] = Interval(2.5,4.5); x[1] = Interval(3.2,3.8);
+    ctc.contract(x);
+    CHECK(x.is_empty());
+
+    x[0] = Interval(2.5,6.5); x[1] = Interval(3.2,3.8);
+    ctc.contract(x);
+    CHECK(x[0] == Interval(5.,6.5)); // pixels are closed boxes: x=5 belongs to the unset pixel [5,6]x[3,4]
+    CHECK(x[1] == Interval(3.2,3.8));
+
+    x = IntervalVector(2, Interval(-1.,11.)); // partly outside the image
+    ctc.contract(x);
+    CHECK(x == IntervalVector(2, Interval(-1.,11.)));
+  }
+
+  SECTION("Separator")
+  {
+    SepRaster sep(img);
+
+    IntervalVector x_in(2), x_out(2);
+    x_in[0] = Interval(2.5,4.5); x_in[1] = Interval(3.2,3.8);
+    x_out = x_in;
+    sep.separate(x_in, x_out);
+    CHECK(x_in.is_empty()); // inside the set
+    CHECK(x_out == IntervalVector({ Interval(2.5,4.5), Interval(3.2,3.8) }));
+
+    x_in[0] = Interval(6.,8.); x_in[1] = Interval(6.,8.);
+    x_out = x_in;
+    sep.separate(x_in, x_out);
+    CHECK(x_out.is_empty()); // outside the set
+  }
+
+  SECTION("Image stacked over time, tube contraction")
+  {
+    // Two layers: block at x in [2,3] for t in [0,1], at x in [6,7] for t in [1,2]
+    vector<uint8_t> data_t(2*100, 0);
+    for(int j = 0 ; j < 10 ; j++)
+    {
+      data_t[(0*10+2)*10+j] = 1;
+      data_t[(1*10+6)*10+j] = 1;
+    }
+
+    GeoImage img_t(data_t, 10, 10, 2, 0., 0., 1., 1., 0., 1.);
+    CHECK(img_t.nb_layers() == 2);
+    CHECK(img_t.tdomain() == Interval(0.,2.));
+    CtcRaster ctc(img_t);
+
+    IntervalVector x(3, Interval(0.,10.));
+    x[0] = Interval(0.,0.5);
+    ctc.contract(x);
+    CHECK(x[1] == Interval(2.,3.));
+
+    TubeVector tube(Interval(0.,2.), 0.5, IntervalVector(2, Interval(0.,10.)));
+    ctc.contract(tube);
+    CHECK(tube(0.25)[0] == Interval(2.,3.));
+    CHECK(tube(1.75)[0] == Interval(6.,7.));
+    CHECK(tube(1.)[0] == Interval(2.,7.)); // gate between the layers
+    CHECK(tube(0.25)[1] == Interval(0.,10.));
+  }
+}
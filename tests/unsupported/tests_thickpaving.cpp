@@ -0,0 +1,98 @@
+#include <cstdio>
+#include <vector>
+#include <memory>
+#include "catch_interval.hpp"
+#include "codac_ThickPaving.h"
+
+using namespace Catch;
+using namespace Detail;
+using namespace std;
+using namespace ibex;
+using namespace codac;
+
+class LeavesVisitor : public ThickVisitor
+{
+  public:
+
+    void visit_leaf(const IntervalVector& box, ThickBoolean status)
+    {
+      v_boxes.push_back(box);
+      v_status.push_back(status);
+    }
+
+    vector<IntervalVector> v_boxes;
+    vector<ThickBoolean> v_status;
+};
+
+TEST_CASE("ThickPaving")
+{
+  IntervalVector X0(2, Interval(-5.,5.));
+
+  SECTION("Boxes of the subpavings")
+  {
+    FuncTest f = [](const IntervalVector& X)->ThickBoolean { return UNK; };
+    ThickPaving A(X0, UNK, LargestFirst(0, 0.5));
+    A.Sivia(f, 2.5);
+    CHECK(A.root.getBox() == X0);
+    CHECK(A.root.countLeaves() == 16);
+
+    LeavesVisitor v;
+    A.visit(v);
+    CHECK(v.v_boxes.size() == 16);
+    CHECK(v.v_boxes[0] == IntervalVector(2, Interval(-5.,-2.5)));
+    CHECK(v.v_boxes[15] == IntervalVector(2, Interval(2.5,5.)));
+  }
+
+  SECTION("Multithreaded Sivia")
+  {
+    ThickDisk t(Interval(0.), Interval(0.), Interval(0.,3.), Interval(0.,4.));
+
+    ThickPaving A(X0, UNK);
+    A.Sivia(t, 0.05, opInter);
+    A.Reunite();
+    LeavesVisitor v_A;
+    A.visit(v_A);
+
+    for(int nb_threads : { 1, 3, 0 })
+    {
+      ThickPaving B(X0, UNK);
+      B.Sivia([]() {
+          return unique_ptr<ThickTest>(new ThickDisk(Interval(0.), Interval(0.), Interval(0.,3.), Interval(0.,4.)));
+        }, 0.05, opInter, nb_threads);
+      LeavesVisitor v_B;
+      B.visit(v_B);
+
+      CHECK(v_B.v_boxes == v_A.v_boxes);
+      CHECK(v_B.v_status == v_A.v_status);
+
+      // Test shared by the threads
+      FuncTest f = [&t](const IntervalVector& X) { return t.test(X); };
+      ThickPaving C(X0, UNK);
+      C.Sivia(f, 0.05, opInter, nb_threads);
+      LeavesVisitor v_C;
+      C.visit(v_C);
+
+      CHECK(v_C.v_boxes == v_A.v_boxes);
+      CHECK(v_C.v_status == v_A.v_status);
+    }
+  }
+
+  SECTION("Save and load")
+  {
+    ThickDisk t(Interval(1.), Interval(0.), Interval(0.,2.), Interval(0.,2.5));
+    ThickPaving A(X0, UNK);
+    FuncTest f = [&t](const IntervalVector& X) { return t.test(X); };
+    A.Sivia(f, 0.1, opInter, 2);
+    A.save("test_thickpaving.bin");
+
+    ThickPaving B("test_thickpaving.bin");
+    remove("test_thickpaving.bin");
+
+    LeavesVisitor v_A, v_B;
+    A.visit(v_A);
+    B.visit(v_B);
+    CHECK(B.root.getBox() == X0);
+    CHECK(v_B.v_boxes == v_A.v_boxes);
+    CHECK(v_B.v_status == v_A.v_status);
+  }
+}